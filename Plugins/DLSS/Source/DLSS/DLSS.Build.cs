@@ -18,6 +18,17 @@ public class DLSS : ModuleRules
 	{
 		if (Target.Platform.IsInGroup(UnrealPlatformGroup.Windows))
 		{
+			// the mock NGX backend is a profiling aid, so it stays out of shipping builds and out of the prebuilt editor binaries
+			if (Target.Configuration != UnrealTargetConfiguration.Shipping && Target.Type != TargetType.Editor)
+			{
+				return new string[]
+				{
+					"NGXD3D11RHI",
+					"NGXD3D12RHI",
+					"NGXVulkanRHI",
+					"NGXMockRHI"
+				};
+			}
 			return new string[]
 			{
 				"NGXD3D11RHI",
@@ -181,8 +181,22 @@ void FDLSSModule::StartupModule()
 	}
 
 	const int32 NGXDLSSMinimumWindowsBuildVersion = CVarNGXDLSSMinimumWindowsBuildVersion.GetValueOnAnyThread();
+
+	// -ngxmock swaps the NGX driver for a CPU emulation (see NGXMockRHI.h) so the plugin can be profiled on any GPU.
+	// The mock module is only built for non-shipping game targets
+	bool bUseMockNGX = false;
+#if !UE_BUILD_SHIPPING
+	if (FParse::Param(FCommandLine::Get(), TEXT("ngxmock")))
+	{
+		bUseMockNGX = FModuleManager::Get().ModuleExists(TEXT("NGXMockRHI"));
+		if (!bUseMockNGX)
+		{
+			UE_LOG(LogDLSS, Warning, TEXT("Ignoring -ngxmock, the NGXMockRHI module is not part of this build"));
+		}
+	}
+#endif
 	
-	if (!IsRHIDeviceNVIDIA())
+	if (!bUseMockNGX && !IsRHIDeviceNVIDIA())
 	{
 		UE_LOG(LogDLSS, Log, TEXT("NVIDIA NGX DLSS requires an NVIDIA RTX series graphics card"));
 		NGXSupport = ENGXSupport::NotSupportedIncompatibleHardware;
@@ -213,11 +227,16 @@ void FDLSSModule::StartupModule()
 		const bool bIsVulkan = (RHIType == ERHIInterfaceType::Vulkan) && GetDefault<UDLSSSettings>()->bEnableDLSSVulkan;
 		const TCHAR* NGXRHIModuleName = nullptr;
 
-		NGXSupport = (bIsDX11 || bIsDX12 || bIsVulkan) ? ENGXSupport::Supported : ENGXSupport::NotSupported; 
+		NGXSupport = (bUseMockNGX || bIsDX11 || bIsDX12 || bIsVulkan) ? ENGXSupport::Supported : ENGXSupport::NotSupported; 
 
 		if (NGXSupport == ENGXSupport::Supported)
 		{
-			if (bIsDX11)
+			if (bUseMockNGX)
+			{
+				UE_LOG(LogDLSS, Log, TEXT("Using the mock NGX backend because of -ngxmock, DLSS will not produce any output"));
+				NGXRHIModuleName = TEXT("NGXMockRHI");
+			}
+			else if (bIsDX11)
 			{
 				NGXRHIModuleName = TEXT("NGXD3D11RHI");
 			}
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2022 - 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 *
 * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
 * property and proprietary rights in and to this material, related
@@ -8,15 +8,14 @@
 * without an express license agreement from NVIDIA CORPORATION or
 * its affiliates is strictly prohibited.
 */
+
 using UnrealBuildTool;
-using System.IO;
 
-public class StreamlineRHI : ModuleRules
+public class NGXMockRHI : ModuleRules
 {
-	public StreamlineRHI(ReadOnlyTargetRules Target) : base(Target)
+	public NGXMockRHI(ReadOnlyTargetRules Target) : base(Target)
 	{
 		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
-		
 
 		PublicIncludePaths.AddRange(
 			new string[] {
@@ -40,27 +39,14 @@ public class StreamlineRHI : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"Core",
-				"CoreUObject",
-				"Engine",
-				"Projects",
-				"RenderCore",
-				"RHI",
-				"Streamline",
-			}
-			);
-		DynamicallyLoadedModuleNames.AddRange(
-			new string[]
-			{
-				"StreamlineD3D11RHI",
-				"StreamlineD3D12RHI",
+					"Core",
+					"Engine",
+					"RenderCore",
+					"RHI",
+					
+					"NGX",
+					"NGXRHI",
 			}
 			);
-
-		if (Target.bBuildEditor == true)
-		{
-			PrivateDependencyModuleNames.Add("UnrealEd");
-		}
-
 	}
 }
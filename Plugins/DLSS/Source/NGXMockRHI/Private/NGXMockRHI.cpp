@@ -0,0 +1,729 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "NGXMockRHI.h"
+
+#include "nvsdk_ngx.h"
+#include "nvsdk_ngx_helpers.h"
+#include "nvsdk_ngx_helpers_dlssd.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Crc.h"
+#include "RenderingThread.h"
+
+#include <atomic>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogDLSSNGXMockRHI, Log, All);
+
+#define LOCTEXT_NAMESPACE "FNGXMockRHIModule"
+
+DECLARE_STATS_GROUP(TEXT("DLSS Mock"), STATGROUP_NGXMock, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("ExecuteDLSS (total)"), STAT_NGXMockExecuteDLSS, STATGROUP_NGXMock);
+DECLARE_CYCLE_STAT(TEXT("ExecuteDLSS (simulated SDK latency)"), STAT_NGXMockSimulatedLatency, STATGROUP_NGXMock);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mock feature creates"), STAT_NGXMockFeatureCreates, STATGROUP_NGXMock);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mock feature evaluations"), STAT_NGXMockFeatureEvaluations, STATGROUP_NGXMock);
+
+static TAutoConsoleVariable<float> CVarNGXMockCreateLatencyMs(
+	TEXT("r.NGX.Mock.CreateLatencyMs"), 0.0f,
+	TEXT("Time in ms the mock NGX backend spends in each DLSS feature creation, to emulate the driver side cost (default 0)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarNGXMockEvaluateLatencyMs(
+	TEXT("r.NGX.Mock.EvaluateLatencyMs"), 0.0f,
+	TEXT("Time in ms the mock NGX backend spends in each DLSS evaluation, to emulate the driver side cost (default 0)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarNGXMockFeatureMemoryBytesPerPixel(
+	TEXT("r.NGX.Mock.FeatureMemoryBytesPerPixel"), 48,
+	TEXT("Video memory the mock NGX backend reports per output pixel of each DLSS feature, which drives the r.NGX.FeaturePoolBudgetMB eviction path (default 48)\n"),
+	ECVF_RenderThreadSafe);
+
+namespace
+{
+	// memory reported through the DLSSGetStatsCallback, summed over all live mock features
+	std::atomic<uint64> MockFeatureMemoryBytes(0);
+	std::atomic<uint32> MockFeatureHandleId(0);
+
+	// busy wait instead of sleeping so the simulated SDK cost shows up on the calling thread like a real blocking driver call
+	void SimulateLatency(float InMilliseconds)
+	{
+		if (InMilliseconds <= 0.0f)
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_NGXMockSimulatedLatency);
+		const double EndTime = FPlatformTime::Seconds() + InMilliseconds / 1000.0;
+		while (FPlatformTime::Seconds() < EndTime)
+		{
+			FPlatformProcess::Yield();
+		}
+	}
+}
+
+// CPU side NVSDK_NGX_Parameter so the nvsdk_ngx_helpers and the NVSDK_NGX_Parameter_Set*/Get* entry points work unchanged.
+// Values are keyed by the CRC of the parameter name and converted on Get the same way the NGX implementation does for numeric types
+class FNGXMockParameter final : public NVSDK_NGX_Parameter
+{
+public:
+	virtual void Set(const char* InName, unsigned long long InValue) override { SetValue(InName, EValueType::Int).Int = InValue; }
+	virtual void Set(const char* InName, float InValue) override { SetValue(InName, EValueType::Float).Float = InValue; }
+	virtual void Set(const char* InName, double InValue) override { SetValue(InName, EValueType::Float).Float = InValue; }
+	virtual void Set(const char* InName, unsigned int InValue) override { SetValue(InName, EValueType::Int).Int = InValue; }
+	virtual void Set(const char* InName, int InValue) override { SetValue(InName, EValueType::Int).Int = static_cast<unsigned long long>(static_cast<long long>(InValue)); }
+	virtual void Set(const char* InName, ID3D11Resource* InValue) override { SetValue(InName, EValueType::Pointer).Pointer = InValue; }
+	virtual void Set(const char* InName, ID3D12Resource* InValue) override { SetValue(InName, EValueType::Pointer).Pointer = InValue; }
+	virtual void Set(const char* InName, void* InValue) override { SetValue(InName, EValueType::Pointer).Pointer = InValue; }
+
+	virtual NVSDK_NGX_Result Get(const char* InName, unsigned long long* OutValue) const override { return GetNumeric(InName, OutValue); }
+	virtual NVSDK_NGX_Result Get(const char* InName, float* OutValue) const override { return GetNumeric(InName, OutValue); }
+	virtual NVSDK_NGX_Result Get(const char* InName, double* OutValue) const override { return GetNumeric(InName, OutValue); }
+	virtual NVSDK_NGX_Result Get(const char* InName, unsigned int* OutValue) const override { return GetNumeric(InName, OutValue); }
+	virtual NVSDK_NGX_Result Get(const char* InName, int* OutValue) const override { return GetNumeric(InName, OutValue); }
+	virtual NVSDK_NGX_Result Get(const char* InName, ID3D11Resource** OutValue) const override { return GetPointer(InName, OutValue); }
+	virtual NVSDK_NGX_Result Get(const char* InName, ID3D12Resource** OutValue) const override { return GetPointer(InName, OutValue); }
+	virtual NVSDK_NGX_Result Get(const char* InName, void** OutValue) const override { return GetPointer(InName, OutValue); }
+
+	virtual void Reset() override
+	{
+		Values.Reset();
+	}
+
+private:
+	enum class EValueType : uint8
+	{
+		Int,
+		Float,
+		Pointer
+	};
+
+	struct FValue
+	{
+		EValueType Type = EValueType::Int;
+		union
+		{
+			unsigned long long Int;
+			double Float;
+			void* Pointer;
+		};
+	};
+
+	static uint32 GetKey(const char* InName)
+	{
+		return FCrc::StrCrc32(InName);
+	}
+
+	FValue& SetValue(const char* InName, EValueType InType)
+	{
+		FValue& Value = Values.FindOrAdd(GetKey(InName));
+		Value.Type = InType;
+		return Value;
+	}
+
+	template <typename T>
+	NVSDK_NGX_Result GetNumeric(const char* InName, T* OutValue) const
+	{
+		const FValue* Value = Values.Find(GetKey(InName));
+		if (!Value || Value->Type == EValueType::Pointer)
+		{
+			return NVSDK_NGX_Result_FAIL_UnsupportedParameter;
+		}
+		*OutValue = Value->Type == EValueType::Int ? static_cast<T>(Value->Int) : static_cast<T>(Value->Float);
+		return NVSDK_NGX_Result_Success;
+	}
+
+	template <typename T>
+	NVSDK_NGX_Result GetPointer(const char* InName, T** OutValue) const
+	{
+		const FValue* Value = Values.Find(GetKey(InName));
+		if (!Value || Value->Type != EValueType::Pointer)
+		{
+			return NVSDK_NGX_Result_FAIL_UnsupportedParameter;
+		}
+		*OutValue = static_cast<T*>(Value->Pointer);
+		return NVSDK_NGX_Result_Success;
+	}
+
+	TMap<uint32, FValue> Values;
+};
+
+static NVSDK_NGX_Result NVSDK_CONV MockDLSSGetStatsCallback(NVSDK_NGX_Parameter* InParams)
+{
+	NVSDK_NGX_Parameter_SetULL(InParams, NVSDK_NGX_Parameter_SizeInBytes, MockFeatureMemoryBytes.load());
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_EParameter_OptLevel, 0);
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_EParameter_IsDevSnippetBranch, 0);
+	return NVSDK_NGX_Result_Success;
+}
+
+static NVSDK_NGX_Result NVSDK_CONV MockDLSSOptimalSettingsCallback(NVSDK_NGX_Parameter* InParams)
+{
+	uint32 Width = 0;
+	uint32 Height = 0;
+	int32 PerfQuality = NVSDK_NGX_PerfQuality_Value_MaxQuality;
+	NVSDK_NGX_Parameter_GetUI(InParams, NVSDK_NGX_Parameter_Width, &Width);
+	NVSDK_NGX_Parameter_GetUI(InParams, NVSDK_NGX_Parameter_Height, &Height);
+	NVSDK_NGX_Parameter_GetI(InParams, NVSDK_NGX_Parameter_PerfQualityValue, &PerfQuality);
+
+	// the resolution fractions the DLSS-SR presets use by default
+	float ResolutionFraction = 0.0f;
+	switch (PerfQuality)
+	{
+		case NVSDK_NGX_PerfQuality_Value_UltraPerformance: ResolutionFraction = 1.0f / 3.0f; break;
+		case NVSDK_NGX_PerfQuality_Value_MaxPerf:          ResolutionFraction = 0.5f; break;
+		case NVSDK_NGX_PerfQuality_Value_Balanced:         ResolutionFraction = 0.58f; break;
+		case NVSDK_NGX_PerfQuality_Value_MaxQuality:       ResolutionFraction = 2.0f / 3.0f; break;
+		case NVSDK_NGX_PerfQuality_Value_DLAA:             ResolutionFraction = 1.0f; break;
+		// not offered by DLSS-SR, reported as unsupported through a zero render size
+		default: break;
+	}
+
+	const uint32 OptimalWidth = FMath::CeilToInt(Width * ResolutionFraction);
+	const uint32 OptimalHeight = FMath::CeilToInt(Height * ResolutionFraction);
+
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_Parameter_OutWidth, OptimalWidth);
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_Parameter_OutHeight, OptimalHeight);
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, ResolutionFraction > 0.0f ? Width : 0);
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, ResolutionFraction > 0.0f ? Height : 0);
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, FMath::CeilToInt(Width / 3.0f));
+	NVSDK_NGX_Parameter_SetUI(InParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, FMath::CeilToInt(Height / 3.0f));
+	NVSDK_NGX_Parameter_SetF(InParams, NVSDK_NGX_Parameter_Sharpness, 0.0f);
+	return NVSDK_NGX_Result_Success;
+}
+
+class FNGXMockDLSSFeature final : public NGXDLSSFeature
+{
+
+public:
+	FNGXMockDLSSFeature(NVSDK_NGX_Handle* InFeature, NVSDK_NGX_Parameter* InParameter, const FDLSSFeatureDesc& InFeatureDesc, uint32 InLastUsedEvaluation, uint64 InMemoryBytes)
+		: NGXDLSSFeature(InFeature, InParameter, InFeatureDesc, InLastUsedEvaluation)
+		, MemoryBytes(InMemoryBytes)
+	{
+		MockFeatureMemoryBytes += MemoryBytes;
+	}
+
+	virtual ~FNGXMockDLSSFeature()
+	{
+		check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
+		MockFeatureMemoryBytes -= MemoryBytes;
+		delete Feature;
+		delete static_cast<FNGXMockParameter*>(Parameter);
+	}
+
+private:
+	uint64 MemoryBytes = 0;
+};
+
+class FNGXMockRHI final : public NGXRHI
+{
+
+public:
+	FNGXMockRHI(const FNGXRHICreateArguments& Arguments);
+	virtual void ExecuteDLSS(FRHICommandList& CmdList, const FRHIDLSSArguments& InArguments, FDLSSStateRef InDLSSState) final;
+	virtual ~FNGXMockRHI();
+	virtual bool IsRRSupportedByRHI() const override { return true; }
+
+	// the feature pool half of ExecuteDLSS, which only needs the feature desc so it can be driven without textures
+	void AcquireFeature(const FRHIDLSSArguments& InArguments, FDLSSStateRef InDLSSState);
+
+private:
+	static void SetCreateParameters(NVSDK_NGX_Parameter* InOutParameter, const FRHIDLSSArguments& InArguments, bool bInRayReconstruction);
+	static void SetEvaluateParameters(NVSDK_NGX_Parameter* InOutParameter, const FRHIDLSSArguments& InArguments, bool bInRayReconstruction);
+};
+
+FNGXMockRHI::FNGXMockRHI(const FNGXRHICreateArguments& Arguments)
+	: NGXRHI(Arguments)
+{
+	UE_LOG(LogDLSSNGXMockRHI, Log, TEXT("Using the mock NGX backend, DLSS features are emulated on the CPU and produce no output"));
+
+	NVSDK_NGX_Parameter* CapabilityParameters = new FNGXMockParameter();
+	NVSDK_NGX_Parameter_SetI(CapabilityParameters, NVSDK_NGX_Parameter_SuperSampling_Available, 1);
+	NVSDK_NGX_Parameter_SetI(CapabilityParameters, NVSDK_NGX_EParameter_SuperSampling_Available, 1);
+	NVSDK_NGX_Parameter_SetI(CapabilityParameters, NVSDK_NGX_Parameter_SuperSampling_NeedsUpdatedDriver, 0);
+	NVSDK_NGX_Parameter_SetI(CapabilityParameters, NVSDK_NGX_Parameter_SuperSampling_FeatureInitResult, NVSDK_NGX_Result_Success);
+	NVSDK_NGX_Parameter_SetI(CapabilityParameters, NVSDK_NGX_Parameter_SuperSamplingDenoising_Available, 1);
+	NVSDK_NGX_Parameter_SetI(CapabilityParameters, NVSDK_NGX_Parameter_SuperSamplingDenoising_NeedsUpdatedDriver, 0);
+	NVSDK_NGX_Parameter_SetI(CapabilityParameters, NVSDK_NGX_Parameter_SuperSamplingDenoising_FeatureInitResult, NVSDK_NGX_Result_Success);
+	NVSDK_NGX_Parameter_SetVoidPointer(CapabilityParameters, NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback, reinterpret_cast<void*>(&MockDLSSOptimalSettingsCallback));
+	NVSDK_NGX_Parameter_SetVoidPointer(CapabilityParameters, NVSDK_NGX_Parameter_DLSSGetStatsCallback, reinterpret_cast<void*>(&MockDLSSGetStatsCallback));
+
+	NGXQueryFeature.NGXInitResult = NVSDK_NGX_Result_Success;
+	NGXQueryFeature.CapabilityParameters = CapabilityParameters;
+	bNGXInitialized = true;
+
+	NGXQueryFeature.QueryDLSSSupport();
+}
+
+FNGXMockRHI::~FNGXMockRHI()
+{
+	UE_LOG(LogDLSSNGXMockRHI, Log, TEXT("%s Enter"), ANSI_TO_TCHAR(__FUNCTION__));
+	if (bNGXInitialized)
+	{
+		ReleaseAllocatedFeatures();
+
+		delete static_cast<FNGXMockParameter*>(NGXQueryFeature.CapabilityParameters);
+		NGXQueryFeature.CapabilityParameters = nullptr;
+		bNGXInitialized = false;
+	}
+	UE_LOG(LogDLSSNGXMockRHI, Log, TEXT("%s Leave"), ANSI_TO_TCHAR(__FUNCTION__));
+}
+
+// same parameters NGX_D3D12_CREATE_DLSS_EXT / NGX_D3D12_CREATE_DLSSD_EXT write before calling into the driver
+void FNGXMockRHI::SetCreateParameters(NVSDK_NGX_Parameter* InOutParameter, const FRHIDLSSArguments& InArguments, bool bInRayReconstruction)
+{
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_CreationNodeMask, 1 << InArguments.GPUNode);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_VisibilityNodeMask, InArguments.GPUVisibility);
+
+	if (bInRayReconstruction)
+	{
+		const NVSDK_NGX_DLSSD_Create_Params CreateParams = InArguments.GetNGXDLSSRRCreateParams();
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_Width, CreateParams.InWidth);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_Height, CreateParams.InHeight);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_OutWidth, CreateParams.InTargetWidth);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_OutHeight, CreateParams.InTargetHeight);
+		NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_PerfQualityValue, CreateParams.InPerfQualityValue);
+		NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, CreateParams.InFeatureCreateFlags);
+		NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Enable_Output_Subrects, CreateParams.InEnableOutputSubrects ? 1 : 0);
+		NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Denoise_Mode, NVSDK_NGX_DLSS_Denoise_Mode_DLUnified);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Roughness_Mode, CreateParams.InRoughnessMode);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_Use_HW_Depth, CreateParams.InUseHWDepth);
+	}
+	else
+	{
+		const NVSDK_NGX_DLSS_Create_Params CreateParams = InArguments.GetNGXDLSSCreateParams();
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_Width, CreateParams.Feature.InWidth);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_Height, CreateParams.Feature.InHeight);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_OutWidth, CreateParams.Feature.InTargetWidth);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_OutHeight, CreateParams.Feature.InTargetHeight);
+		NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_PerfQualityValue, CreateParams.Feature.InPerfQualityValue);
+		NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, CreateParams.InFeatureCreateFlags);
+		NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Enable_Output_Subrects, CreateParams.InEnableOutputSubrects ? 1 : 0);
+	}
+}
+
+// mirrors the parameters the D3D12 RHI binds through GetCommonEvalParams and the NGX_D3D12_EVALUATE_DLSS(D)_EXT helpers,
+// with the RHI textures standing in for the native resources
+void FNGXMockRHI::SetEvaluateParameters(NVSDK_NGX_Parameter* InOutParameter, const FRHIDLSSArguments& InArguments, bool bInRayReconstruction)
+{
+	NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_Color, InArguments.InputColor);
+	NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_Output, InArguments.OutputColor);
+	NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_Depth, InArguments.InputDepth);
+	NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_MotionVectors, InArguments.InputMotionVectors);
+	NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_ExposureTexture, InArguments.bUseAutoExposure ? nullptr : InArguments.InputExposure);
+	NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, InArguments.bUseBiasCurrentColorMask ? InArguments.InputBiasCurrentColorMask : nullptr);
+
+	NVSDK_NGX_Parameter_SetF(InOutParameter, NVSDK_NGX_Parameter_Jitter_Offset_X, InArguments.JitterOffset.X);
+	NVSDK_NGX_Parameter_SetF(InOutParameter, NVSDK_NGX_Parameter_Jitter_Offset_Y, InArguments.JitterOffset.Y);
+	NVSDK_NGX_Parameter_SetF(InOutParameter, NVSDK_NGX_Parameter_MV_Scale_X, InArguments.MotionVectorScale.X);
+	NVSDK_NGX_Parameter_SetF(InOutParameter, NVSDK_NGX_Parameter_MV_Scale_Y, InArguments.MotionVectorScale.Y);
+	NVSDK_NGX_Parameter_SetI(InOutParameter, NVSDK_NGX_Parameter_Reset, InArguments.bReset ? 1 : 0);
+	NVSDK_NGX_Parameter_SetF(InOutParameter, NVSDK_NGX_Parameter_DLSS_Pre_Exposure, InArguments.PreExposure);
+	NVSDK_NGX_Parameter_SetF(InOutParameter, NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, InArguments.DeltaTimeMS);
+
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X, InArguments.SrcRect.Min.X);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y, InArguments.SrcRect.Min.Y);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X, InArguments.SrcRect.Min.X);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_Y, InArguments.SrcRect.Min.Y);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_X, 0);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_Y, 0);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_X, InArguments.SrcRect.Min.X);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_Y, InArguments.SrcRect.Min.Y);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_X, InArguments.DestRect.Min.X);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_Y, InArguments.DestRect.Min.Y);
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, InArguments.SrcRect.Width());
+	NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, InArguments.SrcRect.Height());
+
+	if (!bInRayReconstruction)
+	{
+		NVSDK_NGX_Parameter_SetF(InOutParameter, NVSDK_NGX_Parameter_Sharpness, InArguments.Sharpness);
+	}
+	else
+	{
+		NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_DiffuseAlbedo, InArguments.InputDiffuseAlbedo);
+		NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_SpecularAlbedo, InArguments.InputSpecularAlbedo);
+		NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_GBuffer_Normals, InArguments.InputNormals);
+		NVSDK_NGX_Parameter_SetVoidPointer(InOutParameter, NVSDK_NGX_Parameter_GBuffer_Roughness, InArguments.InputRoughness);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_DiffuseAlbedo_Subrect_Base_X, 0);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_DiffuseAlbedo_Subrect_Base_Y, 0);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_SpecularAlbedo_Subrect_Base_X, 0);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_SpecularAlbedo_Subrect_Base_Y, 0);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Normals_Subrect_Base_X, 0);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Normals_Subrect_Base_Y, 0);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Roughness_Subrect_Base_X, 0);
+		NVSDK_NGX_Parameter_SetUI(InOutParameter, NVSDK_NGX_Parameter_DLSS_Input_Roughness_Subrect_Base_Y, 0);
+	}
+}
+
+void FNGXMockRHI::ExecuteDLSS(FRHICommandList& CmdList, const FRHIDLSSArguments& InArguments, FDLSSStateRef InDLSSState)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NGXMockExecuteDLSS);
+	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
+	check(IsDLSSAvailable());
+	if (!IsDLSSAvailable()) return;
+
+	InArguments.Validate();
+
+	AcquireFeature(InArguments, InDLSSState);
+
+	SetEvaluateParameters(InDLSSState->DLSSFeature->Parameter, InArguments, InDLSSState->DLSSFeature->bHasDLSSRR);
+	SimulateLatency(CVarNGXMockEvaluateLatencyMs.GetValueOnAnyThread());
+	INC_DWORD_STAT(STAT_NGXMockFeatureEvaluations);
+}
+
+void FNGXMockRHI::AcquireFeature(const FRHIDLSSArguments& InArguments, FDLSSStateRef InDLSSState)
+{
+	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
+
+	if (InDLSSState->RequiresFeatureRecreation(InArguments))
+	{
+		check(!InDLSSState->DLSSFeature || InDLSSState->HasValidFeature());
+		InDLSSState->DLSSFeature = nullptr;
+	}
+
+	if (InArguments.bReset)
+	{
+		check(!InDLSSState->DLSSFeature);
+		InDLSSState->DLSSFeature = FindFreeFeature(InArguments);
+	}
+
+	if (!InDLSSState->DLSSFeature)
+	{
+		NVSDK_NGX_Parameter* NewNGXParameterHandle = new FNGXMockParameter();
+
+		ApplyCommonNGXParameterSettings(NewNGXParameterHandle, InArguments);
+
+		static_assert (int(ENGXDLSSDenoiserMode::MaxValue) == 1, "dear DLSS plugin NVIDIA developer, please update this code to handle the new ENGXDLSSDenoiserMode enum values");
+		const bool bRayReconstruction = IsDLSSRRAvailable() && InArguments.DenoiserMode == ENGXDLSSDenoiserMode::DLSSRR;
+		SetCreateParameters(NewNGXParameterHandle, InArguments, bRayReconstruction);
+
+		SimulateLatency(CVarNGXMockCreateLatencyMs.GetValueOnAnyThread());
+
+		NVSDK_NGX_Handle* NewNGXFeatureHandle = new NVSDK_NGX_Handle{ ++MockFeatureHandleId };
+		const uint64 MemoryBytes = uint64(InArguments.DestRect.Area()) * FMath::Max(CVarNGXMockFeatureMemoryBytesPerPixel.GetValueOnAnyThread(), 0);
+
+		InDLSSState->DLSSFeature = MakeShared<FNGXMockDLSSFeature>(NewNGXFeatureHandle, NewNGXParameterHandle, InArguments.GetFeatureDesc(), FrameCounter, MemoryBytes);
+		InDLSSState->DLSSFeature->bHasDLSSRR = bRayReconstruction;
+		INC_DWORD_STAT(STAT_NGXMockFeatureCreates);
+
+		RegisterFeature(InDLSSState->DLSSFeature);
+	}
+
+	check(InDLSSState->HasValidFeature());
+
+	InDLSSState->DLSSFeature->Tick(FrameCounter);
+}
+
+/** IModuleInterface implementation */
+
+void FNGXMockRHIModule::StartupModule()
+{
+	// NGXRHI module should be loaded to ensure logging state is initialized
+	FModuleManager::LoadModuleChecked<INGXRHIModule>(TEXT("NGXRHI"));
+}
+
+void FNGXMockRHIModule::ShutdownModule()
+{
+}
+
+TUniquePtr<NGXRHI> FNGXMockRHIModule::CreateNGXRHI(const FNGXRHICreateArguments& Arguments)
+{
+	// the OTA update would reach out to the driver, which the mock is meant to stay clear of
+	FNGXRHICreateArguments MockArguments = Arguments;
+	MockArguments.bAllowOTAUpdate = false;
+
+	TUniquePtr<NGXRHI> Result(new FNGXMockRHI(MockArguments));
+	return Result;
+}
+
+IMPLEMENT_MODULE(FNGXMockRHIModule, NGXMockRHI)
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// the parameter block has to behave like the NGX one for the stock nvsdk_ngx_helpers to work through it
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNGXMockParameterTest, "DLSS.NGXMock.Parameters", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FNGXMockParameterTest::RunTest(const FString& Parameters)
+{
+	FNGXMockParameter Parameter;
+	NVSDK_NGX_Parameter_SetVoidPointer(&Parameter, NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback, reinterpret_cast<void*>(&MockDLSSOptimalSettingsCallback));
+	NVSDK_NGX_Parameter_SetVoidPointer(&Parameter, NVSDK_NGX_Parameter_DLSSGetStatsCallback, reinterpret_cast<void*>(&MockDLSSGetStatsCallback));
+
+	unsigned int OptimalWidth = 0, OptimalHeight = 0, MaxWidth = 0, MaxHeight = 0, MinWidth = 0, MinHeight = 0;
+	float Sharpness = 0.0f;
+	TestEqual(TEXT("Optimal settings result"), int32(NGX_DLSS_GET_OPTIMAL_SETTINGS(&Parameter, 1920, 1080, NVSDK_NGX_PerfQuality_Value_MaxQuality, &OptimalWidth, &OptimalHeight, &MaxWidth, &MaxHeight, &MinWidth, &MinHeight, &Sharpness)), int32(NVSDK_NGX_Result_Success));
+	TestEqual(TEXT("Quality render width"), int32(OptimalWidth), 1280);
+	TestEqual(TEXT("Quality render height"), int32(OptimalHeight), 720);
+	TestEqual(TEXT("Max render width"), int32(MaxWidth), 1920);
+	TestEqual(TEXT("Min render height"), int32(MinHeight), 360);
+
+	NGX_DLSS_GET_OPTIMAL_SETTINGS(&Parameter, 1920, 1080, NVSDK_NGX_PerfQuality_Value_UltraQuality, &OptimalWidth, &OptimalHeight, &MaxWidth, &MaxHeight, &MinWidth, &MinHeight, &Sharpness);
+	TestEqual(TEXT("Unsupported quality mode reports a zero render size"), int32(OptimalWidth), 0);
+
+	const uint64 LiveFeatureMemory = MockFeatureMemoryBytes.load();
+	unsigned long long VRAMAllocatedBytes = 0;
+	TestEqual(TEXT("Stats result"), int32(NGX_DLSS_GET_STATS(&Parameter, &VRAMAllocatedBytes)), int32(NVSDK_NGX_Result_Success));
+	TestEqual(TEXT("Stats report the live feature memory"), uint64(VRAMAllocatedBytes), LiveFeatureMemory);
+
+	// numeric values convert on Get like NGX does, pointers and missing names fail
+	float FloatValue = 0.0f;
+	int IntValue = 0;
+	void* PointerValue = nullptr;
+	NVSDK_NGX_Parameter_SetUI(&Parameter, NVSDK_NGX_Parameter_Width, 1920);
+	NVSDK_NGX_Parameter_SetI(&Parameter, NVSDK_NGX_Parameter_Reset, -1);
+	TestEqual(TEXT("Int reads back as float"), int32(NVSDK_NGX_Parameter_GetF(&Parameter, NVSDK_NGX_Parameter_Width, &FloatValue)), int32(NVSDK_NGX_Result_Success));
+	TestEqual(TEXT("Int converted to float"), FloatValue, 1920.0f);
+	NVSDK_NGX_Parameter_GetI(&Parameter, NVSDK_NGX_Parameter_Reset, &IntValue);
+	TestEqual(TEXT("Negative int round trips"), IntValue, -1);
+	TestEqual(TEXT("Numeric value read as pointer"), int32(NVSDK_NGX_Parameter_GetVoidPointer(&Parameter, NVSDK_NGX_Parameter_Width, &PointerValue)), int32(NVSDK_NGX_Result_FAIL_UnsupportedParameter));
+	TestEqual(TEXT("Missing parameter"), int32(NVSDK_NGX_Parameter_GetI(&Parameter, NVSDK_NGX_Parameter_CreationNodeMask, &IntValue)), int32(NVSDK_NGX_Result_FAIL_UnsupportedParameter));
+
+	return true;
+}
+
+// views opening, closing and resizing against a mock NGXRHI, checking which requests the feature pool serves, which create a
+// feature and which unused features get destroyed by age and by r.NGX.FeaturePoolBudgetMB
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNGXMockFeaturePoolViewChurnTest, "DLSS.NGXMock.FeaturePoolViewChurn", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FNGXMockFeaturePoolViewChurnTest::RunTest(const FString& Parameters)
+{
+	// NGXRHI keeps its initialization state in a static, a second instance would tear it down under the live one
+	if (NGXRHI::NGXInitialized())
+	{
+		AddWarning(TEXT("Skipped, NGX is already initialized in this process"));
+		return true;
+	}
+
+	static constexpr int32 NumChurnViews = 6;
+	static constexpr uint64 BytesPerPixel = 48;
+
+	IConsoleManager& ConsoleManager = IConsoleManager::Get();
+	IConsoleVariable* FramesUntilFeatureDestruction = ConsoleManager.FindConsoleVariable(TEXT("r.NGX.FramesUntilFeatureDestruction"));
+	IConsoleVariable* FeaturePoolBudgetMB = ConsoleManager.FindConsoleVariable(TEXT("r.NGX.FeaturePoolBudgetMB"));
+	IConsoleVariable* VRAMSampleInterval = ConsoleManager.FindConsoleVariable(TEXT("r.NGX.VRAMSampleInterval"));
+	IConsoleVariable* MockBytesPerPixel = ConsoleManager.FindConsoleVariable(TEXT("r.NGX.Mock.FeatureMemoryBytesPerPixel"));
+	const int32 SavedFramesUntilFeatureDestruction = FramesUntilFeatureDestruction->GetInt();
+	const int32 SavedFeaturePoolBudgetMB = FeaturePoolBudgetMB->GetInt();
+	const int32 SavedVRAMSampleInterval = VRAMSampleInterval->GetInt();
+	const int32 SavedMockBytesPerPixel = MockBytesPerPixel->GetInt();
+
+	FramesUntilFeatureDestruction->Set(3, ECVF_SetByCode);
+	FeaturePoolBudgetMB->Set(0, ECVF_SetByCode);
+	VRAMSampleInterval->Set(1, ECVF_SetByCode);
+	MockBytesPerPixel->Set(int32(BytesPerPixel), ECVF_SetByCode);
+
+	// the pool belongs to the RHI thread, each step runs there while the console variables only change in between
+	auto RunOnRHIThread = [](TFunctionRef<void()> InStep)
+	{
+		ENQUEUE_RENDER_COMMAND(NGXMockFeaturePoolViewChurnTest)([InStep](FRHICommandListImmediate& RHICmdList)
+		{
+			RHICmdList.EnqueueLambda([InStep](FRHICommandListImmediate&) { InStep(); });
+			RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThread);
+		});
+		FlushRenderingCommands();
+	};
+
+	auto MakeArguments = [](FIntPoint InOutputSize, bool bInReset)
+	{
+		FRHIDLSSArguments Arguments;
+		Arguments.DestRect = FIntRect(FIntPoint::ZeroValue, InOutputSize);
+		Arguments.SrcRect = FIntRect(FIntPoint::ZeroValue, InOutputSize * 2 / 3);
+		Arguments.PerfQuality = NVSDK_NGX_PerfQuality_Value_MaxQuality;
+		Arguments.bReset = bInReset;
+		return Arguments;
+	};
+
+	const FIntPoint ViewSize(1920, 1080);
+	const FIntPoint ResizedViewSize(2560, 1440);
+	auto ChurnViewSize = [](int32 InIndex) { return FIntPoint(1280 + 64 * InIndex, 720); };
+
+	TUniquePtr<FNGXMockRHI> Mock;
+	TArray<FDLSSStateRef> Views;
+	TArray<NGXDLSSFeature*> ViewFeatures;
+	NGXRHI::FFeaturePoolCounters AfterResize, AfterBudget, AfterReacquire;
+	int32 NumFeaturesAfterChurn = 0;
+	uint64 InUseBytes = 0;
+	uint64 BytesAfterBudget = 0;
+	bool bSameFeaturesAfterBudget = true;
+
+	RunOnRHIThread([&]()
+	{
+		FIntPoint FirstViewSize = ViewSize;
+		FNGXRHICreateArguments CreateArguments;
+		CreateArguments.bAllowOTAUpdate = false;
+		Mock.Reset(new FNGXMockRHI(CreateArguments));
+
+		auto RenderViews = [&](int32 InNumFrames)
+		{
+			for (int32 Frame = 0; Frame < InNumFrames; ++Frame)
+			{
+				for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+				{
+					Mock->AcquireFeature(MakeArguments(ViewIndex == 0 ? FirstViewSize : ViewSize, false), Views[ViewIndex]);
+				}
+				Mock->TickPoolElements();
+			}
+		};
+
+		// four views open, then two close and two others take over their features
+		for (int32 ViewIndex = 0; ViewIndex < 4; ++ViewIndex)
+		{
+			Views.Add(MakeShared<FDLSSState, ESPMode::ThreadSafe>());
+			Mock->AcquireFeature(MakeArguments(ViewSize, true), Views.Last());
+		}
+		Mock->TickPoolElements();
+		for (int32 ViewIndex = 2; ViewIndex < 4; ++ViewIndex)
+		{
+			Views[ViewIndex] = MakeShared<FDLSSState, ESPMode::ThreadSafe>();
+			Mock->AcquireFeature(MakeArguments(ViewSize, true), Views[ViewIndex]);
+		}
+		RenderViews(10);
+
+		// a resize leaves the old feature unused until it is older than r.NGX.FramesUntilFeatureDestruction
+		FirstViewSize = ResizedViewSize;
+		Mock->AcquireFeature(MakeArguments(FirstViewSize, true), Views[0]);
+		RenderViews(5);
+		AfterResize = Mock->GetFeaturePoolCounters();
+		InUseBytes = MockFeatureMemoryBytes.load();
+
+		for (const FDLSSStateRef& View : Views)
+		{
+			ViewFeatures.Add(View->DLSSFeature.Get());
+		}
+	});
+
+	// from here on only the budget destroys features
+	FramesUntilFeatureDestruction->Set(1000000, ECVF_SetByCode);
+
+	RunOnRHIThread([&]()
+	{
+		// short lived views that each need their own size, such as scene captures or editor thumbnails, one per frame
+		for (int32 ChurnIndex = 0; ChurnIndex < NumChurnViews; ++ChurnIndex)
+		{
+			FDLSSStateRef ChurnView = MakeShared<FDLSSState, ESPMode::ThreadSafe>();
+			Mock->AcquireFeature(MakeArguments(ChurnViewSize(ChurnIndex), true), ChurnView);
+			ChurnView.Reset();
+
+			for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+			{
+				Mock->AcquireFeature(MakeArguments(ViewIndex == 0 ? ResizedViewSize : ViewSize, false), Views[ViewIndex]);
+			}
+			Mock->TickPoolElements();
+		}
+		NumFeaturesAfterChurn = Mock->GetNumAllocatedFeatures();
+	});
+
+	// room for the views in use and about the two most recent churn views
+	uint64 ChurnBytes[NumChurnViews];
+	for (int32 ChurnIndex = 0; ChurnIndex < NumChurnViews; ++ChurnIndex)
+	{
+		ChurnBytes[ChurnIndex] = uint64(ChurnViewSize(ChurnIndex).X) * ChurnViewSize(ChurnIndex).Y * BytesPerPixel;
+	}
+	const uint64 BudgetBytes = (InUseBytes + ChurnBytes[NumChurnViews - 2] + ChurnBytes[NumChurnViews - 1]) / (1024 * 1024) * (1024 * 1024);
+	FeaturePoolBudgetMB->Set(int32(BudgetBytes / (1024 * 1024)), ECVF_SetByCode);
+
+	RunOnRHIThread([&]()
+	{
+		// the pool only learns the total from NGX, so it can take a few frames to get back within the budget
+		for (int32 Frame = 0; Frame < 8 && MockFeatureMemoryBytes.load() > BudgetBytes; ++Frame)
+		{
+			for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+			{
+				Mock->AcquireFeature(MakeArguments(ViewIndex == 0 ? ResizedViewSize : ViewSize, false), Views[ViewIndex]);
+			}
+			Mock->TickPoolElements();
+		}
+		AfterBudget = Mock->GetFeaturePoolCounters();
+		BytesAfterBudget = MockFeatureMemoryBytes.load();
+		for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+		{
+			bSameFeaturesAfterBudget &= Views[ViewIndex]->DLSSFeature.Get() == ViewFeatures[ViewIndex];
+		}
+
+		// least recently used first, so the newest churn feature is still there and the oldest is gone
+		FDLSSStateRef NewestAgain = MakeShared<FDLSSState, ESPMode::ThreadSafe>();
+		Mock->AcquireFeature(MakeArguments(ChurnViewSize(NumChurnViews - 1), true), NewestAgain);
+		FDLSSStateRef OldestAgain = MakeShared<FDLSSState, ESPMode::ThreadSafe>();
+		Mock->AcquireFeature(MakeArguments(ChurnViewSize(0), true), OldestAgain);
+		AfterReacquire = Mock->GetFeaturePoolCounters();
+
+		NewestAgain.Reset();
+		OldestAgain.Reset();
+		Views.Empty();
+		Mock.Reset();
+	});
+
+	FramesUntilFeatureDestruction->Set(SavedFramesUntilFeatureDestruction, ECVF_SetByCode);
+	FeaturePoolBudgetMB->Set(SavedFeaturePoolBudgetMB, ECVF_SetByCode);
+	VRAMSampleInterval->Set(SavedVRAMSampleInterval, ECVF_SetByCode);
+	MockBytesPerPixel->Set(SavedMockBytesPerPixel, ECVF_SetByCode);
+
+	AddInfo(FString::Printf(TEXT("Budget %llu MB: %llu MB after the churn settled, %llu MB in use by the views"), BudgetBytes >> 20, BytesAfterBudget >> 20, InUseBytes >> 20));
+
+	TestEqual(TEXT("Reopened views reuse the features of the closed ones"), AfterResize.NumHits, 2u);
+	TestEqual(TEXT("Four views and a resize create five features"), AfterResize.NumCreates, 5u);
+	TestEqual(TEXT("The feature left behind by the resize is destroyed by age"), AfterResize.NumEvictions, 1u);
+
+	TestEqual(TEXT("Every churn view creates a feature"), AfterBudget.NumCreates, 5u + NumChurnViews);
+	TestEqual(TEXT("Churn features are kept while within the frame limit"), NumFeaturesAfterChurn, 4 + NumChurnViews);
+	TestEqual(TEXT("Going over budget destroys all but the most recent churn feature"), AfterBudget.NumEvictions, AfterResize.NumEvictions + NumChurnViews - 1);
+	TestTrue(TEXT("Feature memory is back within the budget"), BytesAfterBudget <= BudgetBytes);
+	TestTrue(TEXT("Features in use are never destroyed"), bSameFeaturesAfterBudget);
+
+	TestEqual(TEXT("The most recently used churn feature survives the budget"), AfterReacquire.NumHits, AfterBudget.NumHits + 1);
+	TestEqual(TEXT("The least recently used churn feature is destroyed first"), AfterReacquire.NumCreates, AfterBudget.NumCreates + 1);
+
+	return true;
+}
+
+// cost of the parameter traffic the plugin generates per DLSS evaluation: the quality mode and stats queries plus the
+// evaluate parameters the D3D12 RHI binds, so changes to the parameter block can be compared without an NVIDIA GPU
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNGXMockParameterBenchmark, "DLSS.NGXMock.ParameterBenchmark", EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNGXMockParameterBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumIterations = 100000;
+
+	FNGXMockParameter CapabilityParameter;
+	NVSDK_NGX_Parameter_SetVoidPointer(&CapabilityParameter, NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback, reinterpret_cast<void*>(&MockDLSSOptimalSettingsCallback));
+	NVSDK_NGX_Parameter_SetVoidPointer(&CapabilityParameter, NVSDK_NGX_Parameter_DLSSGetStatsCallback, reinterpret_cast<void*>(&MockDLSSGetStatsCallback));
+	FNGXMockParameter FeatureParameter;
+
+	uint64 Checksum = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		unsigned int OptimalWidth = 0, OptimalHeight = 0, MaxWidth = 0, MaxHeight = 0, MinWidth = 0, MinHeight = 0;
+		float Sharpness = 0.0f;
+		NGX_DLSS_GET_OPTIMAL_SETTINGS(&CapabilityParameter, 3840, 2160, NVSDK_NGX_PerfQuality_Value_Balanced, &OptimalWidth, &OptimalHeight, &MaxWidth, &MaxHeight, &MinWidth, &MinHeight, &Sharpness);
+
+		unsigned long long VRAMAllocatedBytes = 0;
+		NGX_DLSS_GET_STATS(&CapabilityParameter, &VRAMAllocatedBytes);
+
+		NVSDK_NGX_Parameter_SetF(&FeatureParameter, NVSDK_NGX_Parameter_Jitter_Offset_X, float(Iteration & 7) / 8.0f);
+		NVSDK_NGX_Parameter_SetF(&FeatureParameter, NVSDK_NGX_Parameter_Jitter_Offset_Y, float(Iteration & 3) / 4.0f);
+		NVSDK_NGX_Parameter_SetI(&FeatureParameter, NVSDK_NGX_Parameter_Reset, 0);
+		NVSDK_NGX_Parameter_SetUI(&FeatureParameter, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, OptimalWidth);
+		NVSDK_NGX_Parameter_SetUI(&FeatureParameter, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, OptimalHeight);
+
+		unsigned int RenderWidth = 0;
+		NVSDK_NGX_Parameter_GetUI(&FeatureParameter, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, &RenderWidth);
+		Checksum += RenderWidth + VRAMAllocatedBytes;
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d iterations in %.2f ms, %.3f us per evaluation (checksum %llu)"), NumIterations, ElapsedSeconds * 1000.0, ElapsedSeconds * 1000000.0 / NumIterations, Checksum));
+	return TestTrue(TEXT("Render width stayed at the balanced preset"), Checksum >= uint64(NumIterations) * 2227);
+}
+
+#endif
+
+#undef LOCTEXT_NAMESPACE
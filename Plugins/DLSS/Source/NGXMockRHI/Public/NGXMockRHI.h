@@ -0,0 +1,30 @@
+/*
+* Copyright (c) 2020 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+#include "NGXRHI.h"
+
+// Stand-in for the API specific NGXRHIs that doesn't call into the NGX driver, selected with -ngxmock.
+// Features and parameters are emulated on the CPU with configurable latency and memory cost, so the plugin side
+// of DLSS (feature pooling, parameter setup, resource binding) can be profiled on machines without an NVIDIA GPU.
+class FNGXMockRHIModule final : public INGXRHIModule
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule();
+	virtual void ShutdownModule();
+
+	/** INGXRHIModule implementation */
+
+	virtual TUniquePtr<NGXRHI> CreateNGXRHI(const FNGXRHICreateArguments& Arguments);
+};
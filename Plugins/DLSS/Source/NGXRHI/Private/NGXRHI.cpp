@@ -29,6 +29,9 @@ DEFINE_LOG_CATEGORY_STATIC(LogDLSSNGXRHI, Log, All);
 DECLARE_STATS_GROUP(TEXT("DLSS"), STATGROUP_DLSS, STATCAT_Advanced);
 DECLARE_MEMORY_STAT_POOL(TEXT("DLSS: Video memory"), STAT_DLSSInternalGPUMemory, STATGROUP_DLSS, FPlatformMemory::MCR_GPU);
 DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS: Num DLSS features"), STAT_DLSSNumFeatures, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS: Feature pool hits"), STAT_DLSSFeaturePoolHits, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS: Feature pool creates"), STAT_DLSSFeaturePoolCreates, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS: Feature pool evictions"), STAT_DLSSFeaturePoolEvictions, STATGROUP_DLSS);
 
 #define LOCTEXT_NAMESPACE "NGXRHI"
 
@@ -46,6 +49,17 @@ static TAutoConsoleVariable<int32> CVarNGXFramesUntilFeatureDestruction(
 	TEXT("Number of frames until an unused NGX feature gets destroyed. (default=3)"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarNGXFeaturePoolBudgetMB(
+	TEXT("r.NGX.FeaturePoolBudgetMB"), 0,
+	TEXT("Video memory budget in MB for NGX DLSS features. When the sampled DLSS video memory exceeds this, unused features are destroyed least recently used first, even before r.NGX.FramesUntilFeatureDestruction has elapsed.\n")
+	TEXT("0: no budget (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarNGXVRAMSampleInterval(
+	TEXT("r.NGX.VRAMSampleInterval"), 30,
+	TEXT("Number of frames between queries of the DLSS video memory usage for the stats and r.NGX.FeaturePoolBudgetMB. (default=30)"),
+	ECVF_RenderThreadSafe);
+
 static TAutoConsoleVariable<int32> CVarNGXRenameLogSeverities(
 	TEXT("r.NGX.RenameNGXLogSeverities"), 1,
 	TEXT("Renames 'error' and 'warning' in messages returned by the NGX log callback to 'e_rror' and 'w_arning' before passing them to the UE log system\n")
@@ -611,27 +625,32 @@ void NGXRHI::RegisterFeature(TSharedPtr<NGXDLSSFeature> InFeature)
 { 
 	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
 	UE_LOG(LogDLSSNGXRHI, Log, TEXT("Creating   NGX DLSS Feature  %s "), *InFeature->Desc.GetDebugDescription());
-	AllocatedDLSSFeatures.Add(InFeature);
+	AllocatedDLSSFeatures.FindOrAdd(InFeature->Desc).Add(InFeature);
+	++NumAllocatedDLSSFeatures;
+	++FeaturePoolCounters.NumCreates;
+	INC_DWORD_STAT(STAT_DLSSFeaturePoolCreates);
+	SET_DWORD_STAT(STAT_DLSSNumFeatures, NumAllocatedDLSSFeatures);
 }
 
 TSharedPtr<NGXDLSSFeature> NGXRHI::FindFreeFeature(const FRHIDLSSArguments& InArguments)
 {
 	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
 	TSharedPtr<NGXDLSSFeature> OutFeature;
-	for (int FeatureIndex = 0; FeatureIndex < AllocatedDLSSFeatures.Num(); ++FeatureIndex)
+	if (FDLSSFeatureBucket* Bucket = AllocatedDLSSFeatures.Find(InArguments.GetFeatureDesc()))
 	{
-		// another view already uses this (1 reference from AllocatedDLSSFeatures, another refernces held by FDLSState
-		if (AllocatedDLSSFeatures[FeatureIndex].GetSharedReferenceCount() > 1)
+		for (TSharedPtr<NGXDLSSFeature>& Feature : *Bucket)
 		{
-			continue;
-		}
+			// another view already uses this (1 reference from AllocatedDLSSFeatures, another refernces held by FDLSState
+			if (Feature.GetSharedReferenceCount() > 1)
+			{
+				continue;
+			}
 
-		if (AllocatedDLSSFeatures[FeatureIndex]->Desc == InArguments.GetFeatureDesc())
-		{
-			OutFeature = AllocatedDLSSFeatures[FeatureIndex];
+			OutFeature = Feature;
 			OutFeature->LastUsedFrame = FrameCounter;
+			++FeaturePoolCounters.NumHits;
+			INC_DWORD_STAT(STAT_DLSSFeaturePoolHits);
 			break;
-
 		}
 	}
 	return OutFeature;
@@ -642,13 +661,17 @@ void NGXRHI::ReleaseAllocatedFeatures()
 	UE_LOG(LogDLSSNGXRHI, Log, TEXT("%s Enter"), ANSI_TO_TCHAR(__FUNCTION__));
 	
 	// There should be no FDLSSState::DLSSFeature anymore when we shut down
-	for (int FeatureIndex = 0; FeatureIndex < AllocatedDLSSFeatures.Num(); ++FeatureIndex)
+	for (const TPair<FDLSSFeatureDesc, FDLSSFeatureBucket>& Bucket : AllocatedDLSSFeatures)
 	{
-		checkf(AllocatedDLSSFeatures[FeatureIndex].GetSharedReferenceCount() == 1,TEXT("There should be no FDLSSState::DLSSFeature references elsewhere."));
+		for (const TSharedPtr<NGXDLSSFeature>& Feature : Bucket.Value)
+		{
+			checkf(Feature.GetSharedReferenceCount() == 1,TEXT("There should be no FDLSSState::DLSSFeature references elsewhere."));
+		}
 	}
 
 	AllocatedDLSSFeatures.Empty();
-	SET_DWORD_STAT(STAT_DLSSNumFeatures, AllocatedDLSSFeatures.Num());
+	NumAllocatedDLSSFeatures = 0;
+	SET_DWORD_STAT(STAT_DLSSNumFeatures, NumAllocatedDLSSFeatures);
 	UE_LOG(LogDLSSNGXRHI, Log, TEXT("%s Leave"), ANSI_TO_TCHAR(__FUNCTION__));
 }
 
@@ -681,42 +704,134 @@ void NGXRHI::TickPoolElements()
 	check(!IsRunningRHIInSeparateThread() || IsInRHIThread());
 	const uint32 kFramesUntilRelease = CVarNGXFramesUntilFeatureDestruction.GetValueOnAnyThread();
 
-	int32 FeatureIndex = 0;
-
-	while (FeatureIndex < AllocatedDLSSFeatures.Num())
+	for (auto BucketIt = AllocatedDLSSFeatures.CreateIterator(); BucketIt; ++BucketIt)
 	{
-		TSharedPtr<NGXDLSSFeature>& Feature = AllocatedDLSSFeatures[FeatureIndex];
+		FDLSSFeatureBucket& Bucket = BucketIt.Value();
+		int32 FeatureIndex = 0;
 
-		const bool bIsUnused = Feature.GetSharedReferenceCount() == 1;
-		const bool bNotRequestedRecently = (FrameCounter - Feature->LastUsedFrame) > kFramesUntilRelease;
+		while (FeatureIndex < Bucket.Num())
+		{
+			TSharedPtr<NGXDLSSFeature>& Feature = Bucket[FeatureIndex];
+
+			const bool bIsUnused = Feature.GetSharedReferenceCount() == 1;
+			const bool bNotRequestedRecently = (FrameCounter - Feature->LastUsedFrame) > kFramesUntilRelease;
+
+			if (bIsUnused && bNotRequestedRecently)
+			{
+				Bucket.RemoveAtSwap(FeatureIndex);
+				--NumAllocatedDLSSFeatures;
+				++FeaturePoolCounters.NumEvictions;
+				INC_DWORD_STAT(STAT_DLSSFeaturePoolEvictions);
+			}
+			else
+			{
+				++FeatureIndex;
+			}
+		}
 
-		if (bIsUnused && bNotRequestedRecently)
+		if (Bucket.Num() == 0)
 		{
-			Swap(Feature, AllocatedDLSSFeatures.Last());
-			AllocatedDLSSFeatures.Pop();
+			BucketIt.RemoveCurrent();
 		}
-		else
+	}
+
+	// NGX_DLSS_GET_STATS goes through the driver so only sample it every few frames
+	const uint32 VRAMSampleInterval = FMath::Max(CVarNGXVRAMSampleInterval.GetValueOnAnyThread(), 1);
+	if ((FrameCounter - LastVRAMSampleFrame) >= VRAMSampleInterval)
+	{
+		LastVRAMSampleFrame = FrameCounter;
+
+		uint64 VRAM = 0;
+		if (QueryDLSSVideoMemory(VRAM))
 		{
-			++FeatureIndex;
+			const uint64 BudgetBytes = uint64(FMath::Max(CVarNGXFeaturePoolBudgetMB.GetValueOnAnyThread(), 0)) * 1024 * 1024;
+			if (BudgetBytes != 0 && VRAM > BudgetBytes)
+			{
+				EvictFeaturesOverBudget(BudgetBytes, VRAM);
+			}
 		}
 	}
 
-	SET_DWORD_STAT(STAT_DLSSNumFeatures, AllocatedDLSSFeatures.Num());
-	
-	if(NGXQueryFeature.CapabilityParameters)
+	SET_DWORD_STAT(STAT_DLSSNumFeatures, NumAllocatedDLSSFeatures);
+
+	++FrameCounter;
+}
+
+bool NGXRHI::QueryDLSSVideoMemory(uint64& OutVRAM) const
+{
+	if (!NGXQueryFeature.CapabilityParameters)
 	{
-		unsigned long long VRAM = 0;
+		return false;
+	}
+
+	unsigned long long VRAM = 0;
 
-		NVSDK_NGX_Result ResultGetStats = NGX_DLSS_GET_STATS(NGXQueryFeature.CapabilityParameters, &VRAM);
+	NVSDK_NGX_Result ResultGetStats = NGX_DLSS_GET_STATS(NGXQueryFeature.CapabilityParameters, &VRAM);
 
-		checkf(NVSDK_NGX_SUCCEED(ResultGetStats), TEXT("Failed to retrieve DLSS memory statistics via NGX_DLSS_GET_STATS -> (%u %s)"), ResultGetStats, GetNGXResultAsString(ResultGetStats));
-		if (NVSDK_NGX_SUCCEED(ResultGetStats))
+	checkf(NVSDK_NGX_SUCCEED(ResultGetStats), TEXT("Failed to retrieve DLSS memory statistics via NGX_DLSS_GET_STATS -> (%u %s)"), ResultGetStats, GetNGXResultAsString(ResultGetStats));
+	if (NVSDK_NGX_SUCCEED(ResultGetStats))
+	{
+		SET_DWORD_STAT(STAT_DLSSInternalGPUMemory, VRAM);
+		OutVRAM = VRAM;
+		return true;
+	}
+	return false;
+}
+
+void NGXRHI::EvictFeaturesOverBudget(uint64 InBudgetBytes, uint64 InVRAM)
+{
+	// NGX only reports the total, so assume every feature takes the average share and destroy enough of the least recently used unused ones in one go
+	const uint64 AverageFeatureBytes = FMath::Max<uint64>(InVRAM / FMath::Max(NumAllocatedDLSSFeatures, 1), 1);
+	uint64 BytesToFree = InVRAM - InBudgetBytes;
+
+	TArray<TPair<uint32, FDLSSFeatureDesc>, TInlineAllocator<8>> Candidates;
+	for (const TPair<FDLSSFeatureDesc, FDLSSFeatureBucket>& Bucket : AllocatedDLSSFeatures)
+	{
+		for (const TSharedPtr<NGXDLSSFeature>& Feature : Bucket.Value)
 		{
-			SET_DWORD_STAT(STAT_DLSSInternalGPUMemory, VRAM);
+			if (Feature.GetSharedReferenceCount() == 1)
+			{
+				Candidates.Emplace(Feature->LastUsedFrame, Bucket.Key);
+			}
 		}
 	}
 
-	++FrameCounter;
+	if (Candidates.Num() == 0)
+	{
+		return;
+	}
+
+	Candidates.Sort([](const TPair<uint32, FDLSSFeatureDesc>& A, const TPair<uint32, FDLSSFeatureDesc>& B) { return A.Key < B.Key; });
+
+	for (const TPair<uint32, FDLSSFeatureDesc>& Candidate : Candidates)
+	{
+		FDLSSFeatureBucket& Bucket = AllocatedDLSSFeatures.FindChecked(Candidate.Value);
+		const int32 FeatureIndex = Bucket.IndexOfByPredicate([&Candidate](const TSharedPtr<NGXDLSSFeature>& Feature)
+		{
+			return Feature.GetSharedReferenceCount() == 1 && Feature->LastUsedFrame == Candidate.Key;
+		});
+		check(FeatureIndex != INDEX_NONE);
+
+		UE_LOG(LogDLSSNGXRHI, Log, TEXT("Evicting NGX DLSS Feature %s to stay within r.NGX.FeaturePoolBudgetMB"), *Bucket[FeatureIndex]->Desc.GetDebugDescription());
+		Bucket.RemoveAtSwap(FeatureIndex);
+		if (Bucket.Num() == 0)
+		{
+			AllocatedDLSSFeatures.Remove(Candidate.Value);
+		}
+		--NumAllocatedDLSSFeatures;
+		++FeaturePoolCounters.NumEvictions;
+		INC_DWORD_STAT(STAT_DLSSFeaturePoolEvictions);
+
+		if (BytesToFree <= AverageFeatureBytes)
+		{
+			break;
+		}
+		BytesToFree -= AverageFeatureBytes;
+	}
+
+	// refresh the stat, the next sample will evict more if the estimate was too optimistic
+	uint64 VRAM = 0;
+	QueryDLSSVideoMemory(VRAM);
 }
 
 IMPLEMENT_MODULE(FNGXRHIModule, NGXRHI)
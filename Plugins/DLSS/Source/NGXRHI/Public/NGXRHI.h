@@ -214,6 +214,26 @@ DLSS_DISABLE_DEPRECATED_WARNINGS
 DLSS_RESTORE_DEPRECATED_WARNINGS
 };
 
+// hashes exactly the fields compared by FDLSSFeatureDesc::operator != so that descs which can share an NGX feature land in the same pool bucket
+inline uint32 GetTypeHash(const FDLSSFeatureDesc& Desc)
+{
+	const uint32 Flags = (Desc.bHighResolutionMotionVectors ? 1u << 0 : 0u)
+		| (Desc.bNonZeroSharpness ? 1u << 1 : 0u)
+		| (Desc.bUseAutoExposure ? 1u << 2 : 0u)
+		| (Desc.bEnableAlphaUpscaling ? 1u << 3 : 0u)
+		| (Desc.bReleaseMemoryOnDelete ? 1u << 4 : 0u);
+
+	uint32 Hash = GetTypeHash(Desc.DestRect.Size());
+	Hash = HashCombine(Hash, GetTypeHash(Desc.DLSSPreset));
+	Hash = HashCombine(Hash, GetTypeHash(Desc.DLSSRRPreset));
+	Hash = HashCombine(Hash, GetTypeHash(Desc.PerfQuality));
+	Hash = HashCombine(Hash, GetTypeHash(Flags));
+	Hash = HashCombine(Hash, GetTypeHash(Desc.GPUNode));
+	Hash = HashCombine(Hash, GetTypeHash(Desc.GPUVisibility));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<int32>(Desc.DenoiserMode)));
+	return Hash;
+}
+
 
 struct NGXRHI_API FRHIDLSSArguments
 {
@@ -527,6 +547,24 @@ public:
 
 	void TickPoolElements();
 
+	// running totals of the feature pool since this NGXRHI was created, the same events as the DLSS: Feature pool stats
+	struct FFeaturePoolCounters
+	{
+		uint32 NumHits = 0;
+		uint32 NumCreates = 0;
+		uint32 NumEvictions = 0;
+	};
+
+	const FFeaturePoolCounters& GetFeaturePoolCounters() const
+	{
+		return FeaturePoolCounters;
+	}
+
+	int32 GetNumAllocatedFeatures() const
+	{
+		return NumAllocatedDLSSFeatures;
+	}
+
 	static bool NGXInitialized()
 	{
 		return bNGXInitialized;
@@ -565,7 +603,15 @@ protected:
 	static bool bNGXInitialized;
 	static bool bIsIncompatibleAPICaptureToolActive;
 private:
-	TArray< TSharedPtr<NGXDLSSFeature>> AllocatedDLSSFeatures;
+	void EvictFeaturesOverBudget(uint64 InBudgetBytes, uint64 InVRAM);
+	bool QueryDLSSVideoMemory(uint64& OutVRAM) const;
+
+	// features are bucketed by desc so FindFreeFeature only has to look at the ones that could be reused
+	using FDLSSFeatureBucket = TArray<TSharedPtr<NGXDLSSFeature>, TInlineAllocator<1>>;
+	TMap<FDLSSFeatureDesc, FDLSSFeatureBucket> AllocatedDLSSFeatures;
+	int32 NumAllocatedDLSSFeatures = 0;
+	uint32 LastVRAMSampleFrame = 0;
+	FFeaturePoolCounters FeaturePoolCounters;
 
 	TTuple<FString, bool> DLSSSRGenericBinaryInfo;
 	TTuple<FString, bool> DLSSSRCustomBinaryInfo;
@@ -340,6 +340,13 @@ TAutoConsoleVariable<int32> CVarFSR3DeferDelete(
 	ECVF_RenderThreadSafe
 );
 
+TAutoConsoleVariable<int32> CVarFSR3StatePoolBudget(
+	TEXT("r.FidelityFX.FSR3.StatePoolBudgetMB"),
+	0,
+	TEXT("GPU memory budget in megabytes for released FSR3 states kept for reuse, the least recently used states are destroyed once the budget is exceeded. Only relevant when r.FidelityFX.FSR3.DeferDelete is non-zero. Default is 0 which means unlimited."),
+	ECVF_RenderThreadSafe
+);
+
 //------------------------------------------------------------------------------------------------------
 // Console variables for Frame Interpolation.
 //------------------------------------------------------------------------------------------------------
@@ -381,6 +388,12 @@ TAutoConsoleVariable<int32> CVarFFXFIUseDistortionTexture(
 	TEXT("Set to 1 to bind the UE distortion texture to the Frame Interpolation context to better interpolate distortion, set to 0 to ignore distortion (Default: 0).\n"),
 	ECVF_RenderThreadSafe);
 
+TAutoConsoleVariable<int32> CVarFFXFISlateRendererFastPath(
+	TEXT("r.FidelityFX.FI.SlateRendererFastPath"),
+	1,
+	TEXT("Set to 1 to restore the engine's Slate renderer while Frame Interpolation is disabled and only install the Frame Interpolation Slate renderer when it is enabled, set to 0 to always keep the Frame Interpolation Slate renderer installed (Default: 1).\n"),
+	ECVF_Default);
+
 #if (UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT || UE_BUILD_TEST)
 TAutoConsoleVariable<int32> CVarFFXFIShowDebugTearLines(
 	TEXT("r.FidelityFX.FI.ShowDebugTearLines"),
@@ -405,6 +418,20 @@ TAutoConsoleVariable<int32> CVarFSR3UseRHI(
 	ECVF_ReadOnly
 );
 
+TAutoConsoleVariable<int32> CVarFSR3RecordRHIJobLists(
+	TEXT("r.FidelityFX.FSR3.RecordRHIJobLists"),
+	0,
+	TEXT("Set to N to write the next N job lists executed by the RHI backend to Saved/Profiling/FidelityFX for offline analysis with ffx_job_replay, change the value again to record more. Default is 0."),
+	ECVF_RenderThreadSafe
+);
+
+TAutoConsoleVariable<int32> CVarFSR3BatchRHIClears(
+	TEXT("r.FidelityFX.FSR3.BatchRHIClears"),
+	1,
+	TEXT("True to record consecutive clears in the RHI backend's job lists as a single RDG pass, false to record one pass per cleared UAV. Default is 1."),
+	ECVF_RenderThreadSafe
+);
+
 TAutoConsoleVariable<int32> CVarFSR3PaceRHIFrames(
 	TEXT("r.FidelityFX.FI.RHIPacingMode"),
 	0,
@@ -140,6 +140,7 @@ extern FFXFSR3SETTINGS_API TAutoConsoleVariable<float> CVarFSR3ShadingChangeScal
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<float> CVarFSR3AccumulationAddedPerFrame;
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<float> CVarFSR3MinDisocclutionAccumulation;
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFSR3DeferDelete;
+extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFSR3StatePoolBudget;
 
 //------------------------------------------------------------------------------------------------------
 // Console variables for Frame Interpolation.
@@ -150,6 +151,7 @@ extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFIUpdateGlobalFram
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFIModifySlateDeltaTime;
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFIUIMode;
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFIUseDistortionTexture;
+extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFISlateRendererFastPath;
 #if (UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT || UE_BUILD_TEST)
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFIShowDebugTearLines;
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFIShowDebugView;
@@ -160,6 +162,8 @@ extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFFXFIShowDebugView;
 //-------------------------------------------------------------------------------------
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFSR3UseRHI;
 extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFSR3PaceRHIFrames;
+extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFSR3RecordRHIJobLists;
+extern FFXFSR3SETTINGS_API TAutoConsoleVariable<int32> CVarFSR3BatchRHIClears;
 
 //-------------------------------------------------------------------------------------
 // Console variables for the D3D12 backend.
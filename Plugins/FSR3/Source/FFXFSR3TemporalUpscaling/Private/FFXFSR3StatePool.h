@@ -0,0 +1,198 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/RefCounting.h"
+
+//-------------------------------------------------------------------------------------
+// Pool of released FSR3 states that can be reused by a later view, bucketed by key plus an intrusive list through the states
+// ordered from least to most recently released. A state only enters the pool once no history uses it any more, so the memory
+// budget only ever covers states that could actually be destroyed.
+// Templated on the state so the automation tests can drive it without a backend, the state provides the bookkeeping members
+// GpuMemoryUsage, PoolKey, PoolPrev, PoolNext, bPooled & NumHistories. Callers serialise access.
+//-------------------------------------------------------------------------------------
+template<typename StateType>
+class TFFXFSR3StatePool
+{
+public:
+	typedef TRefCountPtr<StateType> StateRef;
+	typedef TArray<StateRef, TInlineAllocator<2>> StateBucket;
+
+	~TFFXFSR3StatePool()
+	{
+		Empty();
+	}
+
+	// A history has started using the state, which takes it out of the pool.
+	void Acquire(StateType* State)
+	{
+		if (State)
+		{
+			State->NumHistories++;
+			if (State->bPooled)
+			{
+				Remove(State);
+			}
+		}
+	}
+
+	// A history has stopped using the state, it is pooled once no history uses it. Returns the number of states evicted to stay within Budget.
+	uint32 Release(StateRef const& State, uint64 Budget)
+	{
+		uint32 NumEvicted = 0;
+		if (State)
+		{
+			check(State->NumHistories > 0);
+			State->NumHistories--;
+			if (State->NumHistories == 0)
+			{
+				Add(State);
+				NumEvicted = Evict(Budget);
+			}
+		}
+		return NumEvicted;
+	}
+
+	// Released states that were pooled under Key, a state taken from here for reuse has to be removed from the pool.
+	StateBucket* Find(uint64 Key)
+	{
+		return States.Find(Key);
+	}
+
+	void Remove(StateType* State)
+	{
+		check(State->bPooled);
+		if (State->PoolPrev)
+		{
+			State->PoolPrev->PoolNext = State->PoolNext;
+		}
+		else
+		{
+			Head = State->PoolNext;
+		}
+		if (State->PoolNext)
+		{
+			State->PoolNext->PoolPrev = State->PoolPrev;
+		}
+		else
+		{
+			Tail = State->PoolPrev;
+		}
+		State->PoolPrev = nullptr;
+		State->PoolNext = nullptr;
+		State->bPooled = false;
+		Memory -= State->GpuMemoryUsage;
+		Count--;
+
+		// Dropping the pool's reference may destroy the state, so this must come last.
+		uint64 const Key = State->PoolKey;
+		StateBucket& Bucket = States.FindChecked(Key);
+		Bucket.RemoveAllSwap([State](StateRef const& Other) { return Other.GetReference() == State; });
+		if (Bucket.Num() == 0)
+		{
+			States.Remove(Key);
+		}
+	}
+
+	// Destroys the least recently released states until the pool fits in Budget, a budget of 0 is unlimited.
+	uint32 Evict(uint64 Budget)
+	{
+		uint32 NumEvicted = 0;
+		while (Budget && Head && Memory > Budget)
+		{
+			Remove(Head);
+			NumEvicted++;
+		}
+		return NumEvicted;
+	}
+
+	void Empty()
+	{
+		// Unlink everything before the references are dropped as states held elsewhere will outlive the pool.
+		for (StateType* State = Head; State;)
+		{
+			StateType* Next = State->PoolNext;
+			State->PoolPrev = nullptr;
+			State->PoolNext = nullptr;
+			State->bPooled = false;
+			State = Next;
+		}
+		Head = nullptr;
+		Tail = nullptr;
+		Memory = 0;
+		Count = 0;
+		States.Empty();
+	}
+
+	// The memory of a state is only known once its context has been created.
+	void SetMemoryUsage(StateType* State, uint64 GpuMemoryUsage)
+	{
+		if (State->bPooled)
+		{
+			Memory = Memory - State->GpuMemoryUsage + GpuMemoryUsage;
+		}
+		State->GpuMemoryUsage = GpuMemoryUsage;
+	}
+
+	StateType* GetLeastRecentlyReleased() const
+	{
+		return Head;
+	}
+
+	uint64 GetMemory() const
+	{
+		return Memory;
+	}
+
+	uint32 Num() const
+	{
+		return Count;
+	}
+
+private:
+	void Add(StateRef const& State)
+	{
+		check(!State->bPooled);
+		State->PoolPrev = Tail;
+		State->PoolNext = nullptr;
+		State->bPooled = true;
+		if (Tail)
+		{
+			Tail->PoolNext = State;
+		}
+		else
+		{
+			Head = State;
+		}
+		Tail = State;
+		Memory += State->GpuMemoryUsage;
+		Count++;
+		States.FindOrAdd(State->PoolKey).Add(State);
+	}
+
+	TMap<uint64, StateBucket> States;
+	StateType* Head = nullptr;
+	StateType* Tail = nullptr;
+	uint64 Memory = 0;
+	uint32 Count = 0;
+};
@@ -58,6 +58,16 @@
 DECLARE_GPU_STAT(FidelityFXSuperResolution3Pass);
 DECLARE_GPU_STAT_NAMED(FidelityFXFSR3Dispatch, TEXT("FidelityFX FSR3 Dispatch"));
 
+//------------------------------------------------------------------------------------------------------
+// CPU statistics for the pool of reusable FSR3 states.
+//------------------------------------------------------------------------------------------------------
+DECLARE_STATS_GROUP(TEXT("FFXFSR3"), STATGROUP_FFXFSR3, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FSR3: state pool hits"), STAT_FFXFSR3StatePoolHits, STATGROUP_FFXFSR3);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FSR3: state pool misses"), STAT_FFXFSR3StatePoolMisses, STATGROUP_FFXFSR3);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FSR3: state pool evictions"), STAT_FFXFSR3StatePoolEvictions, STATGROUP_FFXFSR3);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FSR3: pooled states"), STAT_FFXFSR3StatePoolCount, STATGROUP_FFXFSR3);
+DECLARE_MEMORY_STAT(TEXT("FSR3: pooled state memory"), STAT_FFXFSR3StatePoolMemory, STATGROUP_FFXFSR3);
+
 //------------------------------------------------------------------------------------------------------
 // Quality mode definitions
 //------------------------------------------------------------------------------------------------------
@@ -552,7 +562,7 @@ public:
 	void PostRenderOpaque(FRDGBuilder& GraphBuilder, TConstArrayView<FViewInfo> Views, bool bAllowGPUParticleUpdate) final
 #endif
 	{
-		if (CVarFSR3CreateReactiveMask.GetValueOnRenderThread() && Upscaler->IsApiSupported() && (CVarEnableFSR3.GetValueOnRenderThread()) && Views.Num() > 0)
+		if (Upscaler->RenderThreadSettings.CreateReactiveMask && Upscaler->IsApiSupported() && (Upscaler->RenderThreadSettings.EnableFSR3) && Views.Num() > 0)
 		{
 			const FSceneTextures* SceneTextures = nullptr;
 			FIntPoint SceneColorSize = FIntPoint::ZeroValue;
@@ -639,21 +649,21 @@ public:
 
 			FRDGTextureSRVRef CustomStencilSRV = nullptr;
 #if UE_VERSION_AT_LEAST(5, 2, 0)
-			if (!CustomDepth.bSeparateStencilBuffer && CustomDepth.Depth && HasBeenProduced(CustomDepth.Depth) && (CVarFSR3CustomStencilMask.GetValueOnAnyThread() != 0))
+			if (!CustomDepth.bSeparateStencilBuffer && CustomDepth.Depth && HasBeenProduced(CustomDepth.Depth) && (Upscaler->RenderThreadSettings.CustomStencilMask != 0))
 			{
 				FRDGTextureSRVDesc SRVDesc = FRDGTextureSRVDesc::CreateWithPixelFormat(CustomDepth.Depth, PF_X24_G8);
 				CustomStencilSRV = GraphBuilder.CreateSRV(SRVDesc);
 			}
-			else if (CustomDepth.bSeparateStencilBuffer && CustomDepth.Stencil && HasBeenProduced(CustomDepth.Stencil->GetParent()) && (CVarFSR3CustomStencilMask.GetValueOnAnyThread() != 0))
+			else if (CustomDepth.bSeparateStencilBuffer && CustomDepth.Stencil && HasBeenProduced(CustomDepth.Stencil->GetParent()) && (Upscaler->RenderThreadSettings.CustomStencilMask != 0))
 			{
 				CustomStencilSRV = CustomDepth.Stencil;
 			}
 #else
-			if (CustomDepth.Stencil && HasBeenProduced(CustomDepth.Stencil->GetParent()) && (CVarFSR3CustomStencilMask.GetValueOnAnyThread() != 0))
+			if (CustomDepth.Stencil && HasBeenProduced(CustomDepth.Stencil->GetParent()) && (Upscaler->RenderThreadSettings.CustomStencilMask != 0))
 			{
 				CustomStencilSRV = CustomDepth.Stencil;
 			}
-			else if (CustomDepth.Depth && HasBeenProduced(CustomDepth.Depth) && (CVarFSR3CustomStencilMask.GetValueOnAnyThread() != 0))
+			else if (CustomDepth.Depth && HasBeenProduced(CustomDepth.Depth) && (Upscaler->RenderThreadSettings.CustomStencilMask != 0))
 			{
 				FRDGTextureSRVDesc SRVDesc = FRDGTextureSRVDesc::CreateWithPixelFormat(CustomDepth.Depth, PF_X24_G8);
 				CustomStencilSRV = GraphBuilder.CreateSRV(SRVDesc);
@@ -807,10 +817,16 @@ FFXFSR3TemporalUpscaler::FFXFSR3TemporalUpscaler()
 	}
 
 	GEngine->GetDynamicResolutionCurrentStateInfos(DynamicResolutionStateInfos);
+
+	GameThreadSettings.Capture();
+	GameThreadSettings.Version = 1;
+	RenderThreadSettings = GameThreadSettings;
+	SettingsSinkHandle = IConsoleManager::Get().RegisterConsoleVariableSink_Handle(FConsoleCommandDelegate::CreateRaw(this, &FFXFSR3TemporalUpscaler::OnConsoleVariablesChanged));
 }
 
 FFXFSR3TemporalUpscaler::~FFXFSR3TemporalUpscaler()
 {
+	IConsoleManager::Get().UnregisterConsoleVariableSink_Handle(SettingsSinkHandle);
 	DeferredCleanup(0);
 	FFXSystemInterface::UnregisterCustomFXSystem(FFXFSR3FXSystem::FXName);
 }
@@ -820,12 +836,23 @@ const TCHAR* FFXFSR3TemporalUpscaler::GetDebugName() const
 	return FFXFSR3TemporalUpscalerHistory::GetUpscalerName();
 }
 
+void FFXFSR3TemporalUpscaler::AcquireState(FSR3StateRef State)
+{
+	FScopeLock Lock(&Mutex);
+	if (State)
+	{
+		StatePool.Acquire(State);
+		UpdateStatePoolStats(0);
+	}
+}
+
 void FFXFSR3TemporalUpscaler::ReleaseState(FSR3StateRef State)
 {
 	FScopeLock Lock(&Mutex);
-	if (!AvailableStates.Contains(State) && State)
+	if (State)
 	{
-		AvailableStates.Add(State);
+		State->PoolKey = GetStateKey(State->Params, State->ViewID);
+		UpdateStatePoolStats(StatePool.Release(State, GetStatePoolBudget()));
 	}
 }
 
@@ -835,31 +862,53 @@ void FFXFSR3TemporalUpscaler::DeferredCleanup(uint64 FrameNum) const
 	int32 NumFrames = CVarFSR3DeferDelete.GetValueOnAnyThread();
 	if (NumFrames == 0 || FrameNum == 0)
 	{
-		AvailableStates.Empty();
+		StatePool.Empty();
+		UpdateStatePoolStats(0);
 	}
 	else
 	{
-		TSet<FSR3StateRef> DisposeStates;
-		for (auto& State : AvailableStates)
+		FFXFSR3State* State = StatePool.GetLeastRecentlyReleased();
+		while (State)
 		{
-			ffxCreateContextDescUpscale const& CurrentParams = State->Params;
+			// Fetch the next state first as removing this one may destroy it.
+			FFXFSR3State* Next = State->PoolNext;
 			if (State->LastUsedFrame <= FrameNum && ((FrameNum - State->LastUsedFrame) > NumFrames))
 			{
-				DisposeStates.Add(State);
+				StatePool.Remove(State);
 			}
 			else if ((State->LastUsedFrame + NumFrames) < FrameNum)
 			{
-				DisposeStates.Add(State);
+				StatePool.Remove(State);
 			}
+			State = Next;
 		}
 
-		for (auto& State : DisposeStates)
-		{
-			AvailableStates.Remove(State);
-		}
+		UpdateStatePoolStats(StatePool.Evict(GetStatePoolBudget()));
 	}
 }
 
+//-------------------------------------------------------------------------------------
+// Only states with the same view, display size & flags can be reused for one another, so pack those into the key for the pool.
+// The render size isn't part of the key as any state with a large enough maximum render size is compatible.
+//-------------------------------------------------------------------------------------
+uint64 FFXFSR3TemporalUpscaler::GetStateKey(ffxCreateContextDescUpscale const& Params, uint32 ViewID)
+{
+	uint32 DisplaySize = (Params.maxUpscaleSize.width & 0xffff) | ((Params.maxUpscaleSize.height & 0xffff) << 16);
+	return ((uint64)ViewID << 32) | HashCombine(GetTypeHash(DisplaySize), GetTypeHash(Params.flags));
+}
+
+uint64 FFXFSR3TemporalUpscaler::GetStatePoolBudget()
+{
+	return (uint64)FMath::Max(CVarFSR3StatePoolBudget.GetValueOnAnyThread(), 0) * 1024 * 1024;
+}
+
+void FFXFSR3TemporalUpscaler::UpdateStatePoolStats(uint32 NumEvicted) const
+{
+	INC_DWORD_STAT_BY(STAT_FFXFSR3StatePoolEvictions, NumEvicted);
+	SET_DWORD_STAT(STAT_FFXFSR3StatePoolCount, StatePool.Num());
+	SET_MEMORY_STAT(STAT_FFXFSR3StatePoolMemory, StatePool.GetMemory());
+}
+
 IFFXSharedBackend* FFXFSR3TemporalUpscaler::GetApiAccessor(EFFXBackendAPI& Api)
 {
 	IFFXSharedBackend* ApiAccessor = nullptr;
@@ -966,6 +1015,76 @@ void FFXFSR3TemporalUpscaler::OnChangeFFXFSR3QualityMode(IConsoleVariable* Var)
 	}
 }
 
+//-------------------------------------------------------------------------------------
+// Console variable sinks are invoked on the game thread once per frame after any console variable has changed.
+// Only when one of ours differs is a new snapshot versioned and sent to the render thread.
+//-------------------------------------------------------------------------------------
+void FFXFSR3TemporalUpscaler::OnConsoleVariablesChanged()
+{
+	FFXFSR3ViewSettings Settings;
+	Settings.Capture();
+	if (!Settings.Equals(GameThreadSettings))
+	{
+		Settings.Version = GameThreadSettings.Version + 1;
+		GameThreadSettings = Settings;
+
+		FFXFSR3TemporalUpscaler* Upscaler = this;
+		ENQUEUE_RENDER_COMMAND(FFXFSR3UpdateViewSettings)([Upscaler, Settings](FRHICommandListImmediate& RHICmdList)
+		{
+			Upscaler->RenderThreadSettings = Settings;
+		});
+	}
+}
+
+void FFXFSR3ViewSettings::Capture()
+{
+	Version = 0;
+	EnableFSR3 = CVarEnableFSR3.GetValueOnGameThread();
+	AutoExposure = CVarFSR3AutoExposure.GetValueOnGameThread();
+	HistoryFormat = CVarFSR3HistoryFormat.GetValueOnGameThread();
+	CreateReactiveMask = CVarFSR3CreateReactiveMask.GetValueOnGameThread();
+	DeDitherMode = CVarFSR3DeDitherMode.GetValueOnGameThread();
+	QuantizeInternalTextures = CVarFSR3QuantizeInternalTextures.GetValueOnGameThread();
+	UseExperimentalSSRDenoiser = CVarFSR3UseExperimentalSSRDenoiser.GetValueOnGameThread();
+	CustomStencilMask = CVarFSR3CustomStencilMask.GetValueOnGameThread();
+	CustomStencilShift = CVarFSR3CustomStencilShift.GetValueOnGameThread();
+	ReactiveMaskRoughnessForceMaxDistance = CVarFSR3ReactiveMaskRoughnessForceMaxDistance.GetValueOnGameThread();
+	ReactiveMaskReactiveShadingModelID = CVarFSR3ReactiveMaskReactiveShadingModelID.GetValueOnGameThread();
+	ReactiveMaskPreDOFTranslucencyMax = CVarFSR3ReactiveMaskPreDOFTranslucencyMax.GetValueOnGameThread();
+	Sharpness = CVarFSR3Sharpness.GetValueOnGameThread();
+	ReactiveMaskReflectionScale = CVarFSR3ReactiveMaskReflectionScale.GetValueOnGameThread();
+	ReactiveMaskRoughnessScale = CVarFSR3ReactiveMaskRoughnessScale.GetValueOnGameThread();
+	ReactiveMaskRoughnessBias = CVarFSR3ReactiveMaskRoughnessBias.GetValueOnGameThread();
+	ReactiveMaskRoughnessMaxDistance = CVarFSR3ReactiveMaskRoughnessMaxDistance.GetValueOnGameThread();
+	ReactiveMaskReflectionLumaBias = CVarFSR3ReactiveMaskReflectionLumaBias.GetValueOnGameThread();
+	ReactiveHistoryTranslucencyBias = CVarFSR3ReactiveHistoryTranslucencyBias.GetValueOnGameThread();
+	ReactiveHistoryTranslucencyLumaBias = CVarFSR3ReactiveHistoryTranslucencyLumaBias.GetValueOnGameThread();
+	ReactiveMaskTranslucencyBias = CVarFSR3ReactiveMaskTranslucencyBias.GetValueOnGameThread();
+	ReactiveMaskTranslucencyLumaBias = CVarFSR3ReactiveMaskTranslucencyLumaBias.GetValueOnGameThread();
+	ReactiveMaskTranslucencyMaxDistance = CVarFSR3ReactiveMaskTranslucencyMaxDistance.GetValueOnGameThread();
+	ReactiveMaskForceReactiveMaterialValue = CVarFSR3ReactiveMaskForceReactiveMaterialValue.GetValueOnGameThread();
+	ReactiveMaskPreDOFTranslucencyScale = CVarFSR3ReactiveMaskPreDOFTranslucencyScale.GetValueOnGameThread();
+	ReactiveMaskCustomStencilScale = CVarFSR3ReactiveMaskCustomStencilScale.GetValueOnGameThread();
+	ReactiveHistoryCustomStencilScale = CVarFSR3ReactiveHistoryCustomStencilScale.GetValueOnGameThread();
+	ReactiveMaskDeferredDecalScale = CVarFSR3ReactiveMaskDeferredDecalScale.GetValueOnGameThread();
+	ReactiveHistoryDeferredDecalScale = CVarFSR3ReactiveHistoryDeferredDecalScale.GetValueOnGameThread();
+	ReactiveMaskTAAResponsiveValue = CVarFSR3ReactiveMaskTAAResponsiveValue.GetValueOnGameThread();
+	ReactiveHistoryTAAResponsiveValue = CVarFSR3ReactiveHistoryTAAResponsiveValue.GetValueOnGameThread();
+	VelocityFactor = CVarFSR3VelocityFactor.GetValueOnGameThread();
+	ReactivenessScale = CVarFSR3ReactivenessScale.GetValueOnGameThread();
+	ShadingChangeScale = CVarFSR3ShadingChangeScale.GetValueOnGameThread();
+	AccumulationAddedPerFrame = CVarFSR3AccumulationAddedPerFrame.GetValueOnGameThread();
+	MinDisocclusionAccumulation = CVarFSR3MinDisocclutionAccumulation.GetValueOnGameThread();
+}
+
+bool FFXFSR3ViewSettings::Equals(FFXFSR3ViewSettings const& Other) const
+{
+	// Every field is a 32bit int or float so the values after the version can be compared as one block.
+	static_assert(sizeof(FFXFSR3ViewSettings) % sizeof(uint32) == 0, "FFXFSR3ViewSettings must not contain padding");
+	SIZE_T const Offset = STRUCT_OFFSET(FFXFSR3ViewSettings, EnableFSR3);
+	return FMemory::Memcmp((uint8 const*)this + Offset, (uint8 const*)&Other + Offset, sizeof(FFXFSR3ViewSettings) - Offset) == 0;
+}
+
 FRDGBuilder* FFXFSR3TemporalUpscaler::GetGraphBuilder()
 {
 	return CurrentGraphBuilder;
@@ -1035,7 +1154,10 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 #else
 	bool const bValidEyeAdaptation = View.HasValidEyeAdaptationTexture();
 #endif
-	bool const bRequestedAutoExposure = static_cast<bool>(CVarFSR3AutoExposure.GetValueOnRenderThread());
+	// Take a copy so every pass for this view sees the same values.
+	FFXFSR3ViewSettings const Settings = RenderThreadSettings;
+
+	bool const bRequestedAutoExposure = static_cast<bool>(Settings.AutoExposure);
 	bool const bUseAutoExposure = bRequestedAutoExposure || !bValidEyeAdaptation;
 
 	PreAlpha.Target = nullptr;
@@ -1087,7 +1209,7 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 			VelocityTexture = (*PostInputs.SceneTextures)->GBufferVelocityTexture;
 		}
 
-		FIntPoint InputTextureExtents = CVarFSR3QuantizeInternalTextures.GetValueOnRenderThread() ? InputExtentsQuantized : InputExtents;
+		FIntPoint InputTextureExtents = Settings.QuantizeInternalTextures ? InputExtentsQuantized : InputExtents;
 		FRDGTextureSRVDesc DepthDesc = FRDGTextureSRVDesc::Create(SceneDepth);
 		FRDGTextureSRVDesc VelocityDesc = FRDGTextureSRVDesc::Create(VelocityTexture);
 		FRDGTextureDesc ReactiveMaskDesc = FRDGTextureDesc::Create2D(InputTextureExtents, PF_R8, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable);
@@ -1096,7 +1218,7 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 		FRDGTextureRef CompositeMaskTexture = nullptr;
 		FRDGTextureDesc SceneColorDesc = FRDGTextureDesc::Create2D(InputTextureExtents, SceneColor->Desc.Format, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable);
 
-		if (CVarFSR3CreateReactiveMask.GetValueOnRenderThread())
+		if (Settings.CreateReactiveMask)
 		{
 			ReactiveMaskTexture = GraphBuilder.CreateTexture(ReactiveMaskDesc, TEXT("FFXFSR3ReactiveMaskTexture"));
 			CompositeMaskTexture = GraphBuilder.CreateTexture(CompositeMaskDesc, TEXT("FFXFSR3CompositeMaskTexture"));
@@ -1123,8 +1245,8 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 					DBufferA = GraphBuilder.RegisterExternalTexture(GSystemTextures.WhiteDummy);
 				}
 #endif
-				PassParameters->DeferredDecalReactiveMaskScale = CVarFSR3ReactiveMaskDeferredDecalScale.GetValueOnAnyThread();
-				PassParameters->DeferredDecalReactiveHistoryScale = CVarFSR3ReactiveHistoryDeferredDecalScale.GetValueOnAnyThread();
+				PassParameters->DeferredDecalReactiveMaskScale = Settings.ReactiveMaskDeferredDecalScale;
+				PassParameters->DeferredDecalReactiveHistoryScale = Settings.ReactiveHistoryDeferredDecalScale;
 
 				FRDGTextureRef SeparateTranslucency;
 
@@ -1171,7 +1293,7 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 #if UE_VERSION_OLDER_THAN(5, 0, 0)
 				// In UE4 plugins we don't prepare for CustomStencil in PostRenderOpaque as it will cause nested AddPass
 				// So we check Cvar here to ensure CustomStencil don't affect Reactive by default like what UE5 plugins do
-				if (CVarFSR3CustomStencilMask.GetValueOnAnyThread() != 0)
+				if (Settings.CustomStencilMask != 0)
 				{
 					FRDGTextureRef CustomDepthSceneTexture = (*PostInputs.SceneTextures)->CustomDepthTexture;
 					FRDGTextureSRVDesc CustomStencilDesc = FRDGTextureSRVDesc::CreateWithPixelFormat(CustomDepthSceneTexture, PF_X24_G8);
@@ -1194,13 +1316,13 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 
 				FRDGTextureSRVDesc StencilSRV = FRDGTextureSRVDesc::CreateWithPixelFormat(SceneDepth, PF_X24_G8);
 				PassParameters->StencilTexture = GraphBuilder.CreateSRV(StencilSRV);
-				PassParameters->ReactiveMaskTAAResponsiveValue = CVarFSR3ReactiveMaskTAAResponsiveValue.GetValueOnAnyThread();
-				PassParameters->ReactiveHistoryTAAResponsiveValue = CVarFSR3ReactiveHistoryTAAResponsiveValue.GetValueOnAnyThread();
+				PassParameters->ReactiveMaskTAAResponsiveValue = Settings.ReactiveMaskTAAResponsiveValue;
+				PassParameters->ReactiveHistoryTAAResponsiveValue = Settings.ReactiveHistoryTAAResponsiveValue;
 
-				PassParameters->CustomStencilReactiveMaskScale = CVarFSR3ReactiveMaskCustomStencilScale.GetValueOnAnyThread();
-				PassParameters->CustomStencilReactiveHistoryScale = CVarFSR3ReactiveHistoryCustomStencilScale.GetValueOnAnyThread();
-				PassParameters->CustomStencilMask = CVarFSR3CustomStencilMask.GetValueOnAnyThread();
-				PassParameters->CustomStencilShift = CVarFSR3CustomStencilShift.GetValueOnAnyThread();
+				PassParameters->CustomStencilReactiveMaskScale = Settings.ReactiveMaskCustomStencilScale;
+				PassParameters->CustomStencilReactiveHistoryScale = Settings.ReactiveHistoryCustomStencilScale;
+				PassParameters->CustomStencilMask = Settings.CustomStencilMask;
+				PassParameters->CustomStencilShift = Settings.CustomStencilShift;
 
 				PassParameters->DepthTexture = SceneDepth;
 				PassParameters->InputDepth = GraphBuilder.CreateSRV(DepthDesc);
@@ -1295,20 +1417,20 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 				PassParameters->ReactiveMask = GraphBuilder.CreateUAV(ReactiveDesc);
 				PassParameters->CompositeMask = GraphBuilder.CreateUAV(CompositeDesc);
 
-				PassParameters->FurthestReflectionCaptureDistance = CVarFSR3ReactiveMaskRoughnessForceMaxDistance.GetValueOnRenderThread() ? CVarFSR3ReactiveMaskRoughnessMaxDistance.GetValueOnRenderThread() : FMath::Max(CVarFSR3ReactiveMaskRoughnessMaxDistance.GetValueOnRenderThread(), View.FurthestReflectionCaptureDistance);
-				PassParameters->ReactiveMaskReflectionScale = CVarFSR3ReactiveMaskReflectionScale.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskRoughnessScale = CVarFSR3ReactiveMaskRoughnessScale.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskRoughnessBias = CVarFSR3ReactiveMaskRoughnessBias.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskReflectionLumaBias = CVarFSR3ReactiveMaskReflectionLumaBias.GetValueOnRenderThread();
-				PassParameters->ReactiveHistoryTranslucencyBias = CVarFSR3ReactiveHistoryTranslucencyBias.GetValueOnRenderThread();
-				PassParameters->ReactiveHistoryTranslucencyLumaBias = CVarFSR3ReactiveHistoryTranslucencyLumaBias.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskTranslucencyBias = CVarFSR3ReactiveMaskTranslucencyBias.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskTranslucencyLumaBias = CVarFSR3ReactiveMaskTranslucencyLumaBias.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskPreDOFTranslucencyScale = CVarFSR3ReactiveMaskPreDOFTranslucencyScale.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskPreDOFTranslucencyMax = CVarFSR3ReactiveMaskPreDOFTranslucencyMax.GetValueOnRenderThread();
-				PassParameters->ReactiveMaskTranslucencyMaxDistance = CVarFSR3ReactiveMaskTranslucencyMaxDistance.GetValueOnRenderThread();
-				PassParameters->ForceLitReactiveValue = CVarFSR3ReactiveMaskForceReactiveMaterialValue.GetValueOnRenderThread();
-				PassParameters->ReactiveShadingModelID = (uint32)CVarFSR3ReactiveMaskReactiveShadingModelID.GetValueOnRenderThread();
+				PassParameters->FurthestReflectionCaptureDistance = Settings.ReactiveMaskRoughnessForceMaxDistance ? Settings.ReactiveMaskRoughnessMaxDistance : FMath::Max(Settings.ReactiveMaskRoughnessMaxDistance, View.FurthestReflectionCaptureDistance);
+				PassParameters->ReactiveMaskReflectionScale = Settings.ReactiveMaskReflectionScale;
+				PassParameters->ReactiveMaskRoughnessScale = Settings.ReactiveMaskRoughnessScale;
+				PassParameters->ReactiveMaskRoughnessBias = Settings.ReactiveMaskRoughnessBias;
+				PassParameters->ReactiveMaskReflectionLumaBias = Settings.ReactiveMaskReflectionLumaBias;
+				PassParameters->ReactiveHistoryTranslucencyBias = Settings.ReactiveHistoryTranslucencyBias;
+				PassParameters->ReactiveHistoryTranslucencyLumaBias = Settings.ReactiveHistoryTranslucencyLumaBias;
+				PassParameters->ReactiveMaskTranslucencyBias = Settings.ReactiveMaskTranslucencyBias;
+				PassParameters->ReactiveMaskTranslucencyLumaBias = Settings.ReactiveMaskTranslucencyLumaBias;
+				PassParameters->ReactiveMaskPreDOFTranslucencyScale = Settings.ReactiveMaskPreDOFTranslucencyScale;
+				PassParameters->ReactiveMaskPreDOFTranslucencyMax = Settings.ReactiveMaskPreDOFTranslucencyMax;
+				PassParameters->ReactiveMaskTranslucencyMaxDistance = Settings.ReactiveMaskTranslucencyMaxDistance;
+				PassParameters->ForceLitReactiveValue = Settings.ReactiveMaskForceReactiveMaterialValue;
+				PassParameters->ReactiveShadingModelID = (uint32)Settings.ReactiveMaskReactiveShadingModelID;
 
 				TShaderMapRef<FFXFSR3CreateReactiveMaskCS> ComputeShaderFSR(View.ShaderMap);
 				FComputeShaderUtils::AddPass(
@@ -1333,7 +1455,7 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 
 		// If we are set to de-dither rendering then run the extra pass now - this tries to identify dither patterns and blend them to avoid over-thinning in FSR3.
 		// There is specific code for SHADINGMODELID_HAIR pixels which are always dithered.
-		if (CVarFSR3DeDitherMode.GetValueOnRenderThread() && (*PostInputs.SceneTextures)->GBufferBTexture)
+		if (Settings.DeDitherMode && (*PostInputs.SceneTextures)->GBufferBTexture)
 		{
 			FRDGTextureRef TempSceneColor = GraphBuilder.CreateTexture(SceneColorDesc, TEXT("FFXFSR3SubrectColor"));
 			FFXFSR3DeDitherCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FFXFSR3DeDitherCS::FParameters>();
@@ -1351,7 +1473,7 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 			PassParameters->BlendSceneColor = GraphBuilder.CreateUAV(OutputDesc);
 
 			// Full de-dither requires the proper setting or not running on the Deferred renderer where we can't determine the shading model.
-			PassParameters->FullDeDither = (CVarFSR3DeDitherMode.GetValueOnRenderThread() == 1) || (!GBufferB);
+			PassParameters->FullDeDither = (Settings.DeDitherMode == 1) || (!GBufferB);
 			if (!GBufferB)
 			{
 				GBufferB = GraphBuilder.RegisterExternalTexture(GSystemTextures.BlackDummy);
@@ -1420,7 +1542,7 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 		//-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 		if (View.ViewRect.Min != FIntPoint::ZeroValue)
 		{
-			if (!CVarFSR3DeDitherMode.GetValueOnRenderThread())
+			if (!Settings.DeDitherMode)
 			{
 				FRDGTextureRef TempSceneColor = GraphBuilder.CreateTexture(SceneColorDesc, TEXT("FFXFSR3SubrectColor"));
 
@@ -1461,7 +1583,7 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 		static const auto CVarPostPropagateAlpha = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.PostProcessing.PropagateAlpha"));
 		const bool bSupportsAlpha = (CVarPostPropagateAlpha && CVarPostPropagateAlpha->GetValueOnRenderThread() != 0);
 #endif
-		EPixelFormat OutputFormat = (bSupportsAlpha || (CVarFSR3HistoryFormat.GetValueOnRenderThread() == 0)) ? PF_FloatRGBA : PF_FloatR11G11B10;
+		EPixelFormat OutputFormat = (bSupportsAlpha || (Settings.HistoryFormat == 0)) ? PF_FloatRGBA : PF_FloatR11G11B10;
 
 		FRDGTextureDesc OutputColorDesc = FRDGTextureDesc::Create2D(OutputExtentsQuantized, OutputFormat, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable);
 		FRDGTextureRef OutputTexture = GraphBuilder.CreateTexture(OutputColorDesc, TEXT("FFXFSR3OutputTexture"));
@@ -1551,32 +1673,47 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 			if (!HasValidContext)
 			{
 				FScopeLock Lock(&Mutex);
-				TSet<FSR3StateRef> DisposeStates;
-				for (auto& State : AvailableStates)
+				TArray<FFXFSR3State*, TInlineAllocator<4>> DisposeStates;
+				if (auto* Bucket = StatePool.Find(GetStateKey(Params, View.ViewState->UniqueID)))
 				{
-					ffxCreateContextDescUpscale const& CurrentParams = State->Params;
-					if (State->LastUsedFrame == GFrameCounterRenderThread || State->ViewID != View.ViewState->UniqueID)
-					{
-						// These states can't be reused immediately but perhaps a future frame, otherwise we break split screen.
-						continue;
-					}
-					else if ((CurrentParams.maxRenderSize.width < Params.maxRenderSize.width) || (CurrentParams.maxRenderSize.height < Params.maxRenderSize.height) || (CurrentParams.maxUpscaleSize.width != Params.maxUpscaleSize.width) || (CurrentParams.maxUpscaleSize.height != Params.maxUpscaleSize.height) || (Params.flags != CurrentParams.flags))
+					for (auto& State : *Bucket)
 					{
-						// States that can't be trivially reused need to just be released to save memory.
-						DisposeStates.Add(State);
-					}
-					else
-					{
-						FSR3State = State;
-						HasValidContext = true;
-						bHistoryValid = false;
-						break;
+						ffxCreateContextDescUpscale const& CurrentParams = State->Params;
+						if (State->LastUsedFrame == GFrameCounterRenderThread || State->ViewID != View.ViewState->UniqueID || (CurrentParams.maxUpscaleSize.width != Params.maxUpscaleSize.width) || (CurrentParams.maxUpscaleSize.height != Params.maxUpscaleSize.height) || (Params.flags != CurrentParams.flags))
+						{
+							// These states can't be reused immediately but perhaps a future frame, otherwise we break split screen.
+							// Key collisions also end up here and are left for the other view to pick up.
+							continue;
+						}
+						else if ((CurrentParams.maxRenderSize.width < Params.maxRenderSize.width) || (CurrentParams.maxRenderSize.height < Params.maxRenderSize.height))
+						{
+							// States that can't be trivially reused need to just be released to save memory.
+							DisposeStates.Add(State);
+						}
+						else
+						{
+							FSR3State = State;
+							HasValidContext = true;
+							bHistoryValid = false;
+							break;
+						}
 					}
 				}
 
-				for (auto& State : DisposeStates)
+				for (FFXFSR3State* State : DisposeStates)
 				{
-					AvailableStates.Remove(State);
+					StatePool.Remove(State);
+				}
+
+				if (HasValidContext)
+				{
+					// In use states don't count towards the pool's budget, the new history acquires it once it has been set up.
+					StatePool.Remove(FSR3State);
+					INC_DWORD_STAT(STAT_FFXFSR3StatePoolHits);
+				}
+				else
+				{
+					INC_DWORD_STAT(STAT_FFXFSR3StatePoolMisses);
 				}
 			}
 
@@ -1641,6 +1778,17 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 				if (ErrorCode == FFX_OK)
 				{
 					FMemory::Memcpy(FSR3State->Params, Params);
+
+					// Record the memory the context allocated so the state pool can be held within its budget.
+					FfxApiEffectMemoryUsage MemoryUsage = {};
+					ffxQueryDescUpscaleGetGPUMemoryUsage MemoryDesc;
+					MemoryDesc.header.pNext = nullptr;
+					MemoryDesc.header.type = FFX_API_QUERY_DESC_TYPE_UPSCALE_GPU_MEMORY_USAGE;
+					MemoryDesc.gpuMemoryUsageUpscaler = &MemoryUsage;
+					uint64 GpuMemoryUsage = (ApiAccessor->ffxQuery(&FSR3State->Fsr3, &MemoryDesc.header) == FFX_API_RETURN_OK) ? MemoryUsage.totalUsageInBytes : 0;
+
+					FScopeLock Lock(&Mutex);
+					StatePool.SetMemoryUsage(FSR3State, GpuMemoryUsage);
 				}
 			}
 		}
@@ -1659,8 +1807,8 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 			Fsr3DispatchParams.reset = !bHistoryValid;
 
 			// CVar parameters:
-			Fsr3DispatchParams.enableSharpening = (CVarFSR3Sharpness.GetValueOnRenderThread() != 0.0f);
-			Fsr3DispatchParams.sharpness = FMath::Clamp(CVarFSR3Sharpness.GetValueOnRenderThread(), 0.0f, 1.0f);
+			Fsr3DispatchParams.enableSharpening = (Settings.Sharpness != 0.0f);
+			Fsr3DispatchParams.sharpness = FMath::Clamp(Settings.Sharpness, 0.0f, 1.0f);
 
 			// Engine parameters:
 #if UE_VERSION_AT_LEAST(5, 0, 0)
@@ -1741,11 +1889,11 @@ void FFXFSR3TemporalUpscaler::AddPasses(
 		PassParameters->OutputTexture = OutputTexture;
 
 		TArray<TPair<FfxFsr3UpscalerConfigureKey, float>> ConfigureUpscalerKeyValues = {
-			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FVELOCITYFACTOR, CVarFSR3VelocityFactor.GetValueOnRenderThread()},
-			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FREACTIVENESSSCALE, CVarFSR3ReactivenessScale.GetValueOnRenderThread()},
-			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FSHADINGCHANGESCALE, CVarFSR3ShadingChangeScale.GetValueOnRenderThread()},
-			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FACCUMULATIONADDEDPERFRAME, CVarFSR3AccumulationAddedPerFrame.GetValueOnRenderThread()},
-			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FMINDISOCCLUSIONACCUMULATION, CVarFSR3MinDisocclutionAccumulation.GetValueOnRenderThread()}
+			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FVELOCITYFACTOR, Settings.VelocityFactor},
+			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FREACTIVENESSSCALE, Settings.ReactivenessScale},
+			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FSHADINGCHANGESCALE, Settings.ShadingChangeScale},
+			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FACCUMULATIONADDEDPERFRAME, Settings.AccumulationAddedPerFrame},
+			{FFX_FSR3UPSCALER_CONFIGURE_UPSCALE_KEY_FMINDISOCCLUSIONACCUMULATION, Settings.MinDisocclusionAccumulation}
 		};
 
 		auto* ApiAccess = ApiAccessor;
@@ -2048,7 +2196,7 @@ void FFXFSR3TemporalUpscaler::CopyOpaqueSceneColor(FRHICommandListImmediate& RHI
 	{
 		SceneColor = PreAlpha.Target->GetRHI();
 	}
-	if (IsApiSupported() && (CVarEnableFSR3.GetValueOnRenderThread()) && SceneColorPreAlpha.GetReference() && SceneColor.GetReference() && SceneColorPreAlpha->GetFormat() == SceneColor->GetFormat())
+	if (IsApiSupported() && (RenderThreadSettings.EnableFSR3) && SceneColorPreAlpha.GetReference() && SceneColor.GetReference() && SceneColorPreAlpha->GetFormat() == SceneColor->GetFormat())
 	{
 		SCOPED_DRAW_EVENTF(RHICmdList, FFXFSR3TemporalUpscaler_CopyOpaqueSceneColor, TEXT("FFXFSR3TemporalUpscaler CopyOpaqueSceneColor"));
 
@@ -2060,7 +2208,7 @@ void FFXFSR3TemporalUpscaler::CopyOpaqueSceneColor(FRHICommandListImmediate& RHI
 #else
 	FTextureRHIRef SceneColor;
 	SceneColor = FSceneRenderTargets::Get(RHICmdList).GetSceneColorTexture();
-	if (IsApiSupported() && (CVarEnableFSR3.GetValueOnRenderThread()) && SceneColorPreAlpha.GetReference() && SceneColor.GetReference())
+	if (IsApiSupported() && (RenderThreadSettings.EnableFSR3) && SceneColorPreAlpha.GetReference() && SceneColor.GetReference())
 	{
 		SCOPED_DRAW_EVENTF(RHICmdList, FFXFSR3TemporalUpscaler_CopyOpaqueSceneColor, TEXT("FFXFSR3TemporalUpscaler CopyOpaqueSceneColor"));
 
@@ -2170,7 +2318,7 @@ IScreenSpaceDenoiser::FReflectionsOutputs FFXFSR3TemporalUpscaler::DenoiseReflec
 #if UE_VERSION_OLDER_THAN(5, 4, 0)
 	bRayTracedReflections = FFXFSR3ShouldRenderRayTracingReflections(View);
 #endif
-	if (bRayTracedReflections || CVarFSR3UseExperimentalSSRDenoiser.GetValueOnRenderThread())
+	if (bRayTracedReflections || RenderThreadSettings.UseExperimentalSSRDenoiser)
 	{
 		Outputs = WrappedDenoiser->DenoiseReflections(GraphBuilder, View, PreviousViewInfos, SceneTextures, ReflectionInputs, RayTracingConfig);
 	}
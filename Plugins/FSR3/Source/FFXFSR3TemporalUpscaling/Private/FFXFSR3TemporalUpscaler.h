@@ -28,6 +28,7 @@
 #include "ScreenSpaceDenoise.h"
 #include "Containers/LockFreeList.h"
 #include "FFXFSR3TemporalUpscalerHistory.h"
+#include "FFXFSR3StatePool.h"
 #include "FFXSharedBackend.h"
 
 #if UE_VERSION_AT_LEAST(5, 3, 0)
@@ -52,6 +53,54 @@ namespace FFXFSR3Strings
 
 struct FPostProcessingInputs;
 
+//-------------------------------------------------------------------------------------
+// Snapshot of the console variables read while adding the FSR3 passes for a view.
+// Captured on the game thread whenever a console variable changes and copied by value to the render thread.
+//-------------------------------------------------------------------------------------
+struct FFXFSR3ViewSettings
+{
+	uint32 Version;
+	int32 EnableFSR3;
+	int32 AutoExposure;
+	int32 HistoryFormat;
+	int32 CreateReactiveMask;
+	int32 DeDitherMode;
+	int32 QuantizeInternalTextures;
+	int32 UseExperimentalSSRDenoiser;
+	int32 CustomStencilMask;
+	int32 CustomStencilShift;
+	int32 ReactiveMaskRoughnessForceMaxDistance;
+	int32 ReactiveMaskReactiveShadingModelID;
+	int32 ReactiveMaskPreDOFTranslucencyMax;
+	float Sharpness;
+	float ReactiveMaskReflectionScale;
+	float ReactiveMaskRoughnessScale;
+	float ReactiveMaskRoughnessBias;
+	float ReactiveMaskRoughnessMaxDistance;
+	float ReactiveMaskReflectionLumaBias;
+	float ReactiveHistoryTranslucencyBias;
+	float ReactiveHistoryTranslucencyLumaBias;
+	float ReactiveMaskTranslucencyBias;
+	float ReactiveMaskTranslucencyLumaBias;
+	float ReactiveMaskTranslucencyMaxDistance;
+	float ReactiveMaskForceReactiveMaterialValue;
+	float ReactiveMaskPreDOFTranslucencyScale;
+	float ReactiveMaskCustomStencilScale;
+	float ReactiveHistoryCustomStencilScale;
+	float ReactiveMaskDeferredDecalScale;
+	float ReactiveHistoryDeferredDecalScale;
+	float ReactiveMaskTAAResponsiveValue;
+	float ReactiveHistoryTAAResponsiveValue;
+	float VelocityFactor;
+	float ReactivenessScale;
+	float ShadingChangeScale;
+	float AccumulationAddedPerFrame;
+	float MinDisocclusionAccumulation;
+
+	void Capture();
+	bool Equals(FFXFSR3ViewSettings const& Other) const;
+};
+
 #if UE_VERSION_OLDER_THAN(5, 0, 0)
 //-------------------------------------------------------------------------------------
 // Simplifies cross engine support.
@@ -74,6 +123,7 @@ public:
 
 	const TCHAR* GetDebugName() const override;
 
+	void AcquireState(FSR3StateRef State);
 	void ReleaseState(FSR3StateRef State);
 
 	static class IFFXSharedBackend* GetApiAccessor(EFFXBackendAPI& Api);
@@ -89,6 +139,7 @@ public:
 
 	static void OnChangeFFXFSR3Enabled(IConsoleVariable* Var);
 	static void OnChangeFFXFSR3QualityMode(IConsoleVariable* Var);
+	void OnConsoleVariablesChanged();
 
 	class FRDGBuilder* GetGraphBuilder();
 
@@ -248,11 +299,18 @@ public:
 
 private:
 	void DeferredCleanup(uint64 FrameNum) const;
+	static uint64 GetStateKey(ffxCreateContextDescUpscale const& Params, uint32 ViewID);
+	static uint64 GetStatePoolBudget();
+	void UpdateStatePoolStats(uint32 NumEvicted) const;
 
 	mutable FPostProcessingInputs PostInputs;
 	FDynamicResolutionStateInfos DynamicResolutionStateInfos;
+	FFXFSR3ViewSettings GameThreadSettings;
+	FFXFSR3ViewSettings RenderThreadSettings;
+	FConsoleVariableSinkHandle SettingsSinkHandle;
 	mutable FCriticalSection Mutex;
-	mutable TSet<FSR3StateRef> AvailableStates;
+	// Released states keyed by GetStateKey, guarded by Mutex.
+	mutable TFFXFSR3StatePool<FFXFSR3State> StatePool;
 	mutable EFFXBackendAPI Api;
 	mutable class IFFXSharedBackend* ApiAccessor;
 	mutable class FRDGBuilder* CurrentGraphBuilder;
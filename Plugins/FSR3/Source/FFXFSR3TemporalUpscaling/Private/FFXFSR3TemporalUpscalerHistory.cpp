@@ -59,6 +59,8 @@ uint64 FFXFSR3TemporalUpscalerHistory::GetGPUSizeBytes() const {
 
 void FFXFSR3TemporalUpscalerHistory::SetState(FSR3StateRef NewState)
 {
+	// Acquire first so a state handed from one history to the next never passes through the pool.
+	Upscaler->AcquireState(NewState);
 	Upscaler->ReleaseState(Fsr3);
 	Fsr3 = NewState;
 }
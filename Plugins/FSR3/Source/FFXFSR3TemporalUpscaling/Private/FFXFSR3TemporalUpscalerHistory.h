@@ -39,6 +39,12 @@ struct FFXFSR3State : public FRHIResource
 	: FRHIResource(RRT_None)
 	, Backend(InBackend)
 	, LastUsedFrame(~0u)
+	, GpuMemoryUsage(0)
+	, PoolKey(0)
+	, PoolPrev(nullptr)
+	, PoolNext(nullptr)
+	, bPooled(false)
+	, NumHistories(0)
 	{
 	}
 	~FFXFSR3State()
@@ -66,6 +72,14 @@ struct FFXFSR3State : public FRHIResource
 	ffxContext Fsr3;
 	uint64 LastUsedFrame;
 	uint32 ViewID;
+
+	// Bookkeeping for the upscaler's pool of reusable states, only touched under its lock.
+	uint64 GpuMemoryUsage;
+	uint64 PoolKey;
+	FFXFSR3State* PoolPrev;
+	FFXFSR3State* PoolNext;
+	bool bPooled;
+	uint32 NumHistories;
 };
 typedef TRefCountPtr<FFXFSR3State> FSR3StateRef;
 
@@ -0,0 +1,253 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXFSR3StatePool.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	static constexpr uint64 MockMB = 1024 * 1024;
+
+	// Stands in for FFXFSR3State, which can't be created or destroyed without a backend.
+	struct FMockFSR3State : public FRefCountBase
+	{
+		FMockFSR3State(int32& InNumLive, uint64 InKey, uint64 InGpuMemoryUsage)
+		: NumLive(InNumLive)
+		, GpuMemoryUsage(InGpuMemoryUsage)
+		, PoolKey(InKey)
+		{
+			NumLive++;
+		}
+		~FMockFSR3State()
+		{
+			NumLive--;
+		}
+
+		int32& NumLive;
+		uint64 GpuMemoryUsage;
+		uint64 PoolKey;
+		FMockFSR3State* PoolPrev = nullptr;
+		FMockFSR3State* PoolNext = nullptr;
+		bool bPooled = false;
+		uint32 NumHistories = 0;
+	};
+	typedef TRefCountPtr<FMockFSR3State> FMockFSR3StateRef;
+	typedef TFFXFSR3StatePool<FMockFSR3State> FMockFSR3StatePool;
+
+	// Walks the pool's list and checks it against what the pool reports.
+	bool IsPoolConsistent(const FMockFSR3StatePool& Pool)
+	{
+		uint64 Memory = 0;
+		uint32 Count = 0;
+		for (FMockFSR3State* State = Pool.GetLeastRecentlyReleased(); State; State = State->PoolNext)
+		{
+			if (!State->bPooled || State->NumHistories != 0)
+			{
+				return false;
+			}
+			Memory += State->GpuMemoryUsage;
+			Count++;
+		}
+		return Memory == Pool.GetMemory() && Count == Pool.Num();
+	}
+}
+
+//-------------------------------------------------------------------------------------
+// States only enter the pool once their last history releases them, so the budget never evicts a state a view is using.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXFSR3StatePoolBudgetTest, "FidelityFX.FSR3.StatePool.InUseStatesOutsideBudget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXFSR3StatePoolBudgetTest::RunTest(const FString& Parameters)
+{
+	const uint64 Budget = 150 * MockMB;
+	int32 NumLive = 0;
+	FMockFSR3StatePool Pool;
+	uint32 NumEvicted = 0;
+
+	FMockFSR3StateRef A = new FMockFSR3State(NumLive, 1, 100 * MockMB);
+	FMockFSR3StateRef B = new FMockFSR3State(NumLive, 2, 100 * MockMB);
+	FMockFSR3State* RawA = A;
+	Pool.Acquire(A);
+	Pool.Acquire(B);
+
+	// Every frame the view's new history acquires the state before the previous history releases it.
+	for (int32 Frame = 0; Frame < 10; Frame++)
+	{
+		for (FMockFSR3State* State : { RawA, B.GetReference() })
+		{
+			Pool.Acquire(State);
+			NumEvicted += Pool.Release(State, Budget);
+		}
+	}
+	TestEqual(TEXT("States in use aren't pooled"), Pool.Num(), 0u);
+	TestEqual(TEXT("States in use don't count towards the budget"), Pool.GetMemory(), 0ull);
+	TestEqual(TEXT("States in use over the budget aren't evicted"), NumEvicted, 0u);
+
+	// Closing the views hands the states to the pool, the second one takes it over budget.
+	NumEvicted += Pool.Release(A, Budget);
+	A.SafeRelease();
+	TestEqual(TEXT("Released state is pooled"), Pool.Num(), 1u);
+	TestEqual(TEXT("Released state is within budget"), NumEvicted, 0u);
+	NumEvicted += Pool.Release(B, Budget);
+	TestEqual(TEXT("Least recently released state is evicted"), NumEvicted, 1u);
+	TestEqual(TEXT("Evicted state is destroyed"), NumLive, 1);
+	TestTrue(TEXT("Most recently released state is kept"), B->bPooled);
+	TestEqual(TEXT("Pool memory after eviction"), Pool.GetMemory(), 100 * MockMB);
+
+	// A new view with the same key picks the state up again, which takes it out of the pool.
+	FMockFSR3StatePool::StateBucket* Bucket = Pool.Find(2);
+	TestTrue(TEXT("Pooled state is found by its key"), Bucket && Bucket->Num() == 1);
+	FMockFSR3StateRef Reused;
+	if (Bucket)
+	{
+		Reused = (*Bucket)[0];
+		Pool.Remove(Reused);
+		Pool.Acquire(Reused);
+	}
+	TestEqual(TEXT("Reused state left the pool"), Pool.Num(), 0u);
+	TestTrue(TEXT("Reused state is the pooled one"), Reused == B);
+	TestTrue(TEXT("Pool is consistent"), IsPoolConsistent(Pool));
+
+	// The memory of a pooled state can still be updated.
+	NumEvicted += Pool.Release(Reused, 0);
+	Pool.SetMemoryUsage(Reused, 40 * MockMB);
+	TestEqual(TEXT("Pool memory follows the state's memory"), Pool.GetMemory(), 40 * MockMB);
+
+	Reused.SafeRelease();
+	B.SafeRelease();
+	Pool.Empty();
+	TestEqual(TEXT("Emptying the pool destroys the released states"), NumLive, 0);
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+// Views open, close, resize and render in a random order against a pool with a budget smaller than what the views use.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXFSR3StatePoolChurnTest, "FidelityFX.FSR3.StatePool.ViewChurn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FFXFSR3StatePoolChurnTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumFrames = 20000;
+	static constexpr int32 NumViews = 6;
+	static constexpr int32 NumDisplaySizes = 3;
+	static const uint64 DisplaySizeMemory[NumDisplaySizes] = { 60 * MockMB, 120 * MockMB, 240 * MockMB };
+	const uint64 Budget = 300 * MockMB;
+
+	FRandomStream Random(37);
+	int32 NumLive = 0;
+	FMockFSR3StatePool Pool;
+	FMockFSR3StateRef Histories[NumViews];
+	uint32 NumHits = 0;
+	uint32 NumMisses = 0;
+	uint32 NumEvictions = 0;
+	uint32 NumInconsistentFrames = 0;
+	uint64 PeakInUseMemory = 0;
+
+	auto GetState = [&](int32 View, int32 DisplaySize)
+	{
+		const uint64 Key = (uint64(View) << 32) | uint64(DisplaySize);
+		FMockFSR3StateRef State;
+		if (FMockFSR3StatePool::StateBucket* Bucket = Pool.Find(Key))
+		{
+			State = (*Bucket)[0];
+			Pool.Remove(State);
+			NumHits++;
+		}
+		else
+		{
+			State = new FMockFSR3State(NumLive, Key, DisplaySizeMemory[DisplaySize]);
+			NumMisses++;
+		}
+		return State;
+	};
+
+	auto SetHistory = [&](int32 View, FMockFSR3StateRef const& State)
+	{
+		Pool.Acquire(State);
+		NumEvictions += Pool.Release(Histories[View], Budget);
+		Histories[View] = State;
+	};
+
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		for (int32 View = 0; View < NumViews; View++)
+		{
+			if (!Histories[View])
+			{
+				if (Random.RandHelper(100) == 0)
+				{
+					SetHistory(View, GetState(View, Random.RandHelper(NumDisplaySizes)));
+				}
+			}
+			else if (Random.RandHelper(200) == 0)
+			{
+				SetHistory(View, nullptr);
+			}
+			else if (Random.RandHelper(300) == 0)
+			{
+				SetHistory(View, GetState(View, Random.RandHelper(NumDisplaySizes)));
+			}
+			else
+			{
+				SetHistory(View, Histories[View]);
+			}
+		}
+
+		uint64 InUseMemory = 0;
+		int32 NumInUse = 0;
+		bool bConsistent = IsPoolConsistent(Pool) && Pool.GetMemory() <= Budget;
+		for (const FMockFSR3StateRef& State : Histories)
+		{
+			if (State)
+			{
+				bConsistent &= !State->bPooled && State->NumHistories == 1;
+				InUseMemory += State->GpuMemoryUsage;
+				NumInUse++;
+			}
+		}
+		bConsistent &= NumLive == NumInUse + int32(Pool.Num());
+		NumInconsistentFrames += bConsistent ? 0 : 1;
+		PeakInUseMemory = FMath::Max(PeakInUseMemory, InUseMemory);
+	}
+
+	AddInfo(FString::Printf(TEXT("%u hits, %u misses, %u evictions, peak in use %llu MB against a %llu MB pool budget"), NumHits, NumMisses, NumEvictions, PeakInUseMemory / MockMB, Budget / MockMB));
+
+	TestEqual(TEXT("Frames where the pool was inconsistent, over budget or held a state in use"), NumInconsistentFrames, 0u);
+	TestTrue(TEXT("Views picked released states up again"), NumHits > 0);
+	TestTrue(TEXT("The budget evicted released states"), NumEvictions > 0);
+	TestTrue(TEXT("States in use went over the pool budget without being evicted"), PeakInUseMemory > Budget);
+
+	for (FMockFSR3StateRef& State : Histories)
+	{
+		Pool.Release(State, Budget);
+		State.SafeRelease();
+	}
+	Pool.Empty();
+	TestEqual(TEXT("Every state is destroyed"), NumLive, 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,155 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXFSR3TemporalUpscaler.h"
+#include "FFXFSR3Settings.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// How the passes for a view used to fetch their settings, one console variable read each on the render thread.
+	void ReadViewSettingsOnRenderThread(FFXFSR3ViewSettings& Settings)
+	{
+		Settings.Version = 0;
+		Settings.EnableFSR3 = CVarEnableFSR3.GetValueOnRenderThread();
+		Settings.AutoExposure = CVarFSR3AutoExposure.GetValueOnRenderThread();
+		Settings.HistoryFormat = CVarFSR3HistoryFormat.GetValueOnRenderThread();
+		Settings.CreateReactiveMask = CVarFSR3CreateReactiveMask.GetValueOnRenderThread();
+		Settings.DeDitherMode = CVarFSR3DeDitherMode.GetValueOnRenderThread();
+		Settings.QuantizeInternalTextures = CVarFSR3QuantizeInternalTextures.GetValueOnRenderThread();
+		Settings.UseExperimentalSSRDenoiser = CVarFSR3UseExperimentalSSRDenoiser.GetValueOnRenderThread();
+		Settings.CustomStencilMask = CVarFSR3CustomStencilMask.GetValueOnRenderThread();
+		Settings.CustomStencilShift = CVarFSR3CustomStencilShift.GetValueOnRenderThread();
+		Settings.ReactiveMaskRoughnessForceMaxDistance = CVarFSR3ReactiveMaskRoughnessForceMaxDistance.GetValueOnRenderThread();
+		Settings.ReactiveMaskReactiveShadingModelID = CVarFSR3ReactiveMaskReactiveShadingModelID.GetValueOnRenderThread();
+		Settings.ReactiveMaskPreDOFTranslucencyMax = CVarFSR3ReactiveMaskPreDOFTranslucencyMax.GetValueOnRenderThread();
+		Settings.Sharpness = CVarFSR3Sharpness.GetValueOnRenderThread();
+		Settings.ReactiveMaskReflectionScale = CVarFSR3ReactiveMaskReflectionScale.GetValueOnRenderThread();
+		Settings.ReactiveMaskRoughnessScale = CVarFSR3ReactiveMaskRoughnessScale.GetValueOnRenderThread();
+		Settings.ReactiveMaskRoughnessBias = CVarFSR3ReactiveMaskRoughnessBias.GetValueOnRenderThread();
+		Settings.ReactiveMaskRoughnessMaxDistance = CVarFSR3ReactiveMaskRoughnessMaxDistance.GetValueOnRenderThread();
+		Settings.ReactiveMaskReflectionLumaBias = CVarFSR3ReactiveMaskReflectionLumaBias.GetValueOnRenderThread();
+		Settings.ReactiveHistoryTranslucencyBias = CVarFSR3ReactiveHistoryTranslucencyBias.GetValueOnRenderThread();
+		Settings.ReactiveHistoryTranslucencyLumaBias = CVarFSR3ReactiveHistoryTranslucencyLumaBias.GetValueOnRenderThread();
+		Settings.ReactiveMaskTranslucencyBias = CVarFSR3ReactiveMaskTranslucencyBias.GetValueOnRenderThread();
+		Settings.ReactiveMaskTranslucencyLumaBias = CVarFSR3ReactiveMaskTranslucencyLumaBias.GetValueOnRenderThread();
+		Settings.ReactiveMaskTranslucencyMaxDistance = CVarFSR3ReactiveMaskTranslucencyMaxDistance.GetValueOnRenderThread();
+		Settings.ReactiveMaskForceReactiveMaterialValue = CVarFSR3ReactiveMaskForceReactiveMaterialValue.GetValueOnRenderThread();
+		Settings.ReactiveMaskPreDOFTranslucencyScale = CVarFSR3ReactiveMaskPreDOFTranslucencyScale.GetValueOnRenderThread();
+		Settings.ReactiveMaskCustomStencilScale = CVarFSR3ReactiveMaskCustomStencilScale.GetValueOnRenderThread();
+		Settings.ReactiveHistoryCustomStencilScale = CVarFSR3ReactiveHistoryCustomStencilScale.GetValueOnRenderThread();
+		Settings.ReactiveMaskDeferredDecalScale = CVarFSR3ReactiveMaskDeferredDecalScale.GetValueOnRenderThread();
+		Settings.ReactiveHistoryDeferredDecalScale = CVarFSR3ReactiveHistoryDeferredDecalScale.GetValueOnRenderThread();
+		Settings.ReactiveMaskTAAResponsiveValue = CVarFSR3ReactiveMaskTAAResponsiveValue.GetValueOnRenderThread();
+		Settings.ReactiveHistoryTAAResponsiveValue = CVarFSR3ReactiveHistoryTAAResponsiveValue.GetValueOnRenderThread();
+		Settings.VelocityFactor = CVarFSR3VelocityFactor.GetValueOnRenderThread();
+		Settings.ReactivenessScale = CVarFSR3ReactivenessScale.GetValueOnRenderThread();
+		Settings.ShadingChangeScale = CVarFSR3ShadingChangeScale.GetValueOnRenderThread();
+		Settings.AccumulationAddedPerFrame = CVarFSR3AccumulationAddedPerFrame.GetValueOnRenderThread();
+		Settings.MinDisocclusionAccumulation = CVarFSR3MinDisocclutionAccumulation.GetValueOnRenderThread();
+	}
+
+	// Touches every field the way the passes for a view would.
+	uint32 ConsumeViewSettings(FFXFSR3ViewSettings const& Settings)
+	{
+		uint32 Words[sizeof(FFXFSR3ViewSettings) / sizeof(uint32)];
+		FMemory::Memcpy(Words, &Settings, sizeof(Words));
+		uint32 Sum = 0;
+		for (uint32 Word : Words)
+		{
+			Sum = Sum * 31 + Word;
+		}
+		return Sum;
+	}
+}
+
+//-------------------------------------------------------------------------------------
+// Sets up four views per frame on the render thread, reading each console variable per view as the passes used to against copying
+// the snapshot the upscaler keeps for the render thread. Also times the console variable sink that captures the snapshot.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFXFSR3ViewSettingsBenchmark, "FidelityFX.FSR3.ViewSettings.FourViewSetupBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FFXFSR3ViewSettingsBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumFrames = 100000;
+	static constexpr int32 NumViews = 4;
+
+	// The sink runs on the game thread whenever any console variable changed.
+	FFXFSR3ViewSettings GameThreadSettings;
+	GameThreadSettings.Capture();
+	uint32 NumChanged = 0;
+	double const SinkStart = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		FFXFSR3ViewSettings Settings;
+		Settings.Capture();
+		NumChanged += Settings.Equals(GameThreadSettings) ? 0 : 1;
+	}
+	double const SinkSeconds = FPlatformTime::Seconds() - SinkStart;
+
+	FFXFSR3ViewSettings RenderThreadSettings = GameThreadSettings;
+	double PerCVarSeconds = 0.0;
+	double SnapshotSeconds = 0.0;
+	uint32 PerCVarSum = 0;
+	uint32 SnapshotSum = 0;
+	ENQUEUE_RENDER_COMMAND(FFXFSR3ViewSettingsBenchmark)([&](FRHICommandListImmediate& RHICmdList)
+	{
+		double Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			for (int32 View = 0; View < NumViews; View++)
+			{
+				FFXFSR3ViewSettings Settings;
+				ReadViewSettingsOnRenderThread(Settings);
+				PerCVarSum += ConsumeViewSettings(Settings);
+			}
+		}
+		PerCVarSeconds = FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			for (int32 View = 0; View < NumViews; View++)
+			{
+				FFXFSR3ViewSettings const Settings = RenderThreadSettings;
+				SnapshotSum += ConsumeViewSettings(Settings);
+			}
+		}
+		SnapshotSeconds = FPlatformTime::Seconds() - Start;
+	});
+	FlushRenderingCommands();
+
+	double const NumSetups = double(NumFrames) * NumViews;
+	AddInfo(FString::Printf(TEXT("Per view setup: %.1f ns reading each console variable, %.1f ns copying the snapshot"), PerCVarSeconds * 1e9 / NumSetups, SnapshotSeconds * 1e9 / NumSetups));
+	AddInfo(FString::Printf(TEXT("Console variable sink: %.1f ns per capture and compare"), SinkSeconds * 1e9 / NumFrames));
+
+	// Nothing changes the console variables meanwhile, so both paths see the same values.
+	TestEqual(TEXT("Captures that differed from the first one"), NumChanged, 0u);
+	TestEqual(TEXT("Both paths read the same settings"), SnapshotSum, PerCVarSum);
+
+	return true;
+}
+
+#endif
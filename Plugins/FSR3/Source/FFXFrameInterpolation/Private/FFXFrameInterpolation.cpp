@@ -24,6 +24,7 @@
 #include "FFXSharedBackend.h"
 #include "FFXFrameInterpolationSlate.h"
 #include "FFXFrameInterpolationCustomPresent.h"
+#include "LogFFXFrameInterpolation.h"
 #include "FFXFSR3Settings.h"
 #include "FFXRDGBuilder.h"
 
@@ -66,6 +67,21 @@ extern ENGINE_API float GAverageMS;
 #define GFrameCounterRenderThread GFrameNumberRenderThread
 #endif
 
+//------------------------------------------------------------------------------------------------------
+// Windowed frame time statistics, game frames are timed as their back buffers become ready & present frames include the interpolated ones.
+//------------------------------------------------------------------------------------------------------
+DECLARE_STATS_GROUP(TEXT("FFXFrameInterpolation"), STATGROUP_FFXFrameInterpolation, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FFXFI: Game frame time p50 (ms)"), STAT_FFXFIGameFrameTimeP50, STATGROUP_FFXFrameInterpolation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FFXFI: Game frame time p95 (ms)"), STAT_FFXFIGameFrameTimeP95, STATGROUP_FFXFrameInterpolation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FFXFI: Game frame time p99 (ms)"), STAT_FFXFIGameFrameTimeP99, STATGROUP_FFXFrameInterpolation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FFXFI: Present frame time p50 (ms)"), STAT_FFXFIPresentFrameTimeP50, STATGROUP_FFXFrameInterpolation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FFXFI: Present frame time p95 (ms)"), STAT_FFXFIPresentFrameTimeP95, STATGROUP_FFXFrameInterpolation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FFXFI: Present frame time p99 (ms)"), STAT_FFXFIPresentFrameTimeP99, STATGROUP_FFXFrameInterpolation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FFXFI: Present frame time std. dev. (ms)"), STAT_FFXFIPresentFrameTimeStdDev, STATGROUP_FFXFrameInterpolation);
+
+// One second of samples, long enough for the tail percentiles to be meaningful at typical frame rates.
+static constexpr double FFXFrameTimeWindowSeconds = 1.0;
+
 //------------------------------------------------------------------------------------------------------
 // Input declaration for the frame interpolation pass.
 //------------------------------------------------------------------------------------------------------
@@ -186,7 +202,8 @@ inline void TransitionAndCopyTexture(FRHICommandList& RHICmdList, FRHITexture* S
 //------------------------------------------------------------------------------------------------------
 FFXFrameInterpolation::FFXFrameInterpolation()
 : GameDeltaTime(0.0)
-, LastTime(FPlatformTime::Seconds())
+, GameFrameTimes(FFXFrameTimeWindowSeconds)
+, PresentFrameTimes(FFXFrameTimeWindowSeconds)
 , AverageTime(0.f)
 , AverageFPS(0.f)
 , InterpolationCount(0llu)
@@ -285,16 +302,55 @@ void FFXFrameInterpolation::CalculateFPSTimings()
 	FFXFrameInterpolationCustomPresent* Presenter = ViewportRHI.IsValid() ? (FFXFrameInterpolationCustomPresent*)ViewportRHI->GetCustomPresent() : nullptr;
 	if (CVarEnableFFXFI.GetValueOnAnyThread() != 0 && Presenter && Presenter->GetMode() == EFFXFrameInterpolationPresentModeRHI)
 	{
-		double CurrentTime = FPlatformTime::Seconds();
-		float FrameTimeMS = (float)((CurrentTime - LastTime) * 1000.0);
-		AverageTime = AverageTime * 0.75f + FrameTimeMS * 0.25f;
-		LastTime = CurrentTime;
-		AverageFPS = 1000.f / AverageTime;
+		PresentFrameTimes.AddTimestamp(FPlatformTime::Seconds());
+		if (PresentFrameTimes.GetNumSamples() > 0)
+		{
+			AverageTime = PresentFrameTimes.GetMeanMs();
+			AverageFPS = 1000.f / AverageTime;
+
+			// Until the window has a sample again AverageTime still holds the value from before interpolation was turned off.
+			if (CVarFFXFIUpdateGlobalFrameTime.GetValueOnAnyThread() != 0)
+			{
+				GAverageMS = AverageTime;
+				GAverageFPS = AverageFPS;
+			}
+		}
+
+		SET_FLOAT_STAT(STAT_FFXFIPresentFrameTimeP50, PresentFrameTimes.GetP50Ms());
+		SET_FLOAT_STAT(STAT_FFXFIPresentFrameTimeP95, PresentFrameTimes.GetP95Ms());
+		SET_FLOAT_STAT(STAT_FFXFIPresentFrameTimeP99, PresentFrameTimes.GetP99Ms());
+		SET_FLOAT_STAT(STAT_FFXFIPresentFrameTimeStdDev, FMath::Sqrt(PresentFrameTimes.GetVarianceMs()));
+	}
+	else if (PresentFrameTimes.HasTimestamp())
+	{
+		// Start over when interpolation comes back so the frames from before it was turned off don't count.
+		PresentFrameTimes.Reset();
+	}
+}
 
-		if (CVarFFXFIUpdateGlobalFrameTime.GetValueOnAnyThread() != 0)
+void FFXFrameInterpolation::UpdateSlateRenderer(bool bForceWrapper)
+{
+	if (SlateRendererWrapper.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplicationBase& BaseApp = static_cast<FSlateApplicationBase&>(FSlateApplication::Get());
+		FFXSlateApplication& Accessor = (FFXSlateApplication&)BaseApp;
+		TSharedPtr<FSlateRenderer>* Ptr = Accessor.GetRendererRef();
+		TSharedPtr<FSlateRenderer> const& UnderlyingRenderer = SlateRendererWrapper->GetUnderlyingRenderer();
+
+		// Leave the renderer alone if something else has replaced it since it was wrapped.
+		bool const bWrapperActive = (Ptr->Get() == SlateRendererWrapper.Get());
+		if (bWrapperActive || (Ptr->Get() == UnderlyingRenderer.Get()))
 		{
-			GAverageMS = AverageTime;
-			GAverageFPS = AverageFPS;
+			// The wrapper only exists to give Slate enough draw buffers to render the UI for both the real and the interpolated frame.
+			// While interpolation is disabled the engine renderer can be called directly, the delegate thunks stay bound to it so listeners are unaffected.
+			bool const bWantWrapper = bForceWrapper || (CVarEnableFFXFI.GetValueOnGameThread() != 0) || (CVarFFXFISlateRendererFastPath.GetValueOnGameThread() == 0);
+			if (bWantWrapper != bWrapperActive)
+			{
+				// Swap between Slate ticks once the render thread has consumed any draw buffers acquired from the outgoing renderer.
+				FlushRenderingCommands();
+				*Ptr = bWantWrapper ? TSharedPtr<FSlateRenderer>(SlateRendererWrapper) : UnderlyingRenderer;
+				UE_LOG(LogFFXFI, Verbose, TEXT("%s the Frame Interpolation Slate renderer"), bWantWrapper ? TEXT("Installed") : TEXT("Bypassed"));
+			}
 		}
 	}
 }
@@ -313,6 +369,7 @@ void FFXFrameInterpolation::OnPostEngineInit()
 			auto SharedRef = Ptr->ToSharedRef();
 			TSharedRef<FFXFrameInterpolationSlateRenderer> RendererWrapper = MakeShared<FFXFrameInterpolationSlateRenderer>(SharedRef);
 			App.InitializeRenderer(RendererWrapper, true);
+			SlateRendererWrapper = RendererWrapper;
 		}
 		
 		FSlateRenderer* SlateRenderer = App.GetRenderer();
@@ -321,8 +378,17 @@ void FFXFrameInterpolation::OnPostEngineInit()
 		GEngine->GetPostRenderDelegateEx().AddRaw(const_cast<FFXFrameInterpolation*>(this), &FFXFrameInterpolation::InterpolateFrame);
 
 		FFXFrameInterpolation* Self = this;
+		App.OnPreShutdown().AddLambda([Self]()
+		{
+			// Hand Slate back the renderer it was running with before shutdown so it is destroyed through the usual path.
+			Self->UpdateSlateRenderer(true);
+			Self->SlateRendererWrapper.Reset();
+		});
+
 		FCoreDelegates::OnBeginFrame.AddLambda([Self]()
 		{
+			Self->UpdateSlateRenderer(false);
+
 			ENQUEUE_RENDER_COMMAND(BeginFrameRT)([Self](FRHICommandListImmediate& RHICmdList)
 			{
 				Self->CalculateFPSTimings();
@@ -1290,12 +1356,22 @@ void FFXFrameInterpolation::OnBackBufferReadyToPresentCallback(class SWindow& Sl
 
 	if (Presenter && CVarEnableFFXFI.GetValueOnAnyThread())
 	{
+		GameFrameTimes.AddTimestamp(FPlatformTime::Seconds());
+		SET_FLOAT_STAT(STAT_FFXFIGameFrameTimeP50, GameFrameTimes.GetP50Ms());
+		SET_FLOAT_STAT(STAT_FFXFIGameFrameTimeP95, GameFrameTimes.GetP95Ms());
+		SET_FLOAT_STAT(STAT_FFXFIGameFrameTimeP99, GameFrameTimes.GetP99Ms());
+
 		PresentCount += (Presenter->GetMode() == EFFXFrameInterpolationPresentModeNative) ? 1llu : 0llu;
 		if (ResetState)
 		{
 			Presenter->CopyBackBufferRT(BackBuffer);
 		}
 	}
+	else if (!CVarEnableFFXFI.GetValueOnAnyThread() && GameFrameTimes.HasTimestamp())
+	{
+		// Windows without a presenter don't feed the window, only turning interpolation off restarts it.
+		GameFrameTimes.Reset();
+	}
 
 	bInterpolatedFrame = false;
 }
\ No newline at end of file
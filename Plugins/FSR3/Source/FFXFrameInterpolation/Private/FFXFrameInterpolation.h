@@ -25,6 +25,7 @@
 #include "SceneViewExtension.h"
 
 #include "IFFXFrameInterpolation.h"
+#include "FFXFrameTimeWindow.h"
 
 //-------------------------------------------------------------------------------------
 // Forward declarations.
@@ -34,6 +35,7 @@ class SWindow;
 class FViewport;
 class FFXFrameInterpolationViewExtension;
 class FFXFrameInterpolationCustomPresent;
+class FFXFrameInterpolationSlateRenderer;
 struct FfxFrameInterpolationContext;
 
 //-------------------------------------------------------------------------------------
@@ -60,6 +62,9 @@ public:
 	IFFXFrameInterpolationCustomPresent* CreateCustomPresent(IFFXSharedBackend* Backend, uint32_t Flags, FIntPoint RenderSize, FIntPoint DisplaySize, FfxSwapchain RawSwapChain, FfxCommandQueue Queue, FfxApiSurfaceFormat Format, EFFXBackendAPI Api) final;
 	bool GetAverageFrameTimes(float& AvgTimeMs, float& AvgFPS) final;
 
+	// Installed in place of the engine's Slate renderer while Frame Interpolation is enabled, invalid before OnPostEngineInit.
+	TSharedPtr<FFXFrameInterpolationSlateRenderer> const& GetSlateRendererWrapper() const { return SlateRendererWrapper; }
+
 private:
 	struct FFXFrameInterpolationView
 	{
@@ -77,16 +82,19 @@ private:
 		bool bEnabled;
 	};
 	void CalculateFPSTimings();
+	void UpdateSlateRenderer(bool bForceWrapper);
 	bool InterpolateView(FRDGBuilder& GraphBuilder, FFXFrameInterpolationCustomPresent* Presenter, const FSceneView* View, FFXFrameInterpolationView const& ViewDesc, FRDGTextureRef FinalBuffer, FRDGTextureRef InterpolatedRDG, FRDGTextureRef BackBufferRDG, uint32 Index);
 	TMap<const FSceneView*, FFXFrameInterpolationView> Views;
 	TSharedPtr<FFXFrameInterpolationViewExtension, ESPMode::ThreadSafe> ViewExtension;
+	TSharedPtr<FFXFrameInterpolationSlateRenderer> SlateRendererWrapper;
     TRefCountPtr<IPooledRenderTarget> BackBufferRT;
 	TRefCountPtr<IPooledRenderTarget> InterpolatedRT;
 	TRefCountPtr<IPooledRenderTarget> AsyncBufferRT[2];
 	TMap<FfxSwapchain, FFXFrameInterpolationCustomPresent*> SwapChains;
 	TMap<SWindow*, FRHIViewport*> Windows;
 	float GameDeltaTime;
-	double LastTime;
+	FFXFrameTimeWindow GameFrameTimes;
+	FFXFrameTimeWindow PresentFrameTimes;
 	float AverageTime;
 	float AverageFPS;
 	uint64 InterpolationCount;
@@ -57,6 +57,9 @@ public:
 	FFXFrameInterpolationSlateRenderer(TSharedRef<FSlateRenderer> InUnderlyingRenderer);
 	virtual ~FFXFrameInterpolationSlateRenderer();
 
+	/** Returns the engine renderer that this wraps, which can be installed directly while Frame Interpolation is disabled */
+	TSharedPtr<FSlateRenderer> const& GetUnderlyingRenderer() const { return UnderlyingRenderer; }
+
 #if UE_VERSION_AT_LEAST(5, 1, 0)
 	/** Returns a draw buffer that can be used by Slate windows to draw window elements */
 	virtual FSlateDrawBuffer& AcquireDrawBuffer();
@@ -0,0 +1,115 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXFrameTimeWindow.h"
+
+FFXFrameTimeWindow::FFXFrameTimeWindow(double InWindowSeconds)
+: WindowSeconds(InWindowSeconds)
+{
+	Reset();
+}
+
+void FFXFrameTimeWindow::Reset()
+{
+	FMemory::Memzero(Bins);
+	LastTimestamp = 0.0;
+	SumMs = 0.0;
+	SumSquaredMs = 0.0;
+	First = 0;
+	Count = 0;
+
+	NumSamples.store(0, std::memory_order_relaxed);
+	MeanMs.store(0.f, std::memory_order_relaxed);
+	VarianceMs.store(0.f, std::memory_order_relaxed);
+	P50Ms.store(0.f, std::memory_order_relaxed);
+	P95Ms.store(0.f, std::memory_order_relaxed);
+	P99Ms.store(0.f, std::memory_order_relaxed);
+}
+
+uint32 FFXFrameTimeWindow::GetBin(float FrameTimeMs)
+{
+	float const Octaves = FMath::Log2(FMath::Max(FrameTimeMs, MinBinMs) / MinBinMs);
+	return FMath::Min((uint32)(Octaves * BinsPerOctave), NumBins - 1);
+}
+
+float FFXFrameTimeWindow::GetBinCenter(uint32 Bin)
+{
+	return MinBinMs * FMath::Pow(2.f, ((float)Bin + 0.5f) / (float)BinsPerOctave);
+}
+
+float FFXFrameTimeWindow::FindPercentile(float Percentile) const
+{
+	// The rank of the requested sample, counting from 1 so that p100 is the largest sample.
+	uint32 const Rank = FMath::Max((uint32)FMath::CeilToInt(Percentile * (float)Count), 1u);
+	uint32 Total = 0;
+	for (uint32 Bin = 0; Bin < NumBins; Bin++)
+	{
+		Total += Bins[Bin];
+		if (Total >= Rank)
+		{
+			return GetBinCenter(Bin);
+		}
+	}
+	return 0.f;
+}
+
+void FFXFrameTimeWindow::RetireOldest()
+{
+	FSample const& Sample = Samples[First];
+	SumMs -= Sample.FrameTimeMs;
+	SumSquaredMs -= (double)Sample.FrameTimeMs * (double)Sample.FrameTimeMs;
+	Bins[Sample.Bin]--;
+	First = (First + 1) % Capacity;
+	Count--;
+}
+
+void FFXFrameTimeWindow::AddTimestamp(double Seconds)
+{
+	if (LastTimestamp > 0.0 && (Seconds - LastTimestamp) > WindowSeconds)
+	{
+		Reset();
+	}
+	else if (LastTimestamp > 0.0 && Seconds > LastTimestamp)
+	{
+		while (Count > 0 && (Count == Capacity || (Seconds - Samples[First].Timestamp) > WindowSeconds))
+		{
+			RetireOldest();
+		}
+
+		FSample& Sample = Samples[(First + Count) % Capacity];
+		Sample.Timestamp = Seconds;
+		Sample.FrameTimeMs = (float)((Seconds - LastTimestamp) * 1000.0);
+		Sample.Bin = GetBin(Sample.FrameTimeMs);
+		SumMs += Sample.FrameTimeMs;
+		SumSquaredMs += (double)Sample.FrameTimeMs * (double)Sample.FrameTimeMs;
+		Bins[Sample.Bin]++;
+		Count++;
+
+		double const Mean = SumMs / Count;
+		NumSamples.store(Count, std::memory_order_relaxed);
+		MeanMs.store((float)Mean, std::memory_order_relaxed);
+		VarianceMs.store((float)FMath::Max(SumSquaredMs / Count - Mean * Mean, 0.0), std::memory_order_relaxed);
+		P50Ms.store(FindPercentile(0.50f), std::memory_order_relaxed);
+		P95Ms.store(FindPercentile(0.95f), std::memory_order_relaxed);
+		P99Ms.store(FindPercentile(0.99f), std::memory_order_relaxed);
+	}
+	LastTimestamp = Seconds;
+}
@@ -0,0 +1,86 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+//-------------------------------------------------------------------------------------
+// Windowed frame time statistics over a ring of timestamped samples.
+// Samples older than the window, or beyond the ring capacity, are retired as new ones arrive so mean & variance are kept as running sums.
+// A gap between timestamps longer than the window is a pause in the frames, e.g. while interpolation was off, so it restarts the window instead of becoming a sample.
+// Percentiles come from a log-scale histogram of the samples in the window covering 0.25ms to 256ms, with 16 bins per octave which bounds the error to ~2%.
+// A single thread adds timestamps, the results are published through atomics so any thread may query them without locking.
+//-------------------------------------------------------------------------------------
+class FFXFrameTimeWindow
+{
+public:
+	static constexpr uint32 Capacity = 512;
+	static constexpr uint32 BinsPerOctave = 16;
+	static constexpr uint32 NumBins = BinsPerOctave * 10;
+	static constexpr float MinBinMs = 0.25f;
+
+	FFXFrameTimeWindow(double InWindowSeconds);
+
+	void Reset();
+	void AddTimestamp(double Seconds);
+
+	// Only meaningful on the thread adding timestamps.
+	bool HasTimestamp() const { return LastTimestamp > 0.0; }
+
+	uint32 GetNumSamples() const { return NumSamples.load(std::memory_order_relaxed); }
+	float GetMeanMs() const { return MeanMs.load(std::memory_order_relaxed); }
+	float GetVarianceMs() const { return VarianceMs.load(std::memory_order_relaxed); }
+	float GetP50Ms() const { return P50Ms.load(std::memory_order_relaxed); }
+	float GetP95Ms() const { return P95Ms.load(std::memory_order_relaxed); }
+	float GetP99Ms() const { return P99Ms.load(std::memory_order_relaxed); }
+
+private:
+	struct FSample
+	{
+		double Timestamp;
+		float FrameTimeMs;
+		uint32 Bin;
+	};
+
+	static uint32 GetBin(float FrameTimeMs);
+	static float GetBinCenter(uint32 Bin);
+	float FindPercentile(float Percentile) const;
+	void RetireOldest();
+
+	FSample Samples[Capacity];
+	uint32 Bins[NumBins];
+	double WindowSeconds;
+	double LastTimestamp;
+	double SumMs;
+	double SumSquaredMs;
+	uint32 First;
+	uint32 Count;
+
+	std::atomic<uint32> NumSamples;
+	std::atomic<float> MeanMs;
+	std::atomic<float> VarianceMs;
+	std::atomic<float> P50Ms;
+	std::atomic<float> P95Ms;
+	std::atomic<float> P99Ms;
+};
@@ -0,0 +1,128 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "RenderTargetPool.h"
+#include "RenderingThread.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//-------------------------------------------------------------------------------------
+// Resizes several windows the way Frame Interpolation reallocates its back buffer copies, a pair of targets per window
+// requested from GRenderTargetPool whenever the size changes, and reports how many new targets that costs & the peak pool memory.
+// One window resizes now and then, one flips between two sizes every third frame, one is dragged through every size and one is closed & reopened.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXFrameInterpolationResizeStressTest, "FidelityFX.FrameInterpolation.MultiWindowResizeStress", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FFFXFrameInterpolationResizeStressTest::RunTest(const FString& Parameters)
+{
+	static constexpr uint32 NumWindows = 4;
+	static constexpr uint32 NumTargetsPerWindow = 2;
+	static constexpr uint32 NumFrames = 3000;
+	static const FIntPoint Sizes[] = { FIntPoint(1280, 720), FIntPoint(1600, 900), FIntPoint(1920, 1080), FIntPoint(2560, 1440) };
+	static constexpr uint32 NumSizes = UE_ARRAY_COUNT(Sizes);
+
+	uint32 NumRequests = 0;
+	uint32 NumAllocations = 0;
+	uint64 PeakPoolKB = 0;
+	uint64 PeakHeldMemory = 0;
+	bool bDescsMatch = true;
+
+	ENQUEUE_RENDER_COMMAND(FFXFrameInterpolationResizeStressTest)([&](FRHICommandListImmediate& RHICmdList)
+	{
+#if UE_VERSION_AT_LEAST(5, 0, 0)
+		ETextureCreateFlags DescFlags = TexCreate_UAV;
+#else
+		ETextureCreateFlags DescFlags = TexCreate_None;
+#endif
+		FRandomStream Random(40);
+		TRefCountPtr<IPooledRenderTarget> Targets[NumWindows][NumTargetsPerWindow];
+		uint32 WindowSizes[NumWindows] = { 2, 0, 0, 2 };
+
+		uint32 WholeCount, WholePoolKB, UsedKB;
+		GRenderTargetPool.GetStats(WholeCount, WholePoolKB, UsedKB);
+		uint32 const BasePoolKB = WholePoolKB;
+
+		for (uint32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			WindowSizes[0] = (Random.RandHelper(100) == 0) ? Random.RandHelper(NumSizes) : WindowSizes[0];
+			WindowSizes[1] = ((Frame % 3) == 0) ? (WindowSizes[1] ^ 1) : WindowSizes[1];
+			WindowSizes[2] = (Frame / 10) % NumSizes;
+			bool const bWindow3Open = ((Frame / 500) % 2) == 0;
+
+			uint64 HeldMemory = 0;
+			for (uint32 Window = 0; Window < NumWindows; Window++)
+			{
+				for (TRefCountPtr<IPooledRenderTarget>& Target : Targets[Window])
+				{
+					if (Window == 3 && !bWindow3Open)
+					{
+						Target.SafeRelease();
+						continue;
+					}
+
+					FIntPoint const Size = Sizes[WindowSizes[Window]];
+					if (!IsValidRef(Target) || Target->GetDesc().Extent != Size)
+					{
+						FPooledRenderTargetDesc Desc(FPooledRenderTargetDesc::Create2DDesc(Size, PF_B8G8R8A8, FClearValueBinding::Transparent, DescFlags, TexCreate_UAV | TexCreate_ShaderResource, false, 1, true, true));
+
+						uint32 CountBefore;
+						GRenderTargetPool.GetStats(CountBefore, WholePoolKB, UsedKB);
+						GRenderTargetPool.FindFreeElement(RHICmdList, Desc, Target, TEXT("FFXFIResizeStressTest"));
+						GRenderTargetPool.GetStats(WholeCount, WholePoolKB, UsedKB);
+
+						NumRequests++;
+						NumAllocations += (WholeCount > CountBefore) ? 1 : 0;
+						PeakPoolKB = FMath::Max(PeakPoolKB, (uint64)WholePoolKB - FMath::Min(WholePoolKB, BasePoolKB));
+						bDescsMatch &= (Target->GetDesc().Extent == Size) && (Target->GetDesc().Format == PF_B8G8R8A8);
+					}
+					HeldMemory += Target->ComputeMemorySize();
+				}
+			}
+			PeakHeldMemory = FMath::Max(PeakHeldMemory, HeldMemory);
+		}
+
+		// Left to GRenderTargetPool to free once they go unused.
+		for (auto& WindowTargets : Targets)
+		{
+			for (TRefCountPtr<IPooledRenderTarget>& Target : WindowTargets)
+			{
+				Target.SafeRelease();
+			}
+		}
+	});
+	FlushRenderingCommands();
+
+	AddInfo(FString::Printf(TEXT("%u windows over %u frames: %u target requests, %u new targets"), NumWindows, NumFrames, NumRequests, NumAllocations));
+	AddInfo(FString::Printf(TEXT("Peak memory: %.1f MB held by the windows, %.1f MB of render target pool growth"), (double)PeakHeldMemory / (1024.0 * 1024.0), (double)PeakPoolKB / 1024.0));
+
+	TestTrue(TEXT("Every request gets a target of the requested size & format"), bDescsMatch);
+	// Unused targets are recycled, so at worst every window holds a pair of every size.
+	TestTrue(TEXT("Resizing reuses the targets windows have released"), NumAllocations <= NumWindows * NumTargetsPerWindow * NumSizes);
+	TestTrue(TEXT("Resizing requests targets"), NumRequests > NumAllocations);
+
+	return true;
+}
+
+#endif
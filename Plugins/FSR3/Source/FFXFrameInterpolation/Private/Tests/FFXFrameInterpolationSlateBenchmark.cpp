@@ -0,0 +1,99 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXFrameInterpolation.h"
+#include "FFXFrameInterpolationModule.h"
+#include "FFXFrameInterpolationSlate.h"
+#include "Brushes/SlateColorBrush.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Modules/ModuleManager.h"
+#include "Rendering/DrawElements.h"
+#include "Widgets/SWindow.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && UE_VERSION_AT_LEAST(5, 1, 0)
+
+//-------------------------------------------------------------------------------------
+// Acquires a Slate draw buffer, fills it with 5,000 widgets & releases it, once through the Frame Interpolation wrapper and once through
+// the engine renderer it wraps, which is what Slate calls while interpolation is off. Rendering commands are flushed between frames outside the timing.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXFrameInterpolationSlateBenchmark, "FidelityFX.FrameInterpolation.SlateDrawBufferBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FFFXFrameInterpolationSlateBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr uint32 NumWidgets = 5000;
+	static constexpr uint32 NumLayers = 32;
+	static constexpr uint32 NumFrames = 500;
+	static constexpr uint32 NumPasses = 5;
+
+	IFFXFrameInterpolationModule* Module = FModuleManager::GetModulePtr<IFFXFrameInterpolationModule>(TEXT("FFXFrameInterpolation"));
+	FFXFrameInterpolation* FrameInterpolation = Module ? (FFXFrameInterpolation*)Module->GetImpl() : nullptr;
+	if (!FrameInterpolation || !FrameInterpolation->GetSlateRendererWrapper().IsValid())
+	{
+		AddWarning(TEXT("The Frame Interpolation Slate renderer is not installed."));
+		return true;
+	}
+
+	FFXFrameInterpolationSlateRenderer& Wrapper = *FrameInterpolation->GetSlateRendererWrapper();
+	FSlateRenderer& Engine = *Wrapper.GetUnderlyingRenderer();
+
+	TSharedRef<SWindow> Window = SNew(SWindow).ClientSize(FVector2D(1920, 1080));
+	FGeometry const Geometry = FGeometry::MakeRoot(FVector2D(16, 16), FSlateLayoutTransform());
+	FSlateColorBrush const Brush(FLinearColor::White);
+
+	auto Run = [&](FSlateRenderer& Renderer)
+	{
+		double BestSeconds = MAX_dbl;
+		for (uint32 Pass = 0; Pass < NumPasses; Pass++)
+		{
+			double Seconds = 0.0;
+			for (uint32 Frame = 0; Frame < NumFrames; Frame++)
+			{
+				double const Start = FPlatformTime::Seconds();
+				FSlateDrawBuffer& Buffer = Renderer.AcquireDrawBuffer();
+				FSlateWindowElementList& Elements = Buffer.AddWindowElementList(Window);
+				for (uint32 Widget = 0; Widget < NumWidgets; Widget++)
+				{
+					FSlateDrawElement::MakeBox(Elements, Widget % NumLayers, Geometry.ToPaintGeometry(), &Brush);
+				}
+				Renderer.ReleaseDrawBuffer(Buffer);
+				Seconds += FPlatformTime::Seconds() - Start;
+
+				// Hands the buffer back before the next frame so neither renderer has to block on one.
+				Renderer.FlushCommands();
+			}
+			BestSeconds = FMath::Min(BestSeconds, Seconds / NumFrames);
+		}
+		return BestSeconds * 1000000.0;
+	};
+
+	double const WrappedUs = Run(Wrapper);
+	double const EngineUs = Run(Engine);
+
+	AddInfo(FString::Printf(TEXT("%u widgets, best of %u x %u frames: wrapper %.1f us/frame, engine renderer %.1f us/frame (%+.1f%%)"),
+		NumWidgets, NumPasses, NumFrames, WrappedUs, EngineUs, (WrappedUs - EngineUs) * 100.0 / EngineUs));
+
+	TestTrue(TEXT("Both renderers were timed"), WrappedUs > 0.0 && EngineUs > 0.0);
+
+	return true;
+}
+
+#endif
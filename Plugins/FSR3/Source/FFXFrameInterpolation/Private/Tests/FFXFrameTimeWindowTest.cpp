@@ -0,0 +1,121 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXFrameTimeWindow.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//-------------------------------------------------------------------------------------
+// Feeds the window from a simulated clock: steady 60Hz frames, a pause longer than the window as when interpolation is
+// turned off and back on, a pause within the window, a full ring and noisy frame times checked against sorted percentiles.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXFrameTimeWindowTest, "FidelityFX.FrameInterpolation.FrameTimeWindow", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FFFXFrameTimeWindowTest::RunTest(const FString& Parameters)
+{
+	double const FrameSeconds = 1.0 / 60.0;
+	FFXFrameTimeWindow Window(1.0);
+	double Now = 10.0;
+
+	// The first timestamp only starts the clock.
+	Window.AddTimestamp(Now);
+	TestEqual(TEXT("First timestamp adds no sample"), Window.GetNumSamples(), 0u);
+
+	for (uint32 Frame = 0; Frame < 120; Frame++)
+	{
+		Now += FrameSeconds;
+		Window.AddTimestamp(Now);
+	}
+	TestTrue(TEXT("Samples older than the window are retired"), Window.GetNumSamples() >= 59u && Window.GetNumSamples() <= 61u);
+	TestEqual(TEXT("Steady 60Hz mean"), Window.GetMeanMs(), 16.667f, 0.01f);
+	TestEqual(TEXT("Steady 60Hz variance"), Window.GetVarianceMs(), 0.f, 0.01f);
+	TestEqual(TEXT("Steady 60Hz p50"), Window.GetP50Ms(), 16.667f, 16.667f * 0.03f);
+	TestEqual(TEXT("Steady 60Hz p99"), Window.GetP99Ms(), 16.667f, 16.667f * 0.03f);
+
+	// A pause longer than the window must not turn into a 5000ms frame.
+	Now += 5.0;
+	Window.AddTimestamp(Now);
+	TestEqual(TEXT("Long pause clears the window"), Window.GetNumSamples(), 0u);
+	TestEqual(TEXT("Long pause clears the mean"), Window.GetMeanMs(), 0.f);
+	TestTrue(TEXT("Long pause keeps the clock running"), Window.HasTimestamp());
+	for (uint32 Frame = 0; Frame < 10; Frame++)
+	{
+		Now += FrameSeconds;
+		Window.AddTimestamp(Now);
+	}
+	TestEqual(TEXT("Frames after a long pause are counted from it"), Window.GetNumSamples(), 10u);
+	TestEqual(TEXT("Mean after a long pause"), Window.GetMeanMs(), 16.667f, 0.01f);
+	TestEqual(TEXT("p99 after a long pause"), Window.GetP99Ms(), 16.667f, 16.667f * 0.03f);
+
+	// A hitch within the window is a real frame.
+	Now += 0.1;
+	Window.AddTimestamp(Now);
+	TestEqual(TEXT("Hitch within the window is a sample"), Window.GetNumSamples(), 11u);
+	TestEqual(TEXT("Hitch is the p99"), Window.GetP99Ms(), 100.f, 100.f * 0.03f);
+
+	Window.Reset();
+	TestEqual(TEXT("Reset clears the samples"), Window.GetNumSamples(), 0u);
+	TestEqual(TEXT("Reset clears the p50"), Window.GetP50Ms(), 0.f);
+	TestFalse(TEXT("Reset stops the clock"), Window.HasTimestamp());
+	Now += 0.5;
+	Window.AddTimestamp(Now);
+	TestEqual(TEXT("Timestamp after a reset only starts the clock"), Window.GetNumSamples(), 0u);
+
+	// 1000Hz fills the ring well within the window.
+	for (uint32 Frame = 0; Frame < FFXFrameTimeWindow::Capacity * 2; Frame++)
+	{
+		Now += 0.001;
+		Window.AddTimestamp(Now);
+	}
+	TestEqual(TEXT("Ring holds at most its capacity"), Window.GetNumSamples(), FFXFrameTimeWindow::Capacity);
+	TestEqual(TEXT("Full ring mean"), Window.GetMeanMs(), 1.f, 0.01f);
+
+	// Noisy frames with 2% spikes, the histogram percentiles must stay within its bin error of the sorted ones.
+	Window.Reset();
+	FRandomStream Random(39);
+	TArray<float> FrameTimesMs;
+	Window.AddTimestamp(Now);
+	for (uint32 Frame = 0; Frame < 40; Frame++)
+	{
+		double Seconds = 0.012 + Random.FRandRange(0.f, 0.008f);
+		if (Random.GetFraction() < 0.02f)
+		{
+			Seconds += Random.FRandRange(0.02f, 0.05f);
+		}
+		Now += Seconds;
+		Window.AddTimestamp(Now);
+		FrameTimesMs.Add((float)(Seconds * 1000.0));
+	}
+	FrameTimesMs.Sort();
+	auto SortedPercentile = [&FrameTimesMs](float Percentile)
+	{
+		return FrameTimesMs[FMath::Max(FMath::CeilToInt(Percentile * (float)FrameTimesMs.Num()), 1) - 1];
+	};
+	TestEqual(TEXT("Noisy p50"), Window.GetP50Ms(), SortedPercentile(0.50f), SortedPercentile(0.50f) * 0.025f);
+	TestEqual(TEXT("Noisy p95"), Window.GetP95Ms(), SortedPercentile(0.95f), SortedPercentile(0.95f) * 0.025f);
+	TestEqual(TEXT("Noisy p99"), Window.GetP99Ms(), SortedPercentile(0.99f), SortedPercentile(0.99f) * 0.025f);
+
+	return true;
+}
+
+#endif
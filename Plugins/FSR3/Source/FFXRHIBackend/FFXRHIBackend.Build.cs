@@ -31,6 +31,7 @@ public class FFXRHIBackend : ModuleRules
 		PrivateIncludePaths.AddRange(
 			new string[] {
 				Path.Combine(ModuleDirectory, "../fidelityfx-sdk/ffx-api/src"),
+				Path.Combine(ModuleDirectory, "../fidelityfx-sdk/sdk/src/backends/shared"),
 			}
 			);
 
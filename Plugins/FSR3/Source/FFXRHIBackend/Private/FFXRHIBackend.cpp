@@ -29,6 +29,8 @@
 #include "Containers/DynamicRHIResourceArray.h"
 #include "Engine/GameViewportClient.h"
 #include "UnrealClient.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #if UE_VERSION_OLDER_THAN(5, 0, 0)
 #include "RenderGraphBuilder.h"
 #endif
@@ -58,6 +60,7 @@ THIRD_PARTY_INCLUDES_START
 #endif
 #include "ffx_provider_framegeneration.h"
 #include "ffx_provider_fsr3upscale.h"
+#include "ffx_job_recording.h"
 
 THIRD_PARTY_INCLUDES_END
 #if PLATFORM_WINDOWS
@@ -69,6 +72,14 @@ THIRD_PARTY_INCLUDES_END
 #undef FFX_GCC
 #endif
 
+#if UE_VERSION_OLDER_THAN(4, 27, 0)
+#define GFrameCounterRenderThread GFrameNumberRenderThread
+#endif
+
+DECLARE_STATS_GROUP(TEXT("FFXRHIBackend"), STATGROUP_FFXRHIBackend, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FFX: RDG external registrations"), STAT_FFXRDGRegistrations, STATGROUP_FFXRHIBackend);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FFX: RDG registration cache hits"), STAT_FFXRDGCacheHits, STATGROUP_FFXRHIBackend);
+
 struct FFXTextureBulkData final : public FResourceBulkDataInterface
 {
 	FFXTextureBulkData()
@@ -92,6 +103,76 @@ struct FFXTextureBulkData final : public FResourceBulkDataInterface
 	uint32 DataSize = 0;
 };
 
+struct FFXBufferInitData final : public FResourceArrayInterface
+{
+	FFXBufferInitData(const void* InData, uint32 InDataSize)
+	: Data(InData)
+	, DataSize(InDataSize)
+	{
+	}
+
+	const void* GetResourceData() const { return Data; }
+	uint32 GetResourceDataSize() const { return DataSize; }
+
+	void Discard() {}
+	bool IsStatic() const { return false; }
+	bool GetAllowCPUAccess() const { return false; }
+	void SetAllowCPUAccess(bool bInNeedsCPUAccess) {}
+
+	const void* Data = nullptr;
+	uint32 DataSize = 0;
+};
+
+// Resolves the FFX init data into the memory layout of the UE format from GetUEFormat.
+// Caller data is used in place where the layouts match, otherwise it is converted or filled once into Storage.
+static const void* GetUEInitData(const FfxCreateResourceDescription* desc, TArray<uint8>& Storage, size_t& OutInitDataSize)
+{
+	const void* InitData = nullptr;
+	OutInitDataSize = 0;
+
+	const FfxResourceInitData& Init = desc->initData;
+	if ((Init.type == FFX_RESOURCE_INIT_DATA_TYPE_BUFFER && Init.buffer && Init.size) || (Init.type == FFX_RESOURCE_INIT_DATA_TYPE_VALUE && Init.size))
+	{
+		// R16_SNORM & R16G16_SINT have no native UE equivalent and are widened to four channels.
+		const size_t NumChannels = desc->resourceDescription.format == FFX_SURFACE_FORMAT_R16_SNORM ? 1 : desc->resourceDescription.format == FFX_SURFACE_FORMAT_R16G16_SINT ? 2 : 4;
+		if (NumChannels != 4)
+		{
+			const size_t NumTexels = Init.size / (sizeof(int16) * NumChannels);
+			Storage.SetNumZeroed(NumTexels * sizeof(int16) * 4);
+			int16* Dst = (int16*)Storage.GetData();
+			if (Init.type == FFX_RESOURCE_INIT_DATA_TYPE_BUFFER)
+			{
+				const int16* Src = (const int16*)Init.buffer;
+				for (size_t i = 0; i < NumTexels; i++)
+				{
+					FMemory::Memcpy(&Dst[i * 4], &Src[i * NumChannels], sizeof(int16) * NumChannels);
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < NumTexels; i++)
+				{
+					FMemory::Memset(&Dst[i * 4], Init.value, sizeof(int16) * NumChannels);
+				}
+			}
+			InitData = Storage.GetData();
+		}
+		else if (Init.type == FFX_RESOURCE_INIT_DATA_TYPE_VALUE)
+		{
+			Storage.SetNumUninitialized(Init.size);
+			FMemory::Memset(Storage.GetData(), Init.value, Init.size);
+			InitData = Storage.GetData();
+		}
+		else
+		{
+			InitData = Init.buffer;
+		}
+		OutInitDataSize = InitData == Init.buffer ? Init.size : Storage.Num();
+	}
+
+	return InitData;
+}
+
 static EPixelFormat GetUEFormat(FfxSurfaceFormat Format)
 {
 	EPixelFormat UEFormat = PF_Unknown;
@@ -187,37 +268,19 @@ static FfxErrorCode CreateResource_UE(FfxInterface* backendInterface, const FfxC
 		Flags |= desc->resourceDescription.format == FFX_SURFACE_FORMAT_R8G8B8A8_SRGB ? TexCreate_SRGB : TexCreate_None;
 
 		size_t Size = desc->resourceDescription.width;
-		void* InitData = desc->initData.buffer;
-		size_t InitDataSize = desc->initData.size;
-		if (desc->resourceDescription.format == FFX_SURFACE_FORMAT_R16_SNORM && desc->initData.buffer)
+		TArray<uint8> ConvertedInitData;
+		size_t InitDataSize = 0;
+		const void* InitData = GetUEInitData(desc, ConvertedInitData, InitDataSize);
+		Context->NumResourcesCreated++;
+		if (ConvertedInitData.Num())
 		{
-			int16* Data = (int16*)FMemory::Malloc(desc->initData.size * 4);
-			for (uint32 i = 0; i < (desc->initData.size / sizeof(int16)); i++)
-			{
-				Data[i * 4] = ((int16*)desc->initData.buffer)[i];
-				Data[i * 4 + 1] = 0;
-				Data[i * 4 + 2] = 0;
-				Data[i * 4 + 3] = 0;
-			}
-
-			InitData = Data;
-			InitDataSize = desc->initData.size * 4;
-			Size = desc->resourceDescription.width * 4;
+			Context->NumInitDataConversions++;
+			Context->ConvertedInitDataBytes += ConvertedInitData.Num();
+			Context->PeakConvertedInitDataBytes = FMath::Max<uint64>(Context->PeakConvertedInitDataBytes, ConvertedInitData.Num());
 		}
-		else if (desc->resourceDescription.format == FFX_SURFACE_FORMAT_R16G16_SINT && desc->initData.buffer)
+		if (InitData && InitDataSize > desc->initData.size)
 		{
-			int16* Data = (int16*)FMemory::Malloc(desc->initData.size * 2);
-			for (uint32 i = 0; i < (desc->initData.size / (sizeof(int16) * 2)); i+=2)
-			{
-				Data[i * 2] = ((int16*)desc->initData.buffer)[i];
-				Data[i * 2 + 1] = ((int16*)desc->initData.buffer)[i+1];
-				Data[i * 2 + 2] = 0;
-				Data[i * 2 + 3] = 0;
-			}
-
-			InitData = Data;
-			InitDataSize = desc->initData.size * 2;
-			Size = desc->resourceDescription.width * 2;
+			Size = Size * (InitDataSize / desc->initData.size);
 		}
 
 		auto Type = desc->resourceDescription.type;
@@ -229,12 +292,7 @@ static FfxErrorCode CreateResource_UE(FfxInterface* backendInterface, const FfxC
 			case FFX_RESOURCE_TYPE_BUFFER:
 			{
 #if UE_VERSION_AT_LEAST(5, 0, 0)
-				TResourceArray<uint8> InitDataResourceArray;
-				if (bInitData)
-				{
-					InitDataResourceArray.AddUninitialized(InitDataSize);
-					FMemory::Memcpy(InitDataResourceArray.GetData(), InitData, InitDataSize);
-				}
+				FFXBufferInitData InitDataResourceArray(InitData, (uint32)InitDataSize);
 				FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), Size);
 
 #if UE_VERSION_AT_LEAST(5, 6, 0)
@@ -257,11 +315,11 @@ static FfxErrorCode CreateResource_UE(FfxInterface* backendInterface, const FfxC
 #endif
 #endif
 				check(VB.GetReference());
-				TRefCountPtr<FRDGPooledBuffer>* PooledBuffer = new TRefCountPtr<FRDGPooledBuffer>;
+				TRefCountPtr<FRDGPooledBuffer>* PooledBuffer = Context->PooledBuffers.Alloc();
 				*PooledBuffer = new FRDGPooledBuffer(VB, Desc, desc->resourceDescription.width, WCHAR_TO_TCHAR(desc->name));
 #else
 				FRDGBufferRef BufferRef = GraphBuilder->CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), Size), WCHAR_TO_TCHAR(desc->name));
-				TRefCountPtr<FRDGPooledBuffer>* PooledBuffer = new TRefCountPtr<FRDGPooledBuffer>;
+				TRefCountPtr<FRDGPooledBuffer>* PooledBuffer = Context->PooledBuffers.Alloc();
 				ConvertToExternalBuffer(*GraphBuilder, BufferRef, *PooledBuffer);
 				FVertexBufferRHIRef VB = (*PooledBuffer)->GetVertexBufferRHI();
 				check(VB.GetReference());
@@ -299,7 +357,7 @@ static FfxErrorCode CreateResource_UE(FfxInterface* backendInterface, const FfxC
 				Texture->SetName(FName(WCHAR_TO_TCHAR(desc->name)));
 #endif
 
-				TRefCountPtr<IPooledRenderTarget>* PooledRT = new TRefCountPtr<IPooledRenderTarget>;
+				TRefCountPtr<IPooledRenderTarget>* PooledRT = Context->PooledRTs.Alloc();
 				*PooledRT = CreateRenderTarget(Texture.GetReference(),WCHAR_TO_TCHAR( desc->name));
 				outTexture->internalIndex = Context->AddResource(Texture.GetReference(), desc->resourceDescription.type, PooledRT, nullptr, nullptr);
 				Context->Resources[outTexture->internalIndex].Desc = desc->resourceDescription;
@@ -326,7 +384,7 @@ static FfxErrorCode CreateResource_UE(FfxInterface* backendInterface, const FfxC
 				Texture->SetName(FName(WCHAR_TO_TCHAR(desc->name)));
 #endif
 
-				TRefCountPtr<IPooledRenderTarget>* PooledRT = new TRefCountPtr<IPooledRenderTarget>;
+				TRefCountPtr<IPooledRenderTarget>* PooledRT = Context->PooledRTs.Alloc();
 				*PooledRT = CreateRenderTarget(Texture.GetReference(), WCHAR_TO_TCHAR(desc->name));
 				outTexture->internalIndex = Context->AddResource(Texture.GetReference(), desc->resourceDescription.type, PooledRT, nullptr, nullptr);
 				Context->Resources[outTexture->internalIndex].Desc = desc->resourceDescription;
@@ -341,11 +399,6 @@ static FfxErrorCode CreateResource_UE(FfxInterface* backendInterface, const FfxC
 				break;
 			}
 		}
-
-		if (bInitData && (desc->resourceDescription.format == FFX_SURFACE_FORMAT_R16_SNORM || desc->resourceDescription.format == FFX_SURFACE_FORMAT_R16G16_SINT))
-		{
-			FMemory::Free(InitData);
-		}
 	}
 	else
 	{
@@ -418,11 +471,9 @@ static FfxErrorCode CreateDevice_UE(FfxInterface* backendInterface, FfxEffect ef
 	FFXBackendState* backendContext = (FFXBackendState*)backendInterface->scratchBuffer;
 	if (backendContext->device != backendInterface->device)
 	{
+		backendContext->ReleaseJobArena();
 		FMemory::Memzero(backendInterface->scratchBuffer, backendInterface->scratchBufferSize);
-		for (uint32 i = 0; i < FFX_MAX_BLOCK_COUNT; i++)
-		{
-			backendContext->Blocks[i].ResourceMask = 0xffffffffffffffff;
-		}
+		backendContext->InitIndices();
 		backendContext->device = backendInterface->device;
 	}
 	if (effectContextId)
@@ -443,6 +494,10 @@ static FfxErrorCode ReleaseDevice_UE(FfxInterface* backendInterface, FfxUInt32 e
 			backendContext->RemoveResource(i);
 		}
 	}
+	if (backendContext->NumJobs == 0)
+	{
+		backendContext->ReleaseJobArena();
+	}
 	return FFX_OK;
 }
 
@@ -465,19 +520,76 @@ static FfxErrorCode CreatePipeline_UE(FfxInterface* backendInterface, FfxEffect
 	return Result;
 }
 
+//-------------------------------------------------------------------------------------
+// Each scheduled job is a record in FFXBackendState::JobArena: this header, the job description & a copy of its constants.
+//-------------------------------------------------------------------------------------
+struct alignas(16) FFXJobRecordHeader
+{
+	uint32 RecordSize;
+	uint32 JobSize;
+};
+
+// Only the part of the description used by the job type is stored, e.g. a clear needs ~150 bytes of the ~70KB structure.
+static uint32 GetStoredJobSize(FfxGpuJobType Type)
+{
+	switch (Type)
+	{
+	case FFX_GPU_JOB_CLEAR_FLOAT:
+		return STRUCT_OFFSET(FfxGpuJobDescription, clearJobDescriptor) + sizeof(FfxClearFloatJobDescription);
+	case FFX_GPU_JOB_COPY:
+		return STRUCT_OFFSET(FfxGpuJobDescription, copyJobDescriptor) + sizeof(FfxCopyJobDescription);
+	case FFX_GPU_JOB_BARRIER:
+		return STRUCT_OFFSET(FfxGpuJobDescription, barrierDescriptor) + sizeof(FfxBarrierDescription);
+	case FFX_GPU_JOB_DISCARD:
+		return STRUCT_OFFSET(FfxGpuJobDescription, discardJobDescriptor) + sizeof(FfxDiscardJobDescription);
+	default:
+		return sizeof(FfxGpuJobDescription);
+	}
+}
+
+// Returns the job at Offset & advances Offset to the next record, constant buffers are pointed at the copies in the record.
+static FfxGpuJobDescription* GetStoredJob(FFXBackendState* Context, uint32& Offset)
+{
+	FFXJobRecordHeader* Record = (FFXJobRecordHeader*)(Context->JobArena + Offset);
+	FfxGpuJobDescription* Job = (FfxGpuJobDescription*)(Record + 1);
+	if (Job->jobType == FFX_GPU_JOB_COMPUTE)
+	{
+		uint8* Constants = (uint8*)Job + Align(Record->JobSize, 16);
+		for (uint32 i = 0; i < Job->computeJobDescriptor.pipeline.constCount; i++)
+		{
+			Job->computeJobDescriptor.cbs[i].data = (uint32_t*)Constants;
+			Constants += Align(Job->computeJobDescriptor.cbs[i].num32BitEntries * sizeof(uint32_t), 16);
+		}
+	}
+	Offset += Record->RecordSize;
+	return Job;
+}
+
 static FfxErrorCode ScheduleRenderJob_UE(FfxInterface* backendInterface, const FfxGpuJobDescription* job)
 {
 	FFXBackendState* backendContext = (FFXBackendState*)backendInterface->scratchBuffer;
-	backendContext->Jobs[backendContext->NumJobs] = *job;
+
+	uint32 ConstantSize = 0;
+	if (job->jobType == FFX_GPU_JOB_COMPUTE)
+	{
+		for (uint32 i = 0; i < job->computeJobDescriptor.pipeline.constCount; i++)
+		{
+			ConstantSize += Align(job->computeJobDescriptor.cbs[i].num32BitEntries * sizeof(uint32_t), 16);
+		}
+	}
+
+	const uint32 JobSize = GetStoredJobSize(job->jobType);
+	FfxGpuJobDescription* StoredJob = backendContext->AllocJob(JobSize, ConstantSize);
+	FMemory::Memcpy(StoredJob, job, JobSize);
 	if (job->jobType == FFX_GPU_JOB_COMPUTE)
 	{
-		// needs to copy SRVs and UAVs in case they are on the stack only
-		FfxComputeJobDescription* computeJob = &backendContext->Jobs[backendContext->NumJobs].computeJobDescriptor;
-		const uint32_t numConstBuffers = job->computeJobDescriptor.pipeline.constCount;
-		for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < numConstBuffers; ++currentRootConstantIndex)
+		// Constants are staged in a ring buffer that can wrap before the jobs are flushed, so each job keeps its own copy.
+		uint8* Constants = (uint8*)StoredJob + Align(JobSize, 16);
+		for (uint32 i = 0; i < job->computeJobDescriptor.pipeline.constCount; i++)
 		{
-			computeJob->cbs[currentRootConstantIndex].num32BitEntries = job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries;
-			memcpy(computeJob->cbs[currentRootConstantIndex].data, job->computeJobDescriptor.cbs[currentRootConstantIndex].data, computeJob->cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t));
+			const uint32 Size = job->computeJobDescriptor.cbs[i].num32BitEntries * sizeof(uint32_t);
+			FMemory::Memcpy(Constants, job->computeJobDescriptor.cbs[i].data, Size);
+			Constants += Align(Size, 16);
 		}
 	}
 	backendContext->NumJobs++;
@@ -485,6 +597,38 @@ static FfxErrorCode ScheduleRenderJob_UE(FfxInterface* backendInterface, const F
 	return FFX_OK;
 }
 
+// Writes the pending job list to Saved/Profiling/FidelityFX for tools/ffx_job_replay.
+static void RecordJobList(FFXBackendState* Context)
+{
+	static uint32 RecordingIndex = 0;
+
+	TArray<uint8> Recording;
+	FfxJobRecordingHeader Header = { FFX_JOB_RECORDING_MAGIC, FFX_JOB_RECORDING_VERSION, GFrameCounterRenderThread, 0, Context->NumJobs };
+	Recording.AddUninitialized(sizeof(Header));
+
+	for (uint32 i = 0; i < FFX_RHI_MAX_RESOURCE_COUNT; i++)
+	{
+		if (Context->IsValidIndex(i))
+		{
+			FfxJobRecordingResource Resource = ffxJobRecordingResource(int32(i), Context->Resources[i].Desc);
+			Recording.Append((const uint8*)&Resource, sizeof(Resource));
+			Header.resourceCount++;
+		}
+	}
+	FMemory::Memcpy(Recording.GetData(), &Header, sizeof(Header));
+
+	uint32 Offset = 0;
+	for (uint32 i = 0; i < Context->NumJobs; i++)
+	{
+		const FfxGpuJobDescription* Job = GetStoredJob(Context, Offset);
+		const int32 RecordOffset = Recording.AddUninitialized(ffxJobRecordingEncodeJob(*Job, nullptr));
+		ffxJobRecordingEncodeJob(*Job, Recording.GetData() + RecordOffset);
+	}
+
+	const FString Path = FPaths::Combine(FPaths::ProfilingDir(), TEXT("FidelityFX"), FString::Printf(TEXT("JobList_%llu_%u.ffxjobs"), (uint64)GFrameCounterRenderThread, RecordingIndex++));
+	FFileHelper::SaveArrayToFile(Recording, *Path);
+}
+
 #if UE_VERSION_OLDER_THAN(5, 0, 0)
 static bool IsFloatFormat(EPixelFormat Format)
 {
@@ -509,6 +653,102 @@ static bool IsFloatFormat(EPixelFormat Format)
 }
 #endif
 
+#if UE_VERSION_AT_LEAST(5, 0, 0)
+#define FFX_MAX_CLEAR_BATCH_COUNT (16)
+
+BEGIN_SHADER_PARAMETER_STRUCT(FFXClearUAVsParameters, )
+	SHADER_PARAMETER_RDG_TEXTURE_UAV_ARRAY(RWTexture2D, TextureUAVs, [FFX_MAX_CLEAR_BATCH_COUNT])
+	SHADER_PARAMETER_RDG_BUFFER_UAV_ARRAY(RWBuffer<float>, BufferUAVs, [FFX_MAX_CLEAR_BATCH_COUNT])
+END_SHADER_PARAMETER_STRUCT()
+
+//-------------------------------------------------------------------------------------
+// Gathers consecutive FFX clear jobs so that they are recorded as a single RDG pass rather than one pass per mip.
+//-------------------------------------------------------------------------------------
+struct FFXClearBatch
+{
+	struct FClear
+	{
+		float Color[4];
+		bool bFloat;
+	};
+
+	FFXClearUAVsParameters* Parameters = nullptr;
+	FClear TextureClears[FFX_MAX_CLEAR_BATCH_COUNT];
+	float BufferClears[FFX_MAX_CLEAR_BATCH_COUNT];
+	uint32 NumTextureClears = 0;
+	uint32 NumBufferClears = 0;
+	uint32 NumPasses = 0;
+
+	void AddTexture(FRDGBuilder& GraphBuilder, FRDGTextureUAVRef UAV, const float Color[4], bool bFloat)
+	{
+		if (NumTextureClears == FFX_MAX_CLEAR_BATCH_COUNT)
+		{
+			Flush(GraphBuilder);
+		}
+		GetParameters(GraphBuilder)->TextureUAVs[NumTextureClears] = UAV;
+		FMemory::Memcpy(TextureClears[NumTextureClears].Color, Color, sizeof(float) * 4);
+		TextureClears[NumTextureClears].bFloat = bFloat;
+		NumTextureClears++;
+	}
+
+	void AddBuffer(FRDGBuilder& GraphBuilder, FRDGBufferUAVRef UAV, float Value)
+	{
+		if (NumBufferClears == FFX_MAX_CLEAR_BATCH_COUNT)
+		{
+			Flush(GraphBuilder);
+		}
+		GetParameters(GraphBuilder)->BufferUAVs[NumBufferClears] = UAV;
+		BufferClears[NumBufferClears] = Value;
+		NumBufferClears++;
+	}
+
+	void Flush(FRDGBuilder& GraphBuilder)
+	{
+		if (Parameters)
+		{
+			FFXClearUAVsParameters* PassParameters = Parameters;
+			GraphBuilder.AddPass(RDG_EVENT_NAME("FidelityFX-ClearUAVs %u", NumTextureClears + NumBufferClears), PassParameters, ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
+				[PassParameters, Batch = *this](FRHIComputeCommandList& RHICmdList)
+				{
+					for (uint32 i = 0; i < Batch.NumTextureClears; i++)
+					{
+						const FClear& Clear = Batch.TextureClears[i];
+						if (Clear.bFloat)
+						{
+							RHICmdList.ClearUAVFloat(PassParameters->TextureUAVs[i]->GetRHI(), FVector4f(Clear.Color[0], Clear.Color[1], Clear.Color[2], Clear.Color[3]));
+						}
+						else
+						{
+							uint32 UintVector[4];
+							FMemory::Memcpy(UintVector, Clear.Color, sizeof(uint32) * 4);
+							RHICmdList.ClearUAVUint(PassParameters->TextureUAVs[i]->GetRHI(), FUintVector4(UintVector[0], UintVector[1], UintVector[2], UintVector[3]));
+						}
+					}
+					for (uint32 i = 0; i < Batch.NumBufferClears; i++)
+					{
+						const float Value = Batch.BufferClears[i];
+						RHICmdList.ClearUAVFloat(PassParameters->BufferUAVs[i]->GetRHI(), FVector4f(Value, Value, Value, Value));
+					}
+				});
+			NumPasses++;
+		}
+		Parameters = nullptr;
+		NumTextureClears = 0;
+		NumBufferClears = 0;
+	}
+
+private:
+	FFXClearUAVsParameters* GetParameters(FRDGBuilder& GraphBuilder)
+	{
+		if (!Parameters)
+		{
+			Parameters = GraphBuilder.AllocParameters<FFXClearUAVsParameters>();
+		}
+		return Parameters;
+	}
+};
+#endif
+
 static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId)
 {
 	FfxErrorCode Result = FFX_OK;
@@ -516,9 +756,35 @@ static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxComman
 	FRDGBuilder* GraphBuilder = (FRDGBuilder*)commandList;
 	if (Context && GraphBuilder)
 	{
+#if UE_VERSION_AT_LEAST(5, 0, 0)
+		FFXClearBatch ClearBatch;
+		const bool bBatchClears = CVarFSR3BatchRHIClears.GetValueOnRenderThread() != 0;
+#endif
+		const int32 RecordRequest = CVarFSR3RecordRHIJobLists.GetValueOnRenderThread();
+		if (RecordRequest != Context->LastRecordRequest)
+		{
+			Context->LastRecordRequest = RecordRequest;
+			Context->NumJobListsToRecord = RecordRequest;
+		}
+		if (Context->NumJobListsToRecord > 0 && Context->NumJobs > 0)
+		{
+			Context->NumJobListsToRecord--;
+			RecordJobList(Context);
+		}
+
+		Context->BeginRDGCache(*GraphBuilder);
+
+		uint32 JobOffset = 0;
 		for (uint32 i = 0; i < Context->NumJobs; i++)
 		{
-			FfxGpuJobDescription* job = &Context->Jobs[i];
+			FfxGpuJobDescription* job = GetStoredJob(Context, JobOffset);
+#if UE_VERSION_AT_LEAST(5, 0, 0)
+			// Clears are deferred into the batch, anything else has to see their results.
+			if (bBatchClears && job->jobType != FFX_GPU_JOB_CLEAR_FLOAT && job->jobType != FFX_GPU_JOB_BARRIER)
+			{
+				ClearBatch.Flush(*GraphBuilder);
+			}
+#endif
 			switch (job->jobType)
 			{
 				case FFX_GPU_JOB_CLEAR_FLOAT:
@@ -526,13 +792,24 @@ static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxComman
 					FRDGTexture* RdgTex = Context->GetRDGTexture(*GraphBuilder, job->clearJobDescriptor.target.internalIndex);
 					if (RdgTex)
 					{
+#if UE_VERSION_AT_LEAST(5, 0, 0)
+						if (bBatchClears)
+						{
+							const bool bFloat = IsFloatFormat(RdgTex->Desc.Format);
+							for (uint8 MipLevel = 0; MipLevel < RdgTex->Desc.NumMips; MipLevel++)
+							{
+								ClearBatch.AddTexture(*GraphBuilder, Context->GetRDGTextureUAV(*GraphBuilder, job->clearJobDescriptor.target.internalIndex, MipLevel), job->clearJobDescriptor.color, bFloat);
+							}
+						}
+						else
+#endif
 						if (IsFloatFormat(RdgTex->Desc.Format))
 						{
 							for (uint8 MipLevel = 0; MipLevel < RdgTex->Desc.NumMips; MipLevel++)
 							{
-								FRDGTextureUAVDesc Desc(RdgTex, MipLevel);
-								FRDGTextureUAVRef UAV = GraphBuilder->CreateUAV(Desc);
+								FRDGTextureUAVRef UAV = Context->GetRDGTextureUAV(*GraphBuilder, job->clearJobDescriptor.target.internalIndex, MipLevel);
 								AddClearUAVPass(*GraphBuilder, UAV, job->clearJobDescriptor.color);
+								Context->NumRDGPasses++;
 							}
 						}
 						else
@@ -541,16 +818,26 @@ static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxComman
 							FMemory::Memcpy(UintVector, job->clearJobDescriptor.color, sizeof(uint32) * 4);
 							for (uint8 MipLevel = 0; MipLevel < RdgTex->Desc.NumMips; MipLevel++)
 							{
-								FRDGTextureUAVDesc Desc(RdgTex, MipLevel);
-								FRDGTextureUAVRef UAV = GraphBuilder->CreateUAV(Desc);
+								FRDGTextureUAVRef UAV = Context->GetRDGTextureUAV(*GraphBuilder, job->clearJobDescriptor.target.internalIndex, MipLevel);
 								AddClearUAVPass(*GraphBuilder, UAV, UintVector);
+								Context->NumRDGPasses++;
 							}
 						}
 					}
 					else
 					{
-						FRDGBufferUAVRef UAV = GraphBuilder->CreateUAV(Context->GetRDGBuffer(*GraphBuilder, job->clearJobDescriptor.target.internalIndex), PF_R32_FLOAT);
-						AddClearUAVFloatPass(*GraphBuilder, UAV, job->clearJobDescriptor.color[0]);
+						FRDGBufferUAVRef UAV = Context->GetRDGBufferUAV(*GraphBuilder, job->clearJobDescriptor.target.internalIndex);
+#if UE_VERSION_AT_LEAST(5, 0, 0)
+						if (bBatchClears)
+						{
+							ClearBatch.AddBuffer(*GraphBuilder, UAV, job->clearJobDescriptor.color[0]);
+						}
+						else
+#endif
+						{
+							AddClearUAVFloatPass(*GraphBuilder, UAV, job->clearJobDescriptor.color[0]);
+							Context->NumRDGPasses++;
+						}
 					}
 					break;
 				}
@@ -558,7 +845,19 @@ static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxComman
 				{
 					if ((Context->GetType(job->copyJobDescriptor.src.internalIndex) == FFX_RESOURCE_TYPE_BUFFER) && (Context->GetType(job->copyJobDescriptor.dst.internalIndex) == FFX_RESOURCE_TYPE_BUFFER))
 					{
-						check(false);
+						FRDGBufferRef SrcBuffer = Context->GetRDGBuffer(*GraphBuilder, job->copyJobDescriptor.src.internalIndex);
+						FRDGBufferRef DstBuffer = Context->GetRDGBuffer(*GraphBuilder, job->copyJobDescriptor.dst.internalIndex);
+						check(SrcBuffer && DstBuffer);
+
+						// A size of zero copies as much of the source as fits in the destination.
+						const uint32 SrcSize = Context->Resources[job->copyJobDescriptor.src.internalIndex].Desc.size;
+						const uint32 DstSize = Context->Resources[job->copyJobDescriptor.dst.internalIndex].Desc.size;
+						check(job->copyJobDescriptor.srcOffset <= SrcSize && job->copyJobDescriptor.dstOffset <= DstSize);
+						uint32 NumBytes = job->copyJobDescriptor.size ? job->copyJobDescriptor.size : FMath::Min(SrcSize - job->copyJobDescriptor.srcOffset, DstSize - job->copyJobDescriptor.dstOffset);
+						check(job->copyJobDescriptor.srcOffset + NumBytes <= SrcSize && job->copyJobDescriptor.dstOffset + NumBytes <= DstSize);
+
+						AddCopyBufferPass(*GraphBuilder, DstBuffer, job->copyJobDescriptor.dstOffset, SrcBuffer, job->copyJobDescriptor.srcOffset, NumBytes);
+						Context->NumRDGPasses++;
 					}
 					else
 					{
@@ -569,6 +868,7 @@ static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxComman
 						Info.NumMips = FMath::Min(SrcRDG->Desc.NumMips, DstRDG->Desc.NumMips);
 						check(SrcRDG->Desc.Extent.X <= DstRDG->Desc.Extent.X && SrcRDG->Desc.Extent.Y <= DstRDG->Desc.Extent.Y);
 						AddCopyTexturePass(*GraphBuilder, SrcRDG, DstRDG, Info);
+						Context->NumRDGPasses++;
 					}
 
 					break;
@@ -578,10 +878,12 @@ static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxComman
 					IFFXRHIBackendSubPass* Pipeline = (IFFXRHIBackendSubPass*)job->computeJobDescriptor.pipeline.pipeline;
 					check(Pipeline);
 					Pipeline->Dispatch(*GraphBuilder, Context, job);
+					Context->NumRDGPasses++;
 					break;
 				}
 				case FFX_GPU_JOB_BARRIER:
 				{
+					// RDG derives the transitions from each pass's parameters, so explicit barriers have nothing to add.
 					break;
 				}
 				default:
@@ -591,8 +893,14 @@ static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxComman
 				}
 			}
 		}
+#if UE_VERSION_AT_LEAST(5, 0, 0)
+		ClearBatch.Flush(*GraphBuilder);
+		Context->NumRDGPasses += ClearBatch.NumPasses;
+#endif
+		Context->EndRDGCache();
 
 		Context->NumJobs = 0;
+		Context->JobArenaUsed = 0;
 	}
 	else
 	{
@@ -795,11 +1103,10 @@ static FfxErrorCode UnregisterResources_UE(FfxInterface* backendInterface, FfxCo
 	{
 		if (Context->IsValidIndex(i) && Context->GetEffectId(i) == effectContextId)
 		{
-			auto& Block = Context->Blocks[i / FFX_MAX_BLOCK_RESOURCE_COUNT];
-			if (Block.DynamicMask & (1llu << uint64(i % FFX_MAX_BLOCK_RESOURCE_COUNT)))
+			if (Context->IsDynamicIndex(i))
 			{
 				Context->RemoveResource(i);
-				check(!(Block.DynamicMask & (1llu << uint64(i % FFX_MAX_BLOCK_RESOURCE_COUNT))));
+				check(!Context->IsDynamicIndex(i));
 			}
 		}
 	}
@@ -1091,24 +1398,21 @@ void FFXBackendState::SetEffectId(uint32 Index, uint32 EffectId)
 	}
 }
 
-uint32 FFXBackendState::AllocIndex()
+void FFXBackendState::InitIndices()
 {
-	uint32 Index = ~0u;
+	FreeIndices.SetAll();
+	PooledRTs.Init();
+	PooledBuffers.Init();
+}
 
-	for (uint32 i = 0; i < FFX_MAX_BLOCK_COUNT; i++)
+uint32 FFXBackendState::AllocIndex()
+{
+	uint32 Index = FreeIndices.FindFirst();
+	check(Index < FFX_RHI_MAX_RESOURCE_COUNT);
+	if (Index < FFX_RHI_MAX_RESOURCE_COUNT)
 	{
-		auto& Block = Blocks[i];
-		if (Block.ResourceMask != 0)
-		{
-			Index = (uint32)FMath::CountTrailingZeros64(Block.ResourceMask);
-			check(Index < FFX_MAX_BLOCK_RESOURCE_COUNT);
-			Block.ResourceMask &= ~(1llu << uint64(Index));
-			Index += (i * FFX_MAX_BLOCK_RESOURCE_COUNT);
-			break;
-		}
+		FreeIndices.Clear(Index);
 	}
-
-	check(Index < FFX_RHI_MAX_RESOURCE_COUNT);
 	return Index;
 }
 
@@ -1116,39 +1420,23 @@ void FFXBackendState::MarkDynamic(uint32 Index)
 {
 	if (Index < FFX_RHI_MAX_RESOURCE_COUNT)
 	{
-		auto& Block = Blocks[Index / FFX_MAX_BLOCK_RESOURCE_COUNT];
-		Block.DynamicMask |= (1llu << uint64(Index % FFX_MAX_BLOCK_RESOURCE_COUNT));
+		DynamicIndices.Set(Index);
 	}
 }
 
-uint32 FFXBackendState::GetDynamicIndex()
+bool FFXBackendState::IsDynamicIndex(uint32 Index)
 {
-	uint32 Index = ~0u;
-
-	for (uint32 i = 0; i < FFX_MAX_BLOCK_COUNT; i++)
-	{
-		auto& Block = Blocks[i];
-		if (Block.DynamicMask)
-		{
-			Index = (uint32)FMath::CountTrailingZeros64(Block.DynamicMask) + (i * FFX_MAX_BLOCK_RESOURCE_COUNT);
-			break;
-		}
-	}
+	return DynamicIndices.IsSet(Index);
+}
 
-	return Index;
+uint32 FFXBackendState::GetDynamicIndex()
+{
+	return DynamicIndices.FindFirst();
 }
 
 bool FFXBackendState::IsValidIndex(uint32 Index)
 {
-	bool bResult = false;
-	if (Index < FFX_RHI_MAX_RESOURCE_COUNT)
-	{
-		auto& Block = Blocks[Index / FFX_MAX_BLOCK_RESOURCE_COUNT];
-		uint32 i = (Index % FFX_MAX_BLOCK_RESOURCE_COUNT);
-		uint64 Mask = (1llu << uint64(i));
-		bResult = !(Block.ResourceMask & Mask);
-	}
-	return bResult;
+	return Index < FFX_RHI_MAX_RESOURCE_COUNT && !FreeIndices.IsSet(Index);
 }
 
 void FFXBackendState::FreeIndex(uint32 Index)
@@ -1157,11 +1445,8 @@ void FFXBackendState::FreeIndex(uint32 Index)
 
 	if (Index < FFX_RHI_MAX_RESOURCE_COUNT)
 	{
-		auto& Block = Blocks[Index / FFX_MAX_BLOCK_RESOURCE_COUNT];
-		uint32 i = (Index % FFX_MAX_BLOCK_RESOURCE_COUNT);
-		uint64 Mask = (1llu << uint64(i));
-		Block.DynamicMask &= ~Mask;
-		Block.ResourceMask |= Mask;
+		DynamicIndices.Clear(Index);
+		FreeIndices.Set(Index);
 	}
 }
 
@@ -1191,6 +1476,29 @@ FRHIResource* FFXBackendState::GetResource(uint32 Index)
 	return Res;
 }
 
+void FFXBackendState::BeginRDGCache(FRDGBuilder& GraphBuilder)
+{
+	// RDG references die with their graph builder and a later builder can be allocated at the same address, so the cache only lives for one flush.
+	CachedGraphBuilder = &GraphBuilder;
+	NumRDGRegistrations = 0;
+	NumRDGCacheHits = 0;
+	NumRDGPasses = 0;
+	FMemory::Memzero(CachedRDGTextures);
+	FMemory::Memzero(CachedRDGBuffers);
+	FMemory::Memzero(CachedRDGTextureUAVs);
+	FMemory::Memzero(CachedRDGBufferUAVs);
+}
+
+void FFXBackendState::EndRDGCache()
+{
+	CachedGraphBuilder = nullptr;
+}
+
+bool FFXBackendState::IsRDGCacheValid(FRDGBuilder& GraphBuilder) const
+{
+	return CachedGraphBuilder == &GraphBuilder;
+}
+
 #if UE_VERSION_OLDER_THAN(5, 0, 0)
 __declspec(noinline) FRDGTextureRef RegisterExternalTexture(FRDGBuilder& GraphBuilder, FRHITexture* Texture, const TCHAR* NameIfUnregistered)
 {
@@ -1220,20 +1528,37 @@ FRDGTexture* FFXBackendState::GetRDGTexture(FRDGBuilder& GraphBuilder, uint32 In
 	if (IsValidIndex(Index) && Resources[Index].Desc.type != FFX_RESOURCE_TYPE_BUFFER)
 	{
 		RDG = Resources[Index].RDG;
-		if (!RDG && Resources[Index].RT)
-		{
-			RDG = GetOrRegisterExternalTexture(GraphBuilder, Index);
-		}
-		else if (!RDG && Resources[Index].Resource)
+		if (!RDG)
 		{
+			const bool bCached = IsRDGCacheValid(GraphBuilder);
+			RDG = bCached ? CachedRDGTextures[Index] : nullptr;
+			if (RDG)
+			{
+				INC_DWORD_STAT(STAT_FFXRDGCacheHits);
+				NumRDGCacheHits++;
+			}
+			else if (Resources[Index].RT)
+			{
+				RDG = GetOrRegisterExternalTexture(GraphBuilder, Index);
+			}
+			else if (Resources[Index].Resource)
+			{
 #if (UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT) && defined(RHI_ENABLE_RESOURCE_INFO) && (RHI_ENABLE_RESOURCE_INFO != 0)
-			FRHIResourceInfo Info;
-			Resources[Index].Resource->GetResourceInfo(Info);
-			FString InfoName = Info.Name.ToString();
-			RDG = RegisterExternalTexture(GraphBuilder, (FRHITexture*)Resources[Index].Resource, *InfoName);
+				FRHIResourceInfo Info;
+				Resources[Index].Resource->GetResourceInfo(Info);
+				FString InfoName = Info.Name.ToString();
+				RDG = RegisterExternalTexture(GraphBuilder, (FRHITexture*)Resources[Index].Resource, *InfoName);
 #else
-			RDG = RegisterExternalTexture(GraphBuilder, (FRHITexture*)Resources[Index].Resource, nullptr);
+				RDG = RegisterExternalTexture(GraphBuilder, (FRHITexture*)Resources[Index].Resource, nullptr);
 #endif
+			}
+
+			if (RDG && bCached && !CachedRDGTextures[Index])
+			{
+				INC_DWORD_STAT(STAT_FFXRDGRegistrations);
+				NumRDGRegistrations++;
+				CachedRDGTextures[Index] = RDG;
+			}
 		}
 	}
 	return RDG;
@@ -1244,11 +1569,67 @@ FRDGBufferRef FFXBackendState::GetRDGBuffer(FRDGBuilder& GraphBuilder, uint32 In
 	FRDGBufferRef Buffer = nullptr;
 	if (IsValidIndex(Index) && Resources[Index].Desc.type == FFX_RESOURCE_TYPE_BUFFER)
 	{
-		Buffer = GraphBuilder.RegisterExternalBuffer(*(Resources[Index].PooledBuffer));
+		const bool bCached = IsRDGCacheValid(GraphBuilder);
+		Buffer = bCached ? CachedRDGBuffers[Index] : nullptr;
+		if (Buffer)
+		{
+			INC_DWORD_STAT(STAT_FFXRDGCacheHits);
+			NumRDGCacheHits++;
+		}
+		else
+		{
+			Buffer = GraphBuilder.RegisterExternalBuffer(*(Resources[Index].PooledBuffer));
+			if (bCached)
+			{
+				INC_DWORD_STAT(STAT_FFXRDGRegistrations);
+				NumRDGRegistrations++;
+				CachedRDGBuffers[Index] = Buffer;
+			}
+		}
 	}
 	return Buffer;
 }
 
+FRDGTextureUAVRef FFXBackendState::GetRDGTextureUAV(FRDGBuilder& GraphBuilder, uint32 Index, uint8 MipLevel)
+{
+	FRDGTextureUAVRef UAV = nullptr;
+	FRDGTexture* Texture = GetRDGTexture(GraphBuilder, Index);
+	if (Texture)
+	{
+		FRDGTextureUAV** CachedUAV = (IsRDGCacheValid(GraphBuilder) && MipLevel < FFX_RHI_MAX_CACHED_MIP_COUNT) ? &CachedRDGTextureUAVs[Index][MipLevel] : nullptr;
+		UAV = CachedUAV ? *CachedUAV : nullptr;
+		if (!UAV || UAV->Desc.Texture != Texture)
+		{
+			UAV = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(Texture, MipLevel));
+			if (CachedUAV)
+			{
+				*CachedUAV = UAV;
+			}
+		}
+	}
+	return UAV;
+}
+
+FRDGBufferUAVRef FFXBackendState::GetRDGBufferUAV(FRDGBuilder& GraphBuilder, uint32 Index)
+{
+	FRDGBufferUAVRef UAV = nullptr;
+	FRDGBufferRef Buffer = GetRDGBuffer(GraphBuilder, Index);
+	if (Buffer)
+	{
+		const bool bCached = IsRDGCacheValid(GraphBuilder);
+		UAV = bCached ? CachedRDGBufferUAVs[Index] : nullptr;
+		if (!UAV)
+		{
+			UAV = GraphBuilder.CreateUAV(Buffer, PF_R32_FLOAT);
+			if (bCached)
+			{
+				CachedRDGBufferUAVs[Index] = UAV;
+			}
+		}
+	}
+	return UAV;
+}
+
 TRefCountPtr<IPooledRenderTarget> FFXBackendState::GetPooledRT(uint32 Index)
 {
 	TRefCountPtr<IPooledRenderTarget> Res;
@@ -1279,20 +1660,50 @@ void FFXBackendState::RemoveResource(uint32 Index)
 		}
 		if (Resources[Index].RT)
 		{
-			delete Resources[Index].RT;
+			PooledRTs.Free(Resources[Index].RT);
 		}
 		if (Resources[Index].PooledBuffer)
 		{
-			delete Resources[Index].PooledBuffer;
+			PooledBuffers.Free(Resources[Index].PooledBuffer);
 		}
 		Resources[Index].PooledBuffer = nullptr;
 		Resources[Index].RDG = nullptr;
+		CachedRDGTextures[Index] = nullptr;
+		CachedRDGBuffers[Index] = nullptr;
+		FMemory::Memzero(CachedRDGTextureUAVs[Index]);
+		CachedRDGBufferUAVs[Index] = nullptr;
 		Resources[Index].RT = nullptr;
 		Resources[Index].Resource = nullptr;
 		FreeIndex(Index);
 	}
 }
 
+FfxGpuJobDescription* FFXBackendState::AllocJob(uint32 JobSize, uint32 ConstantSize)
+{
+	const uint32 RecordSize = sizeof(FFXJobRecordHeader) + Align(JobSize, 16) + Align(ConstantSize, 16);
+	if (JobArenaUsed + RecordSize > JobArenaSize)
+	{
+		// Records are only addressed by offset until the flush, so the arena is free to move when it grows.
+		JobArenaSize = FMath::Max(FMath::Max(JobArenaSize * 2, JobArenaUsed + RecordSize), 1024u * 1024u);
+		JobArena = (uint8*)FMemory::Realloc(JobArena, JobArenaSize, 16);
+	}
+
+	FFXJobRecordHeader* Record = (FFXJobRecordHeader*)(JobArena + JobArenaUsed);
+	Record->RecordSize = RecordSize;
+	Record->JobSize = JobSize;
+	JobArenaUsed += RecordSize;
+	return (FfxGpuJobDescription*)(Record + 1);
+}
+
+void FFXBackendState::ReleaseJobArena()
+{
+	FMemory::Free(JobArena);
+	JobArena = nullptr;
+	JobArenaSize = 0;
+	JobArenaUsed = 0;
+	NumJobs = 0;
+}
+
 FFXRHIBackend::FFXRHIBackend()
 {
 }
@@ -1333,6 +1744,12 @@ ffxReturnCode_t FFXRHIBackend::ffxCreateContext(ffxContext* context, ffxCreateCo
 	return Code;
 }
 
+FFXBackendState* FFXRHIBackend::GetBackendState(ffxContext* context)
+{
+	FFXRHIContext* RhiContext = (FFXRHIContext*)(context ? *context : nullptr);
+	return (RhiContext && RhiContext->Interface) ? (FFXBackendState*)RhiContext->Interface->scratchBuffer : nullptr;
+}
+
 ffxReturnCode_t FFXRHIBackend::ffxDestroyContext(ffxContext* context)
 {
 	FFXRHIContext* RhiContext = (FFXRHIContext*)(context ? *context : nullptr);
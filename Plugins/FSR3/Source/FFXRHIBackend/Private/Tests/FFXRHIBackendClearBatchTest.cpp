@@ -0,0 +1,163 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXRHIBackend.h"
+#include "FFXFSR3Settings.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && UE_VERSION_AT_LEAST(5, 0, 0)
+
+//-------------------------------------------------------------------------------------
+// Replays the clears FSR3 upscaling queues on a reset frame through FlushRenderJobs_UE with clear batching off and on,
+// counting the RDG passes each flush records. The copy in the middle has to see the clears before it, so it splits the batch.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXRHIBackendClearBatchTest, "FidelityFX.RHIBackend.ClearBatchPassCount", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFFXRHIBackendClearBatchTest::RunTest(const FString& Parameters)
+{
+	struct FMockResource
+	{
+		FfxResourceType Type;
+		FfxSurfaceFormat Format;
+		uint32 Width;
+		uint32 Height;
+		uint32 MipCount;
+	};
+	// Accumulation, scene luminance with its mip chain, frame info, reconstructed depth, atomic count and a copy target.
+	static const FMockResource MockResources[] =
+	{
+		{ FFX_RESOURCE_TYPE_TEXTURE2D, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT, 64, 64, 1 },
+		{ FFX_RESOURCE_TYPE_TEXTURE2D, FFX_SURFACE_FORMAT_R16_FLOAT, 64, 64, 7 },
+		{ FFX_RESOURCE_TYPE_TEXTURE2D, FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT, 1, 1, 1 },
+		{ FFX_RESOURCE_TYPE_TEXTURE2D, FFX_SURFACE_FORMAT_R32_UINT, 64, 64, 1 },
+		{ FFX_RESOURCE_TYPE_BUFFER, FFX_SURFACE_FORMAT_R32_UINT, 4, 1, 1 },
+		{ FFX_RESOURCE_TYPE_TEXTURE2D, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT, 64, 64, 1 },
+	};
+	static constexpr uint32 NumResources = UE_ARRAY_COUNT(MockResources);
+	static constexpr uint32 CopySource = 0;
+	static constexpr uint32 CopyTarget = 5;
+	// Every resource but the copy target is cleared, then the accumulation is copied and the per frame targets are cleared again.
+	static const uint32 SecondClears[] = { 3, 4 };
+
+	static constexpr uint32 NumRuns = 2;
+	uint32 Passes[NumRuns] = {};
+	uint32 Clears[NumRuns] = {};
+	bool bFlushesOk = true;
+
+	IConsoleVariable* BatchClears = CVarFSR3BatchRHIClears.AsVariable();
+	const int32 PreviousBatchClears = BatchClears->GetInt();
+
+	const size_t ScratchSize = ffxGetScratchMemorySizeUE();
+	void* Scratch = FMemory::Malloc(ScratchSize);
+
+	for (uint32 Run = 0; Run < NumRuns; Run++)
+	{
+		BatchClears->Set(int32(Run), ECVF_SetByCode);
+		FMemory::Memzero(Scratch, ScratchSize);
+
+		ENQUEUE_RENDER_COMMAND(FFXRHIBackendClearBatchTest)([&, Run](FRHICommandListImmediate& RHICmdList)
+		{
+			FfxInterface Interface;
+			ffxGetInterfaceUE(&Interface, Scratch, ScratchSize);
+			FFXBackendState* Context = (FFXBackendState*)Scratch;
+
+			FfxUInt32 EffectContextId = 0;
+			Interface.fpCreateBackendContext(&Interface, FFX_EFFECT_FSR3UPSCALER, nullptr, &EffectContextId);
+
+			FfxResourceInternal Resources[NumResources];
+			for (uint32 i = 0; i < NumResources; i++)
+			{
+				const FMockResource& Mock = MockResources[i];
+				FfxCreateResourceDescription Desc = {};
+				Desc.heapType = FFX_HEAP_TYPE_DEFAULT;
+				Desc.resourceDescription.type = Mock.Type;
+				Desc.resourceDescription.format = Mock.Format;
+				Desc.resourceDescription.width = Mock.Width;
+				Desc.resourceDescription.height = Mock.Height;
+				Desc.resourceDescription.depth = 1;
+				Desc.resourceDescription.mipCount = Mock.MipCount;
+				Desc.resourceDescription.usage = FFX_RESOURCE_USAGE_UAV;
+				Desc.initialState = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+				Desc.name = L"FFXRHIBackendClearBatchTest";
+				Interface.fpCreateResource(&Interface, &Desc, EffectContextId, &Resources[i]);
+			}
+
+			auto ScheduleClear = [&](uint32 Index)
+			{
+				FfxGpuJobDescription Job = {};
+				Job.jobType = FFX_GPU_JOB_CLEAR_FLOAT;
+				Job.clearJobDescriptor.target = Resources[Index];
+				Interface.fpScheduleGpuJob(&Interface, &Job);
+				Clears[Run] += MockResources[Index].MipCount;
+			};
+
+			for (uint32 i = 0; i < NumResources; i++)
+			{
+				if (i != CopyTarget)
+				{
+					ScheduleClear(i);
+				}
+			}
+
+			FfxGpuJobDescription Barrier = {};
+			Barrier.jobType = FFX_GPU_JOB_BARRIER;
+			Interface.fpScheduleGpuJob(&Interface, &Barrier);
+
+			FfxGpuJobDescription Copy = {};
+			Copy.jobType = FFX_GPU_JOB_COPY;
+			Copy.copyJobDescriptor.src = Resources[CopySource];
+			Copy.copyJobDescriptor.dst = Resources[CopyTarget];
+			Interface.fpScheduleGpuJob(&Interface, &Copy);
+
+			for (uint32 Index : SecondClears)
+			{
+				ScheduleClear(Index);
+			}
+
+			FRDGBuilder GraphBuilder(RHICmdList);
+			bFlushesOk &= Interface.fpExecuteGpuJobs(&Interface, (FfxCommandList)&GraphBuilder, EffectContextId) == FFX_OK;
+			Passes[Run] = Context->NumRDGPasses;
+			GraphBuilder.Execute();
+
+			for (const FfxResourceInternal& Resource : Resources)
+			{
+				Interface.fpDestroyResource(&Interface, Resource, EffectContextId);
+			}
+			Interface.fpDestroyBackendContext(&Interface, EffectContextId);
+		});
+		FlushRenderingCommands();
+	}
+
+	FMemory::Free(Scratch);
+	BatchClears->Set(PreviousBatchClears, ECVF_SetByCode);
+
+	AddInfo(FString::Printf(TEXT("RDG passes for %u cleared UAVs and one copy: %u unbatched, %u batched"), Clears[0], Passes[0], Passes[1]));
+
+	TestTrue(TEXT("Both job lists flushed"), bFlushesOk);
+	TestEqual(TEXT("Unbatched flush records one pass per cleared UAV plus the copy"), Passes[0], Clears[0] + 1);
+	// The copy splits the clears into two batches, each well under FFX_MAX_CLEAR_BATCH_COUNT UAVs per kind.
+	TestEqual(TEXT("Batched flush records one pass per run of clears plus the copy"), Passes[1], 3u);
+
+	return true;
+}
+
+#endif
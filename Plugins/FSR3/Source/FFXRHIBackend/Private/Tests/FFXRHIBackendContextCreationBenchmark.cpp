@@ -0,0 +1,142 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXRHIBackend.h"
+#include "FFXFSR3.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Modules/ModuleManager.h"
+#include "RenderingThread.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && UE_VERSION_AT_LEAST(5, 0, 0)
+
+//-------------------------------------------------------------------------------------
+// Creates FSR3 upscaling contexts through the RHI backend up to an 8K max render size and reports how long creation takes,
+// the GPU memory the context reports, the process memory it keeps and the init data CreateResource_UE had to stage in transient memory.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXRHIBackendContextCreationBenchmark, "FidelityFX.RHIBackend.ContextCreationBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FFFXRHIBackendContextCreationBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr uint32 NumIterations = 4;
+	struct FConfig
+	{
+		const TCHAR* Name;
+		uint32 RenderWidth;
+		uint32 RenderHeight;
+		uint32 UpscaleWidth;
+		uint32 UpscaleHeight;
+	};
+	static const FConfig Configs[] =
+	{
+		{ TEXT("1080p -> 4K"), 1920, 1080, 3840, 2160 },
+		{ TEXT("4K -> 8K"), 3840, 2160, 7680, 4320 },
+		{ TEXT("8K native"), 7680, 4320, 7680, 4320 },
+	};
+
+	IFFXSharedBackendModule* RHIBackend = FModuleManager::GetModulePtr<IFFXSharedBackendModule>(TEXT("FFXRHIBackend"));
+	FFXRHIBackend* Backend = RHIBackend ? (FFXRHIBackend*)RHIBackend->GetBackend() : nullptr;
+	if (!Backend)
+	{
+		AddWarning(TEXT("The FFXRHIBackend module is not loaded."));
+		return true;
+	}
+
+	ENQUEUE_RENDER_COMMAND(FFXRHIBackendContextCreationBenchmark)([this, Backend](FRHICommandListImmediate& RHICmdList)
+	{
+		for (const FConfig& Config : Configs)
+		{
+			double MinSeconds = DBL_MAX;
+			double TotalSeconds = 0.0;
+			uint64 GpuMemoryUsage = 0;
+			int64 RetainedBytes = 0;
+			uint32 NumResourcesCreated = 0;
+			uint32 NumInitDataConversions = 0;
+			uint64 ConvertedInitDataBytes = 0;
+			uint64 PeakConvertedInitDataBytes = 0;
+			uint32 NumCreated = 0;
+
+			for (uint32 Iteration = 0; Iteration < NumIterations; Iteration++)
+			{
+				ffxCreateContextDescUpscale Params;
+				FMemory::Memzero(Params);
+				Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE;
+				Params.flags = FFX_UPSCALE_ENABLE_HIGH_DYNAMIC_RANGE | FFX_UPSCALE_ENABLE_DEPTH_INFINITE | FFX_UPSCALE_ENABLE_AUTO_EXPOSURE;
+				Params.flags |= bool(ERHIZBuffer::IsInverted) ? FFX_UPSCALE_ENABLE_DEPTH_INVERTED : 0;
+				Params.maxRenderSize.width = Config.RenderWidth;
+				Params.maxRenderSize.height = Config.RenderHeight;
+				Params.maxUpscaleSize.width = Config.UpscaleWidth;
+				Params.maxUpscaleSize.height = Config.UpscaleHeight;
+
+				ffxContext Context = nullptr;
+				const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+				const double StartTime = FPlatformTime::Seconds();
+				const ffxReturnCode_t Code = Backend->ffxCreateContext(&Context, &Params.header);
+				const double Seconds = FPlatformTime::Seconds() - StartTime;
+				if (Code != FFX_API_RETURN_OK)
+				{
+					AddError(FString::Printf(TEXT("%s: ffxCreateContext failed with %u"), Config.Name, Code));
+					break;
+				}
+
+				// The first creation also pays for loading the shaders, so the fastest one is reported alongside the mean.
+				MinSeconds = FMath::Min(MinSeconds, Seconds);
+				TotalSeconds += Seconds;
+				NumCreated++;
+				RetainedBytes = int64(FPlatformMemory::GetStats().UsedPhysical) - int64(UsedBefore);
+
+				FfxApiEffectMemoryUsage MemoryUsage = {};
+				ffxQueryDescUpscaleGetGPUMemoryUsage MemoryDesc;
+				MemoryDesc.header.pNext = nullptr;
+				MemoryDesc.header.type = FFX_API_QUERY_DESC_TYPE_UPSCALE_GPU_MEMORY_USAGE;
+				MemoryDesc.gpuMemoryUsageUpscaler = &MemoryUsage;
+				GpuMemoryUsage = (Backend->ffxQuery(&Context, &MemoryDesc.header) == FFX_API_RETURN_OK) ? MemoryUsage.totalUsageInBytes : 0;
+
+				if (FFXBackendState* State = FFXRHIBackend::GetBackendState(&Context))
+				{
+					NumResourcesCreated = State->NumResourcesCreated;
+					NumInitDataConversions = State->NumInitDataConversions;
+					ConvertedInitDataBytes = State->ConvertedInitDataBytes;
+					PeakConvertedInitDataBytes = State->PeakConvertedInitDataBytes;
+				}
+
+				Backend->ffxDestroyContext(&Context);
+			}
+
+			if (NumCreated)
+			{
+				AddInfo(FString::Printf(TEXT("%s: create %.2f ms (mean %.2f ms over %u), GPU %.1f MB, process memory kept %.1f MB"),
+					Config.Name, MinSeconds * 1000.0, TotalSeconds * 1000.0 / NumCreated, NumCreated, GpuMemoryUsage / (1024.0 * 1024.0), RetainedBytes / (1024.0 * 1024.0)));
+				AddInfo(FString::Printf(TEXT("%s: %u resources, %u init data conversions, %llu bytes converted, peak transient %llu bytes"),
+					Config.Name, NumResourcesCreated, NumInitDataConversions, ConvertedInitDataBytes, PeakConvertedInitDataBytes));
+
+				// Init data is only ever a lookup table or a 1x1 default, staging it mustn't grow with the render size.
+				TestTrue(FString::Printf(TEXT("%s: peak transient init data stays under 64 KB"), Config.Name), PeakConvertedInitDataBytes < 64 * 1024);
+			}
+		}
+	});
+	FlushRenderingCommands();
+
+	return true;
+}
+
+#endif
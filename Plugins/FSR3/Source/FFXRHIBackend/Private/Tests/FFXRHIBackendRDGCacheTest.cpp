@@ -0,0 +1,121 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXRHIBackend.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && UE_VERSION_AT_LEAST(5, 0, 0)
+
+//-------------------------------------------------------------------------------------
+// Drives FlushRenderJobs_UE with a mock job list against graph builders that are created on the stack one after the other,
+// as the renderer does within a single frame. Each flush has to register every resource exactly once with its own builder,
+// never handing out a reference cached from the previous builder.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXRHIBackendRDGCacheTest, "FidelityFX.RHIBackend.RDGRegistrationCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFFXRHIBackendRDGCacheTest::RunTest(const FString& Parameters)
+{
+	static constexpr uint32 NumTextures = 2;
+	static constexpr uint32 NumBuffers = 1;
+	static constexpr uint32 NumClearsPerResource = 4;
+	static constexpr uint32 NumFlushes = 3;
+
+	const size_t ScratchSize = ffxGetScratchMemorySizeUE();
+	void* Scratch = FMemory::Malloc(ScratchSize);
+	FMemory::Memzero(Scratch, ScratchSize);
+
+	uint32 Registrations[NumFlushes] = {};
+	uint32 CacheHits[NumFlushes] = {};
+	FRDGBuilder* Builders[NumFlushes] = {};
+	bool bFlushesOk = true;
+
+	ENQUEUE_RENDER_COMMAND(FFXRHIBackendRDGCacheTest)([&](FRHICommandListImmediate& RHICmdList)
+	{
+		FfxInterface Interface;
+		ffxGetInterfaceUE(&Interface, Scratch, ScratchSize);
+		FFXBackendState* Context = (FFXBackendState*)Scratch;
+
+		FfxUInt32 EffectContextId = 0;
+		Interface.fpCreateBackendContext(&Interface, FFX_EFFECT_FSR3UPSCALER, nullptr, &EffectContextId);
+
+		FfxResourceInternal Resources[NumTextures + NumBuffers];
+		for (uint32 i = 0; i < NumTextures + NumBuffers; i++)
+		{
+			FfxCreateResourceDescription Desc = {};
+			Desc.heapType = FFX_HEAP_TYPE_DEFAULT;
+			Desc.resourceDescription.type = i < NumTextures ? FFX_RESOURCE_TYPE_TEXTURE2D : FFX_RESOURCE_TYPE_BUFFER;
+			Desc.resourceDescription.format = i < NumTextures ? FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT : FFX_SURFACE_FORMAT_R32_FLOAT;
+			Desc.resourceDescription.width = i < NumTextures ? 64 : 256;
+			Desc.resourceDescription.height = i < NumTextures ? 64 : 4;
+			Desc.resourceDescription.depth = 1;
+			Desc.resourceDescription.mipCount = 1;
+			Desc.resourceDescription.usage = FFX_RESOURCE_USAGE_UAV;
+			Desc.initialState = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+			Desc.name = L"FFXRHIBackendRDGCacheTest";
+			Interface.fpCreateResource(&Interface, &Desc, EffectContextId, &Resources[i]);
+		}
+
+		for (uint32 Flush = 0; Flush < NumFlushes; Flush++)
+		{
+			FRDGBuilder GraphBuilder(RHICmdList);
+			Builders[Flush] = &GraphBuilder;
+
+			for (uint32 Clear = 0; Clear < NumClearsPerResource; Clear++)
+			{
+				for (const FfxResourceInternal& Resource : Resources)
+				{
+					FfxGpuJobDescription Job = {};
+					Job.jobType = FFX_GPU_JOB_CLEAR_FLOAT;
+					Job.clearJobDescriptor.target = Resource;
+					Interface.fpScheduleGpuJob(&Interface, &Job);
+				}
+			}
+
+			bFlushesOk &= Interface.fpExecuteGpuJobs(&Interface, (FfxCommandList)&GraphBuilder, EffectContextId) == FFX_OK;
+			Registrations[Flush] = Context->NumRDGRegistrations;
+			CacheHits[Flush] = Context->NumRDGCacheHits;
+
+			// Any reference cached from the previous builder would trip RDG validation here.
+			GraphBuilder.Execute();
+		}
+
+		Interface.fpDestroyBackendContext(&Interface, EffectContextId);
+	});
+	FlushRenderingCommands();
+	FMemory::Free(Scratch);
+
+	TestTrue(TEXT("Every mock job list flushed"), bFlushesOk);
+	for (uint32 Flush = 0; Flush < NumFlushes; Flush++)
+	{
+		// The clear path looks each texture up again for its UAV, so every lookup after the first one per resource is a hit.
+		TestEqual(FString::Printf(TEXT("Registrations in flush %u"), Flush), Registrations[Flush], NumTextures + NumBuffers);
+		TestEqual(FString::Printf(TEXT("Cache hits in flush %u"), Flush), CacheHits[Flush], (NumTextures * 2 + NumBuffers) * NumClearsPerResource - (NumTextures + NumBuffers));
+	}
+	if (Builders[0] != Builders[1])
+	{
+		AddInfo(TEXT("Consecutive graph builders did not share an address, so the stale builder case was not exercised."));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,308 @@
+// This file is part of the FidelityFX Super Resolution 3.1 Unreal Engine Plugin.
+//
+// Copyright (c) 2023-2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FFXRHIBackend.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Counts live instances so the slab can be checked for constructing and destroying each slot exactly once.
+	struct FFFXSlabTestItem
+	{
+		static int32 NumLive;
+		uint32 Value = 0;
+
+		FFFXSlabTestItem() { ++NumLive; }
+		~FFFXSlabTestItem() { --NumLive; }
+	};
+	int32 FFFXSlabTestItem::NumLive = 0;
+
+	template<typename T>
+	T* NewZeroed()
+	{
+		// FFXBackendState and everything in it starts out as zeroed scratch memory, never constructed.
+		T* Item = (T*)FMemory::Malloc(sizeof(T), alignof(T));
+		FMemory::Memzero(Item, sizeof(T));
+		return Item;
+	}
+
+	template<uint32 Capacity>
+	uint32 FindFirstLinear(const TArray<bool>& Expected)
+	{
+		for (uint32 Index = 0; Index < Capacity; Index++)
+		{
+			if (Expected[Index])
+			{
+				return Index;
+			}
+		}
+		return ~0u;
+	}
+
+	// Random sets and clears against a plain array, checking FindFirst and every word after each step.
+	template<uint32 Capacity>
+	bool StressIndexBitmap(FAutomationTestBase& Test, int32 NumSteps, int32 Seed)
+	{
+		TFFXIndexBitmap<Capacity>* Bitmap = NewZeroed<TFFXIndexBitmap<Capacity>>();
+		TArray<bool> Expected;
+		Expected.SetNumZeroed(Capacity);
+		FRandomStream Random(Seed);
+		bool bMatches = Bitmap->FindFirst() == ~0u;
+
+		for (int32 Step = 0; Step < NumSteps && bMatches; Step++)
+		{
+			// Clustered indices so whole words fill up and empty out, which is when the summary bits change.
+			const uint32 Word = uint32(Random.RandHelper(Capacity / 64));
+			const uint32 Index = Word * 64 + uint32(Random.RandHelper(Random.RandHelper(2) ? 4 : 64));
+			if (Random.RandHelper(2))
+			{
+				Bitmap->Set(Index);
+				Expected[Index] = true;
+			}
+			else
+			{
+				Bitmap->Clear(Index);
+				Expected[Index] = false;
+			}
+
+			bMatches &= Bitmap->FindFirst() == FindFirstLinear<Capacity>(Expected);
+			bMatches &= Bitmap->IsSet(Index) == Expected[Index];
+			for (uint32 WordIndex = 0; WordIndex < TFFXIndexBitmap<Capacity>::WordCount; WordIndex++)
+			{
+				bMatches &= ((Bitmap->Summary >> WordIndex) & 1) == (Bitmap->Words[WordIndex] != 0 ? 1u : 0u);
+			}
+		}
+
+		Bitmap->SetAll();
+		bMatches &= Bitmap->FindFirst() == 0 && Bitmap->IsSet(Capacity - 1) && !Bitmap->IsSet(Capacity);
+		for (uint32 Index = 0; Index < Capacity; Index++)
+		{
+			Bitmap->Clear(Index);
+		}
+		bMatches &= Bitmap->FindFirst() == ~0u && Bitmap->Summary == 0;
+
+		FMemory::Free(Bitmap);
+		Test.TestTrue(FString::Printf(TEXT("TFFXIndexBitmap<%u> matches a linear scan"), Capacity), bMatches);
+		return bMatches;
+	}
+}
+
+//-------------------------------------------------------------------------------------
+// Churns the bitmap and the slab the way resource creation and destruction does, checking that no index or slot is
+// ever handed out twice, that slots are reused lowest first, and that every item is constructed and destroyed once.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXRHIBackendSlabStressTest, "FidelityFX.RHIBackend.Slab.NoDoubleAllocation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FFFXRHIBackendSlabStressTest::RunTest(const FString& Parameters)
+{
+	StressIndexBitmap<64>(*this, 20000, 1);
+	StressIndexBitmap<FFX_RHI_MAX_RESOURCE_COUNT>(*this, 50000, 2);
+	// 64 words, where the summary uses every bit
+	StressIndexBitmap<4096>(*this, 200000, 3);
+
+	using FTestSlab = TFFXSlab<FFFXSlabTestItem, FFX_RHI_MAX_RESOURCE_COUNT>;
+	FTestSlab* Slab = NewZeroed<FTestSlab>();
+	Slab->Init();
+
+	TArray<FFFXSlabTestItem*> Allocated;
+	TSet<FFFXSlabTestItem*> Outstanding;
+	FRandomStream Random(32);
+	bool bNoDoubleAllocation = true;
+	bool bLowestFirst = true;
+	bool bFreshItems = true;
+	uint32 NextValue = 1;
+
+	for (int32 Step = 0; Step < 200000; Step++)
+	{
+		// Alternates between filling the slab up and draining it so both ends of the capacity get exercised.
+		const bool bFilling = (Step / 5000) % 2 == 0;
+		const bool bAlloc = Allocated.Num() == 0 || (Allocated.Num() < int32(FFX_RHI_MAX_RESOURCE_COUNT) && Random.RandHelper(4) < (bFilling ? 3 : 1));
+		if (bAlloc)
+		{
+			const uint32 ExpectedIndex = Slab->FreeSlots.FindFirst();
+			FFFXSlabTestItem* Item = Slab->Alloc();
+			bNoDoubleAllocation &= !Outstanding.Contains(Item);
+			bLowestFirst &= Item == (FFFXSlabTestItem*)Slab->Storage[ExpectedIndex];
+			bFreshItems &= Item->Value == 0;
+			Item->Value = NextValue++;
+			Outstanding.Add(Item);
+			Allocated.Add(Item);
+		}
+		else
+		{
+			FFFXSlabTestItem* Item = Allocated[Random.RandHelper(Allocated.Num())];
+			Allocated.RemoveSingleSwap(Item);
+			Outstanding.Remove(Item);
+			Slab->Free(Item);
+		}
+
+		bNoDoubleAllocation &= FFFXSlabTestItem::NumLive == Allocated.Num();
+	}
+
+	TestTrue(TEXT("No slot was handed out while still in use"), bNoDoubleAllocation);
+	TestTrue(TEXT("Slots are reused lowest index first"), bLowestFirst);
+	TestTrue(TEXT("Every allocation is freshly constructed"), bFreshItems);
+
+	// Fill to capacity, then every slot has to be distinct.
+	while (Allocated.Num() < int32(FFX_RHI_MAX_RESOURCE_COUNT))
+	{
+		FFFXSlabTestItem* Item = Slab->Alloc();
+		TestFalse(TEXT("Slot handed out twice when filling up"), Outstanding.Contains(Item));
+		Outstanding.Add(Item);
+		Allocated.Add(Item);
+	}
+	TestEqual(TEXT("No free slot left at capacity"), Slab->FreeSlots.FindFirst(), ~0u);
+
+	for (FFFXSlabTestItem* Item : Allocated)
+	{
+		Slab->Free(Item);
+	}
+	TestEqual(TEXT("Every item was destroyed"), FFFXSlabTestItem::NumLive, 0);
+	TestEqual(TEXT("Every slot is free again"), Slab->FreeSlots.FindFirst(), 0u);
+
+	FMemory::Free(Slab);
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+// Resource churn through the slab against the heap allocation per resource it replaced, and FindFirst against
+// the linear scan over FFXBackendState::Resources it replaced. Reports the cost per operation, doesn't fail on timings.
+//-------------------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFFXRHIBackendSlabBenchmark, "FidelityFX.RHIBackend.Slab.ChurnBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FFFXRHIBackendSlabBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumOperations = 2000000;
+	// Roughly what an upscaler and frame interpolation context keep alive, with the transient ones churning on top.
+	static constexpr int32 NumLive = 160;
+
+	// The same sequence of frees for both allocators.
+	TArray<int32> FreeOrder;
+	FreeOrder.SetNumUninitialized(NumOperations);
+	FRandomStream Random(7);
+	for (int32& Index : FreeOrder)
+	{
+		Index = Random.RandHelper(NumLive);
+	}
+
+	using FRTSlab = TFFXSlab<TRefCountPtr<IPooledRenderTarget>, FFX_RHI_MAX_RESOURCE_COUNT>;
+	FRTSlab* Slab = NewZeroed<FRTSlab>();
+	Slab->Init();
+
+	TArray<TRefCountPtr<IPooledRenderTarget>*> Live;
+	Live.SetNumUninitialized(NumLive);
+
+	for (TRefCountPtr<IPooledRenderTarget>*& Item : Live)
+	{
+		Item = Slab->Alloc();
+	}
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Index : FreeOrder)
+	{
+		Slab->Free(Live[Index]);
+		Live[Index] = Slab->Alloc();
+	}
+	const double SlabSeconds = FPlatformTime::Seconds() - StartTime;
+	for (TRefCountPtr<IPooledRenderTarget>* Item : Live)
+	{
+		Slab->Free(Item);
+	}
+	FMemory::Free(Slab);
+
+	for (TRefCountPtr<IPooledRenderTarget>*& Item : Live)
+	{
+		Item = new TRefCountPtr<IPooledRenderTarget>();
+	}
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index : FreeOrder)
+	{
+		delete Live[Index];
+		Live[Index] = new TRefCountPtr<IPooledRenderTarget>();
+	}
+	const double HeapSeconds = FPlatformTime::Seconds() - StartTime;
+	for (TRefCountPtr<IPooledRenderTarget>* Item : Live)
+	{
+		delete Item;
+	}
+
+	// Finding the lowest free resource index, with holes left below the live ones as contexts come and go.
+	TArray<uint32> LiveIndices;
+	for (uint32 Index = 0; Index < FFX_RHI_MAX_RESOURCE_COUNT; Index++)
+	{
+		LiveIndices.Add(Index);
+	}
+	while (LiveIndices.Num() > NumLive)
+	{
+		LiveIndices.RemoveAtSwap(Random.RandHelper(LiveIndices.Num()));
+	}
+
+	TFFXIndexBitmap<FFX_RHI_MAX_RESOURCE_COUNT>* FreeIndices = NewZeroed<TFFXIndexBitmap<FFX_RHI_MAX_RESOURCE_COUNT>>();
+	FreeIndices->SetAll();
+	TArray<bool> InUse;
+	InUse.SetNumZeroed(FFX_RHI_MAX_RESOURCE_COUNT);
+	for (uint32 Index : LiveIndices)
+	{
+		FreeIndices->Clear(Index);
+		InUse[Index] = true;
+	}
+	TArray<uint32> LinearLiveIndices = LiveIndices;
+
+	uint64 Checksum = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index : FreeOrder)
+	{
+		FreeIndices->Set(LiveIndices[Index]);
+		LiveIndices[Index] = FreeIndices->FindFirst();
+		FreeIndices->Clear(LiveIndices[Index]);
+		Checksum += LiveIndices[Index];
+	}
+	const double BitmapSeconds = FPlatformTime::Seconds() - StartTime;
+
+	uint64 LinearChecksum = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index : FreeOrder)
+	{
+		InUse[LinearLiveIndices[Index]] = false;
+		uint32 Found = 0;
+		while (InUse[Found])
+		{
+			Found++;
+		}
+		InUse[Found] = true;
+		LinearLiveIndices[Index] = Found;
+		LinearChecksum += Found;
+	}
+	const double LinearSeconds = FPlatformTime::Seconds() - StartTime;
+	FMemory::Free(FreeIndices);
+
+	TestEqual(TEXT("Bitmap and linear scan find the same indices"), Checksum, LinearChecksum);
+
+	const double ToNs = 1e9 / NumOperations;
+	AddInfo(FString::Printf(TEXT("Free + alloc: slab %.1f ns, heap %.1f ns"), SlabSeconds * ToNs, HeapSeconds * ToNs));
+	AddInfo(FString::Printf(TEXT("Free index lookup with %d live: bitmap %.1f ns, linear scan %.1f ns"), NumLive, BitmapSeconds * ToNs, LinearSeconds * ToNs));
+
+	return true;
+}
+
+#endif
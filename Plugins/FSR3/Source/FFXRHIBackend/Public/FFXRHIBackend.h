@@ -60,9 +60,96 @@ THIRD_PARTY_INCLUDES_END
 // The maximum number of resources that can be allocated.
 //-------------------------------------------------------------------------------------
 #define FFX_RHI_MAX_RESOURCE_COUNT (256)
-#define FFX_MAX_BLOCK_RESOURCE_COUNT (64)
-#define FFX_MAX_BLOCK_COUNT (4)
-#define FFX_MAX_JOB_COUNT (128)
+#define FFX_RHI_MAX_CACHED_MIP_COUNT (16)
+
+//-------------------------------------------------------------------------------------
+// Fixed size set of indices stored as a two level bitmap: each bit of Summary flags a non-empty word of Words,
+// so finding the first set index takes two count-trailing-zeros however full the set is.
+// Lives in the zero initialised scratch memory of FFXBackendState, so it has to stay trivially constructible.
+//-------------------------------------------------------------------------------------
+template<uint32 Capacity>
+struct TFFXIndexBitmap
+{
+	static_assert(Capacity % 64 == 0 && Capacity <= 64 * 64, "TFFXIndexBitmap capacity must be a multiple of 64 and at most 4096");
+	static constexpr uint32 WordCount = Capacity / 64;
+
+	uint64 Summary;
+	uint64 Words[WordCount];
+
+	void SetAll()
+	{
+		for (uint32 i = 0; i < WordCount; i++)
+		{
+			Words[i] = ~0llu;
+		}
+		Summary = (WordCount == 64) ? ~0llu : ((1llu << WordCount) - 1);
+	}
+
+	bool IsSet(uint32 Index) const
+	{
+		return Index < Capacity && (Words[Index / 64] & (1llu << uint64(Index % 64))) != 0;
+	}
+
+	void Set(uint32 Index)
+	{
+		check(Index < Capacity);
+		Words[Index / 64] |= (1llu << uint64(Index % 64));
+		Summary |= (1llu << uint64(Index / 64));
+	}
+
+	void Clear(uint32 Index)
+	{
+		check(Index < Capacity);
+		uint64& Word = Words[Index / 64];
+		Word &= ~(1llu << uint64(Index % 64));
+		if (Word == 0)
+		{
+			Summary &= ~(1llu << uint64(Index / 64));
+		}
+	}
+
+	// Returns ~0u when no index is set.
+	uint32 FindFirst() const
+	{
+		if (Summary == 0)
+		{
+			return ~0u;
+		}
+		const uint32 Word = (uint32)FMath::CountTrailingZeros64(Summary);
+		return Word * 64 + (uint32)FMath::CountTrailingZeros64(Words[Word]);
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Fixed capacity pool of objects in the backend scratch memory, replacing one heap allocation per resource.
+//-------------------------------------------------------------------------------------
+template<typename T, uint32 Capacity>
+struct TFFXSlab
+{
+	TFFXIndexBitmap<Capacity> FreeSlots;
+	alignas(T) uint8 Storage[Capacity][sizeof(T)];
+
+	void Init()
+	{
+		FreeSlots.SetAll();
+	}
+
+	T* Alloc()
+	{
+		const uint32 Index = FreeSlots.FindFirst();
+		check(Index < Capacity);
+		FreeSlots.Clear(Index);
+		return new (Storage[Index]) T();
+	}
+
+	void Free(T* Item)
+	{
+		const uint32 Index = uint32(((uint8*)Item - Storage[0]) / sizeof(T));
+		check(Index < Capacity && !FreeSlots.IsSet(Index));
+		Item->~T();
+		FreeSlots.Set(Index);
+	}
+};
 
 //-------------------------------------------------------------------------------------
 // State data for the FFX SDK backend that manages mapping resources between UE & FFX SDK.
@@ -79,17 +166,40 @@ struct FFXRHIBACKEND_API FFXBackendState
 		TRefCountPtr<FRDGPooledBuffer>* PooledBuffer;
 	} Resources[FFX_RHI_MAX_RESOURCE_COUNT];
 
-	struct Block
-	{
-		uint64 ResourceMask;
-		uint64 DynamicMask;
-	} Blocks[FFX_MAX_BLOCK_COUNT];
+	TFFXIndexBitmap<FFX_RHI_MAX_RESOURCE_COUNT> FreeIndices;
+	TFFXIndexBitmap<FFX_RHI_MAX_RESOURCE_COUNT> DynamicIndices;
+	TFFXSlab<TRefCountPtr<IPooledRenderTarget>, FFX_RHI_MAX_RESOURCE_COUNT> PooledRTs;
+	TFFXSlab<TRefCountPtr<FRDGPooledBuffer>, FFX_RHI_MAX_RESOURCE_COUNT> PooledBuffers;
+
+	// External textures & buffers registered during the current job list flush, so each resource is only registered once per flush.
+	FRDGBuilder* CachedGraphBuilder;
+	uint32 NumRDGRegistrations;
+	uint32 NumRDGCacheHits;
+	// Passes recorded into the graph builder by the current job list flush.
+	uint32 NumRDGPasses;
+	FRDGTexture* CachedRDGTextures[FFX_RHI_MAX_RESOURCE_COUNT];
+	FRDGBuffer* CachedRDGBuffers[FFX_RHI_MAX_RESOURCE_COUNT];
+	FRDGTextureUAV* CachedRDGTextureUAVs[FFX_RHI_MAX_RESOURCE_COUNT][FFX_RHI_MAX_CACHED_MIP_COUNT];
+	FRDGBufferUAV* CachedRDGBufferUAVs[FFX_RHI_MAX_RESOURCE_COUNT];
+
+	// Init data CreateResource_UE had to convert or fill into transient memory rather than upload from the caller's memory in place.
+	uint32 NumResourcesCreated;
+	uint32 NumInitDataConversions;
+	uint64 ConvertedInitDataBytes;
+	uint64 PeakConvertedInitDataBytes;
 
 	uint8 StagingRingBuffer[FFX_ALIGN_UP(FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t))];
 	uint32 StagingRingBufferBase;
 
-	FfxGpuJobDescription Jobs[FFX_MAX_JOB_COUNT];
+	// Jobs scheduled since the last flush, stored back to back with their constants in an arena that is reused every frame.
+	uint8* JobArena;
+	uint32 JobArenaSize;
+	uint32 JobArenaUsed;
 	uint32 NumJobs;
+
+	// r.FidelityFX.FSR3.RecordRHIJobLists value last seen by this context and how many of its job lists are still to be recorded.
+	int32 LastRecordRequest;
+	int32 NumJobListsToRecord;
 	ERHIFeatureLevel::Type FeatureLevel;
 	FfxDevice device;
 	uint32 EffectIndex;
@@ -98,8 +208,10 @@ struct FFXRHIBACKEND_API FFXBackendState
 	uint32 GetEffectId(uint32 Index);
 	void SetEffectId(uint32 Index, uint32 EffectId);
 
+	void InitIndices();
 	uint32 AllocIndex();
 	void MarkDynamic(uint32 Index);
+	bool IsDynamicIndex(uint32 Index);
 	uint32 GetDynamicIndex();
 	bool IsValidIndex(uint32 Index);
 	void FreeIndex(uint32 Index);
@@ -108,17 +220,29 @@ struct FFXRHIBACKEND_API FFXBackendState
 
 	FRHIResource* GetResource(uint32 Index);
 
+	void BeginRDGCache(FRDGBuilder& GraphBuilder);
+	void EndRDGCache();
+	bool IsRDGCacheValid(FRDGBuilder& GraphBuilder) const;
+
 	FRDGTextureRef GetOrRegisterExternalTexture(FRDGBuilder& GraphBuilder, uint32 Index);
 
 	FRDGTexture* GetRDGTexture(FRDGBuilder& GraphBuilder, uint32 Index);
 
 	FRDGBufferRef GetRDGBuffer(FRDGBuilder& GraphBuilder, uint32 Index);
 
+	FRDGTextureUAVRef GetRDGTextureUAV(FRDGBuilder& GraphBuilder, uint32 Index, uint8 MipLevel);
+
+	FRDGBufferUAVRef GetRDGBufferUAV(FRDGBuilder& GraphBuilder, uint32 Index);
+
 	TRefCountPtr<IPooledRenderTarget> GetPooledRT(uint32 Index);
 
 	FfxResourceType GetType(uint32 Index);
 
 	void RemoveResource(uint32 Index);
+
+	FfxGpuJobDescription* AllocJob(uint32 JobSize, uint32 ConstantSize);
+
+	void ReleaseJobArena();
 };
 
 //-------------------------------------------------------------------------------------
@@ -162,4 +286,7 @@ public:
 	bool GetAverageFrameTimes(float& AvgTimeMs, float& AvgFPS) final;
 	void CopySubRect(FfxCommandList CmdList, FfxApiResource Src, FfxApiResource Dst, FIntPoint OutputExtents, FIntPoint OutputPoint) final;
 	void Flush(FRHITexture* Tex, FRHICommandListImmediate& RHICmdList) final;
+
+	// The backend state behind a context created by ffxCreateContext, for the automation tests.
+	static FFXBackendState* GetBackendState(ffxContext* context);
 };
@@ -34,6 +34,7 @@ THIRD_PARTY_INCLUDES_START
 #include "shared/ffx_breadcrumbs_list.cpp"
 #include "shared/ffx_object_management.cpp"
 #include "shared/ffx_message.cpp"
+#include "shared/ffx_resource_lifetime.cpp"
 
 THIRD_PARTY_INCLUDES_END
 #if PLATFORM_WINDOWS
@@ -33,7 +33,6 @@
 #include <synchapi.h>
 
 using namespace cauldron;
-#define USE_BUSY_WAIT   1
 
 // Used in a few places
 static uint32_t       sSeed;
@@ -93,31 +92,15 @@ void FPSLimiterRenderModule::Init(const json& initData)
         uiSection->RegisterUIElement<UICheckBox>("Enable FPS Limiter", m_LimitFPS);
         uiSection->RegisterUIElement<UICheckBox>("GPU Limiter", m_LimitGPU, m_LimitFPS);
         uiSection->RegisterUIElement<UISlider<int32_t>>("Target FPS", m_TargetFPS, 5, 240, m_LimitFPS);
+        // shown and sameLine are spelled out, with only the enabler the call also matches the constructor without enabler
+        m_pWaitErrorText = uiSection->RegisterUIElement<UIText>("", m_LimitFPS, true, false);
+        m_pWaitCPUText   = uiSection->RegisterUIElement<UIText>("", m_LimitFPS, true, false);
     }
 
     // We are now ready for use
     SetModuleReady(true);
 }
 
-static void TimerSleepQPC(int64_t targetQPC)
-{
-    LARGE_INTEGER currentQPC;
-    do
-    {
-        QueryPerformanceCounter(&currentQPC);
-    } while (currentQPC.QuadPart < targetQPC);
-}
-
-static void TimerSleep(std::chrono::steady_clock::duration duration)
-{
-    using ticks         = std::chrono::duration<int64_t, std::ratio<1, 10000000>>;
-    static HANDLE timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
-    LARGE_INTEGER dueTime{};
-    dueTime.QuadPart = -std::chrono::duration_cast<ticks>(duration).count();
-    SetWaitableTimerEx(timer, &dueTime, 0, NULL, NULL, NULL, 0);
-    WaitForSingleObject(timer, -1);
-}
-
 void FPSLimiterRenderModule::Execute(double deltaTime, cauldron::CommandList* pCmdList)
 {
     if (!m_LimitFPS)
@@ -129,37 +112,27 @@ void FPSLimiterRenderModule::Execute(double deltaTime, cauldron::CommandList* pC
         CPUScopedProfileCapture marker(L"FPSLimiter");
 
         // CPU limiter
-        #if USE_BUSY_WAIT
-            LARGE_INTEGER qpf;
-            QueryPerformanceFrequency(&qpf);
-            int64_t targetFrameTicks = qpf.QuadPart / m_TargetFPS;
-
-            static LARGE_INTEGER lastFrame = {};
-            LARGE_INTEGER timeNow;
-            QueryPerformanceCounter(&timeNow);
-            int64_t delta = timeNow.QuadPart - lastFrame.QuadPart;
-            if (delta < targetFrameTicks)
-            {
-                TimerSleepQPC(lastFrame.QuadPart + targetFrameTicks);
-            }
-            QueryPerformanceCounter(&lastFrame);
-        #else
-            // CPU limiter
-            uint64_t                            targetFrameTimeUs = 1000000 / m_TargetFPS;
-            std::chrono::steady_clock::duration targetFrameTime =
-            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::microseconds{targetFrameTimeUs});
-            static std::chrono::steady_clock::time_point lastFrameTime = std::chrono::steady_clock::now();
-            std::chrono::steady_clock::time_point        timeNow       = std::chrono::steady_clock::now();
-            std::chrono::steady_clock::duration          delta         = timeNow - lastFrameTime;
-
-            if (delta < targetFrameTime)
-            {
-                TimerSleep(targetFrameTime - delta);
-                timeNow += targetFrameTime - delta;
-            }
-
-            lastFrameTime = timeNow;
-        #endif // #if USE_BUSY_WAIT
+        const int64_t targetFrameTicks = m_Waiter.GetFrequency() / m_TargetFPS;
+        m_Waiter.WaitUntil(m_LastFrameQPC + targetFrameTicks);
+        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&m_LastFrameQPC));
+
+        // Wait statistics, restarted whenever the target changes
+        if (m_StatsTargetFPS != m_TargetFPS)
+        {
+            m_Waiter.ResetStats();
+            m_StatsTargetFPS  = m_TargetFPS;
+            m_StatsFrameCount = 0;
+        }
+
+        if (m_pWaitErrorText && (m_StatsFrameCount++ % 30) == 0)
+        {
+            char buffer[128] = {};
+            snprintf(buffer, _countof(buffer), "Wait error p50/p99/max: %.0f / %.0f / %.0f us",
+                     m_Waiter.GetErrorPercentileUs(0.5), m_Waiter.GetErrorPercentileUs(0.99), m_Waiter.GetErrorPercentileUs(1.0));
+            m_pWaitErrorText->SetDesc(buffer);
+            snprintf(buffer, _countof(buffer), "Wait CPU usage: %.1f%% (spin margin %.0f us)", m_Waiter.GetSpinRatio() * 100.0, m_Waiter.GetSleepMarginUs());
+            m_pWaitCPUText->SetDesc(buffer);
+        }
         return;
     }
     else
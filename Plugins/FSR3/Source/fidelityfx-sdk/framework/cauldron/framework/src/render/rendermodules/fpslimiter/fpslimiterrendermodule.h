@@ -26,6 +26,7 @@
 #include "render/renderdefines.h"
 #include "core/uimanager.h"
 #include "misc/math.h"
+#include "fpslimiterwaiter.h"
 #include <chrono>
 
 namespace cauldron
@@ -62,6 +63,14 @@ private:
     uint64_t                 m_FrameTimeHistoryCount = 0;
     std::chrono::nanoseconds m_LastFrameEnd{0};
 
+    // CPU limiter
+    FPSLimiterWaiter         m_Waiter;
+    int64_t                  m_LastFrameQPC       = 0;
+    int32_t                  m_StatsTargetFPS     = 0;
+    uint32_t                 m_StatsFrameCount    = 0;
+    cauldron::UIElement*     m_pWaitErrorText     = nullptr;
+    cauldron::UIElement*     m_pWaitCPUText       = nullptr;
+
     // UI
     bool                m_LimitFPS      = false;
     bool                m_LimitGPU      = true;
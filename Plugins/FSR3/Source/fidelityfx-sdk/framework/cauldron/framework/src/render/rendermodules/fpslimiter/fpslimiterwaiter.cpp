@@ -0,0 +1,102 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "fpslimiterwaiter.h"
+
+namespace cauldron
+{
+
+static int64_t QueryCounter()
+{
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+int64_t FPSLimiterWaiter::QueryFrequency()
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return frequency.QuadPart;
+}
+
+FPSLimiterWaiter::FPSLimiterWaiter()
+    : m_Frequency(QueryFrequency())
+    , m_Stats(m_Frequency)
+{
+    m_Timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+}
+
+FPSLimiterWaiter::~FPSLimiterWaiter()
+{
+    if (m_Timer)
+        CloseHandle(m_Timer);
+}
+
+void FPSLimiterWaiter::SleepFor(int64_t ticks)
+{
+    if (m_Timer)
+    {
+        // Relative due time in 100ns units
+        LARGE_INTEGER dueTime{};
+        dueTime.QuadPart = -(ticks * 10000000 / m_Frequency);
+        SetWaitableTimerEx(m_Timer, &dueTime, 0, NULL, NULL, NULL, 0);
+        WaitForSingleObject(m_Timer, INFINITE);
+    }
+    else
+    {
+        // High resolution timers need Windows 10 1803, fall back to the coarse scheduler sleep
+        Sleep(DWORD(ticks * 1000 / m_Frequency));
+    }
+}
+
+void FPSLimiterWaiter::WaitUntil(int64_t targetQPC)
+{
+    const int64_t waitStart = QueryCounter();
+    int64_t       now       = waitStart;
+    if (now >= targetQPC)
+        return;
+
+    // Sleep in one go up to the expected overshoot, every extra wake up would be another chance to get preempted
+    const int64_t marginTicks = int64_t(m_Stats.GetSleepMarginUs() * double(m_Frequency) / 1000000.0);
+    const int64_t sleepTicks  = targetQPC - now - marginTicks;
+    if (sleepTicks > 0)
+    {
+        SleepFor(sleepTicks);
+
+        const int64_t woken = QueryCounter();
+        m_Stats.AddOvershootSample((woken - now) - sleepTicks);
+        now = woken;
+    }
+
+    // Spin the rest
+    const int64_t spinStart = now;
+    while (now < targetQPC)
+    {
+        YieldProcessor();
+        now = QueryCounter();
+    }
+
+    m_Stats.AddWait(now - waitStart, now - spinStart, now - targetQPC);
+}
+
+}  // namespace cauldron
@@ -0,0 +1,65 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "fpslimiterwaitstats.h"
+
+#include <windows.h>
+#include <cstdint>
+
+namespace cauldron
+{
+
+// Waits for a target performance counter value by sleeping on a high resolution waitable timer for most of the wait and
+// spinning for the rest. The spin tail is sized from the sleep overshoots measured so far, so the thread only burns CPU
+// for as long as the OS tends to wake it up late.
+class FPSLimiterWaiter
+{
+public:
+    FPSLimiterWaiter();
+    ~FPSLimiterWaiter();
+
+    void WaitUntil(int64_t targetQPC);
+
+    int64_t GetFrequency() const { return m_Frequency; }
+
+    const FPSLimiterWaitStats& GetStats() const { return m_Stats; }
+
+    double GetSleepMarginUs() const { return m_Stats.GetSleepMarginUs(); }
+    double GetSpinRatio() const { return m_Stats.GetSpinRatio(); }
+    double GetErrorPercentileUs(double fraction) const { return m_Stats.GetErrorPercentileUs(fraction); }
+
+    void ResetStats() { m_Stats.ResetStats(); }
+
+private:
+    static int64_t QueryFrequency();
+
+    void SleepFor(int64_t ticks);
+
+    HANDLE  m_Timer     = NULL;
+    int64_t m_Frequency = 0;
+
+    FPSLimiterWaitStats m_Stats;
+};
+
+}  // namespace cauldron
@@ -0,0 +1,116 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "fpslimiterwaitstats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace cauldron
+{
+
+// Sample weight of the overshoot estimate, small enough to ride out single outliers but still follow load changes
+static const double OvershootSmoothing = 1.0 / 32.0;
+// Standard deviations of overshoot kept as spin tail
+static const double OvershootDeviations = 3.0;
+// Bounds of the spin tail, in microseconds
+static const double MinSleepMarginUs = 50.0;
+static const double MaxSleepMarginUs = 4000.0;
+
+FPSLimiterWaitStats::FPSLimiterWaitStats(int64_t frequency)
+    : m_Frequency(frequency)
+{
+    // Start out pessimistic (~1ms margin) until real overshoots have been measured
+    const double ticksPerUs = double(m_Frequency) / 1000000.0;
+    m_OvershootMean         = 250.0 * ticksPerUs;
+    m_OvershootVariance     = (250.0 * ticksPerUs) * (250.0 * ticksPerUs);
+}
+
+void FPSLimiterWaitStats::AddOvershootSample(int64_t overshootTicks)
+{
+    const double sample = double(std::max<int64_t>(overshootTicks, 0));
+    const double delta  = sample - m_OvershootMean;
+    m_OvershootMean += OvershootSmoothing * delta;
+    m_OvershootVariance = (1.0 - OvershootSmoothing) * (m_OvershootVariance + OvershootSmoothing * delta * delta);
+}
+
+double FPSLimiterWaitStats::GetSleepMarginUs() const
+{
+    const double marginTicks = m_OvershootMean + OvershootDeviations * std::sqrt(m_OvershootVariance);
+    return std::min(std::max(marginTicks * 1000000.0 / double(m_Frequency), MinSleepMarginUs), MaxSleepMarginUs);
+}
+
+void FPSLimiterWaitStats::AddWait(int64_t waitTicks, int64_t spinTicks, int64_t errorTicks)
+{
+    m_WaitTicks += waitTicks;
+    m_SpinTicks += spinTicks;
+
+    const uint64_t errorUs = uint64_t(std::max<int64_t>(errorTicks, 0) * 1000000 / m_Frequency);
+    uint32_t       bucket  = 0;
+    while (bucket < s_ERROR_HISTOGRAM_BUCKETS - 1 && errorUs >= GetErrorBucketUpperEdgeUs(bucket))
+        ++bucket;
+    m_ErrorHistogram[bucket]++;
+    m_ErrorCount++;
+    m_MaxErrorUs = std::max(m_MaxErrorUs, errorUs);
+}
+
+uint64_t FPSLimiterWaitStats::GetErrorBucketUpperEdgeUs(uint32_t bucket)
+{
+    if (bucket < s_ERROR_HISTOGRAM_LINEAR_BUCKETS)
+        return uint64_t(bucket + 1) * s_ERROR_HISTOGRAM_BUCKET_US;
+
+    return uint64_t(s_ERROR_HISTOGRAM_LINEAR_BUCKETS * s_ERROR_HISTOGRAM_BUCKET_US) << (bucket - s_ERROR_HISTOGRAM_LINEAR_BUCKETS + 1);
+}
+
+double FPSLimiterWaitStats::GetSpinRatio() const
+{
+    return m_WaitTicks > 0 ? double(m_SpinTicks) / double(m_WaitTicks) : 0.0;
+}
+
+double FPSLimiterWaitStats::GetErrorPercentileUs(double fraction) const
+{
+    if (m_ErrorCount == 0)
+        return 0.0;
+
+    // Upper edge of the bucket holding the requested sample, never above the largest error seen
+    const uint64_t rank  = std::min(std::max(uint64_t(std::ceil(fraction * double(m_ErrorCount))), uint64_t(1)), m_ErrorCount);
+    uint64_t       count = 0;
+    for (uint32_t i = 0; i < s_ERROR_HISTOGRAM_BUCKETS - 1; ++i)
+    {
+        count += m_ErrorHistogram[i];
+        if (count >= rank)
+            return double(std::min(GetErrorBucketUpperEdgeUs(i), m_MaxErrorUs));
+    }
+    return double(m_MaxErrorUs);
+}
+
+void FPSLimiterWaitStats::ResetStats()
+{
+    memset(m_ErrorHistogram, 0, sizeof(m_ErrorHistogram));
+    m_ErrorCount = 0;
+    m_MaxErrorUs = 0;
+    m_WaitTicks  = 0;
+    m_SpinTicks  = 0;
+}
+
+}  // namespace cauldron
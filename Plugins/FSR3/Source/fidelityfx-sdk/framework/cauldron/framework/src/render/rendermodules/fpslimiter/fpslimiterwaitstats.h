@@ -0,0 +1,82 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+
+namespace cauldron
+{
+
+// Statistics behind FPSLimiterWaiter: the running estimate of the sleep overshoot that sizes the spin tail, and the
+// histogram of wake up errors shown in the UI. Kept apart from the waiter so it can be fed synthetic samples without a
+// real timer.
+class FPSLimiterWaitStats
+{
+public:
+    // 10us buckets up to 160us, then buckets of doubling width up to ~5s. The last bucket also collects everything above
+    static const uint32_t s_ERROR_HISTOGRAM_BUCKETS        = 32;
+    static const uint32_t s_ERROR_HISTOGRAM_LINEAR_BUCKETS = 16;
+    static const uint32_t s_ERROR_HISTOGRAM_BUCKET_US      = 10;
+
+    explicit FPSLimiterWaitStats(int64_t frequency);
+
+    // Feeds how much later than asked a sleep returned
+    void AddOvershootSample(int64_t overshootTicks);
+
+    // Records a finished wait: its total length, the part of it spent spinning and how late it returned
+    void AddWait(int64_t waitTicks, int64_t spinTicks, int64_t errorTicks);
+
+    // How far before the target sleeping stops
+    double GetSleepMarginUs() const;
+
+    // Share of the waited time spent spinning, i.e. how much of a core the wait uses
+    double GetSpinRatio() const;
+
+    // Wake up error (actual - target) below which the given fraction [0, 1] of the waits finished, 1 gives the exact maximum
+    double GetErrorPercentileUs(double fraction) const;
+
+    // Upper edge of a histogram bucket in microseconds
+    static uint64_t GetErrorBucketUpperEdgeUs(uint32_t bucket);
+
+    const uint64_t* GetErrorHistogram() const { return m_ErrorHistogram; }
+
+    uint64_t GetErrorCount() const { return m_ErrorCount; }
+
+    // Restarts the error histogram and spin ratio, the overshoot estimate is kept
+    void ResetStats();
+
+private:
+    int64_t m_Frequency = 0;
+
+    // Exponentially weighted mean and variance of the sleep overshoot, in ticks
+    double m_OvershootMean     = 0.0;
+    double m_OvershootVariance = 0.0;
+
+    uint64_t m_ErrorHistogram[s_ERROR_HISTOGRAM_BUCKETS] = {};
+    uint64_t m_ErrorCount                                = 0;
+    uint64_t m_MaxErrorUs                                = 0;
+    int64_t  m_WaitTicks                                 = 0;
+    int64_t  m_SpinTicks                                 = 0;
+};
+
+}  // namespace cauldron
@@ -114,6 +114,11 @@
 /// @ingroup Defines
 #define FFX_MAX_PASS_COUNT             (50)
 
+/// Maximum number of memory alias groups per effect context
+///
+/// @ingroup Defines
+#define FFX_MAX_ALIAS_GROUPS           (16)
+
 /// Total number of descriptors in ring buffer needed for a single effect context
 ///
 /// @ingroup Defines
@@ -936,6 +941,7 @@ typedef struct FfxCreateResourceDescription {
     const wchar_t*                  name;                                   ///< Name of the resource.
     uint32_t                        id;                                     ///< Internal resource ID.
     FfxResourceInitData             initData;                               ///< A struct used to initialize the resource.
+    uint32_t                        aliasGroup;                             ///< Memory alias group (1..<c><i>FFX_MAX_ALIAS_GROUPS</i></c>) shared with other aliasable resources of the effect whose lifetimes don't overlap. 0 requests a dedicated allocation.
 } FfxCreateResourceDescription;
 
 /// A structure containing the data required to create sampler mappings
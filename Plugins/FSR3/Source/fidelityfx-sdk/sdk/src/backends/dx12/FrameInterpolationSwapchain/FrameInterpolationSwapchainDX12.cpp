@@ -513,12 +513,10 @@ DWORD WINAPI interpolationThread(LPVOID param)
             SetThreadPriority(presenterThreadHandle, THREAD_PRIORITY_HIGHEST);
             SetThreadDescription(presenterThreadHandle, L"AMD FSR Presenter Thread");
 
-            SimpleMovingAverage<10, double> frameTime{};
+            QpcFramePacingClock pacingClock;
+            FramePacingPolicy   pacingPolicy(pacingClock);
 
-            int64_t previousQpc = 0;
-            int64_t previousDelta = 0;
-            int64_t qpcFrequency;
-            QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency)); 
+            int64_t qpcFrequency = pacingClock.frequency();
 
             while (!presenter->shutdown)
             {
@@ -536,7 +534,7 @@ DWORD WINAPI interpolationThread(LPVOID param)
                     int64_t preWaitQPC = 0;
                     QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&preWaitQPC));
                     int64_t previousPresentQPC = presenter->previousPresentQpc;
-                    int64_t targetDelta = (previousPresentQPC + previousDelta) - preWaitQPC;
+                    int64_t targetDelta = (previousPresentQPC + pacingPolicy.getPresentDelta()) - preWaitQPC;
                     
                     //Risk of late wake if overthreading. If allowed, use WaitForSingleObject to wait for interpolationFence if the target is more than 2ms later.
                     if (previousPresentQPC && (targetDelta * 1000000) / qpcFrequency > 2000)  
@@ -564,31 +562,9 @@ DWORD WINAPI interpolationThread(LPVOID param)
                     
                     SetEvent(presenter->interpolationEvent);
 
-                    int64_t currentQpc = 0;
-                    QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentQpc));
-
-                    const double deltaQpc = double(currentQpc - previousQpc) * (previousQpc > 0);
-                    previousQpc           = currentQpc;
-
-                    // reset pacing averaging if delta > 10 fps,
-                    const float fTimeoutInSeconds       = 0.1f;
-                    double      deltaQpcResetThreashold = double(qpcFrequency * fTimeoutInSeconds);
-                    if ((deltaQpc > deltaQpcResetThreashold) || presenter->resetTimer)
-                    {
-                        frameTime.reset();
-                    }
-                    else
-                    {
-                        frameTime.update(deltaQpc);
-                    }
-
-                    // set presentation time: reduce based on variance and subract safety margin so we don't lock on a framerate lower than necessary
-                    int64_t qpcSafetyMargin         = int64_t(qpcFrequency * presenter->safetyMarginInSec);
-                    const int64_t conservativeAvg   = int64_t(frameTime.getAverage() * 0.5 - frameTime.getVariance() * presenter->varianceFactor);
-                    const int64_t deltaToUse        = conservativeAvg > qpcSafetyMargin ? (conservativeAvg - qpcSafetyMargin) : 0;
+                    const int64_t deltaToUse = pacingPolicy.update(presenter->resetTimer, presenter->safetyMarginInSec, presenter->varianceFactor);
                     entry.frames[PacingData::FrameType::Interpolated_1].presentQpcDelta = deltaToUse;
                     entry.frames[PacingData::FrameType::Real].presentQpcDelta           = deltaToUse;
-                    previousDelta                                                       = deltaToUse;
                     
                     // schedule presents
                     EnterCriticalSection(&presenter->criticalSectionScheduledFrame);
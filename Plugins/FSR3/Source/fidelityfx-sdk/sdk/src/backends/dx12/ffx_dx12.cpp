@@ -112,8 +112,18 @@ typedef struct BackendContext_DX12 {
         uint32_t                srvDescIndex;
         uint32_t                uavDescIndex;
         uint32_t                uavDescCount;
+        uint32_t                aliasGroup;     // placed in the alias heap of this group, 0 for committed resources
     } Resource;
 
+    // heap shared by the placed resources of one alias group
+    typedef struct AliasHeap
+    {
+        ID3D12Heap*             heapPtr;
+        uint64_t                size;
+        D3D12_HEAP_FLAGS        heapFlags;
+        uint32_t                refCount;
+    } AliasHeap;
+
     uint32_t refCount;
     uint32_t maxEffectContexts;
 
@@ -174,6 +184,9 @@ typedef struct BackendContext_DX12 {
         // VRAM usage
         FfxEffectMemoryUsage vramUsage;
 
+        // Memory aliasing
+        AliasHeap           aliasHeaps[FFX_MAX_ALIAS_GROUPS];
+
     } EffectContext;
 
     // Resource holder
@@ -1075,6 +1088,7 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
             effectContext.nextDynamicResource = (i * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
             effectContext.nextStaticUavDescriptor = (i * FFX_MAX_RESOURCE_COUNT);
             effectContext.nextDynamicUavDescriptor = (i * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
+            memset(effectContext.aliasHeaps, 0, sizeof(effectContext.aliasHeaps));
 
             if (bindlessConfig)
             {
@@ -1280,6 +1294,67 @@ FfxErrorCode DestroyBackendContextDX12(FfxInterface* backendInterface, FfxUInt32
     return FFX_OK;
 }
 
+// Heap flags a resource needs to be placed in a heap of tier 1 hardware. Only resources with equal flags may alias.
+static D3D12_HEAP_FLAGS getAliasHeapFlagsDX12(const D3D12_RESOURCE_DESC& dx12ResourceDescription)
+{
+    if (dx12ResourceDescription.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+        return D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+
+    if (dx12ResourceDescription.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL))
+        return D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+
+    return D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+}
+
+// Create a resource at the start of the heap of its alias group. The first member of a group creates the heap,
+// later members that don't fit or need different heap flags return nullptr and get a committed resource instead.
+static ID3D12Resource* createAliasedResourceDX12(ID3D12Device*                   dx12Device,
+                                                 BackendContext_DX12::AliasHeap& aliasHeap,
+                                                 const D3D12_RESOURCE_DESC&      dx12ResourceDescription,
+                                                 D3D12_RESOURCE_STATES           dx12ResourceStates,
+                                                 uint64_t&                       outNewHeapSize)
+{
+    outNewHeapSize = 0;
+
+    const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = dx12Device->GetResourceAllocationInfo(0, 1, &dx12ResourceDescription);
+    const D3D12_HEAP_FLAGS               heapFlags      = getAliasHeapFlagsDX12(dx12ResourceDescription);
+
+    if (aliasHeap.heapPtr == nullptr) {
+
+        D3D12_HEAP_DESC dx12HeapDescription = {};
+        dx12HeapDescription.SizeInBytes     = allocationInfo.SizeInBytes;
+        dx12HeapDescription.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+        dx12HeapDescription.Alignment       = allocationInfo.Alignment;
+        dx12HeapDescription.Flags           = heapFlags;
+
+        if (FAILED(dx12Device->CreateHeap(&dx12HeapDescription, IID_PPV_ARGS(&aliasHeap.heapPtr))))
+            return nullptr;
+
+        aliasHeap.size      = allocationInfo.SizeInBytes;
+        aliasHeap.heapFlags = heapFlags;
+        aliasHeap.refCount  = 0;
+        outNewHeapSize      = aliasHeap.size;
+    }
+    else if (aliasHeap.heapFlags != heapFlags || aliasHeap.size < allocationInfo.SizeInBytes) {
+
+        return nullptr;
+    }
+
+    ID3D12Resource* dx12Resource = nullptr;
+    if (FAILED(dx12Device->CreatePlacedResource(aliasHeap.heapPtr, 0, &dx12ResourceDescription, dx12ResourceStates, nullptr, IID_PPV_ARGS(&dx12Resource)))) {
+
+        if (aliasHeap.refCount == 0) {
+            aliasHeap.heapPtr->Release();
+            aliasHeap.heapPtr = nullptr;
+            outNewHeapSize    = 0;
+        }
+        return nullptr;
+    }
+
+    ++aliasHeap.refCount;
+    return dx12Resource;
+}
+
 // create a internal resource that will stay alive until effect gets shut down
 FfxErrorCode CreateResourceDX12(
     FfxInterface* backendInterface,
@@ -1325,6 +1400,7 @@ FfxErrorCode CreateResourceDX12(
     outTexture->internalIndex = effectContext.nextStaticResource++;
     BackendContext_DX12::Resource* backendResource = &backendContext->pResources[outTexture->internalIndex];
     backendResource->resourceDescription = createResourceDescription->resourceDescription;
+    backendResource->aliasGroup = 0;
 
     const auto& initData = createResourceDescription->initData;
 
@@ -1446,8 +1522,22 @@ FfxErrorCode CreateResourceDX12(
         // Buffers ignore any input state and create in common (but issue a warning)
         const D3D12_RESOURCE_STATES dx12ResourceStates = dx12ResourceDescription.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER ? D3D12_RESOURCE_STATE_COMMON : ffxGetDX12StateFromResourceState(resourceStates);
 
-        TIF(dx12Device->CreateCommittedResource(&dx12HeapProperties, D3D12_HEAP_FLAG_NONE, &dx12ResourceDescription, dx12ResourceStates, nullptr, IID_PPV_ARGS(&dx12Resource)));
-        resourceSize = GetResourceGpuMemorySizeDX12(dx12Resource);
+        // transient resources share the heap of their alias group, their contents are never initialized
+        const uint32_t aliasGroup = createResourceDescription->aliasGroup;
+        if (aliasGroup > 0 && aliasGroup <= FFX_MAX_ALIAS_GROUPS &&
+            createResourceDescription->heapType == FFX_HEAP_TYPE_DEFAULT &&
+            initData.type == FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED &&
+            (createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE) {
+
+            dx12Resource = createAliasedResourceDX12(dx12Device, effectContext.aliasHeaps[aliasGroup - 1], dx12ResourceDescription, dx12ResourceStates, resourceSize);
+            if (dx12Resource)
+                backendResource->aliasGroup = aliasGroup;
+        }
+
+        if (dx12Resource == nullptr) {
+            TIF(dx12Device->CreateCommittedResource(&dx12HeapProperties, D3D12_HEAP_FLAG_NONE, &dx12ResourceDescription, dx12ResourceStates, nullptr, IID_PPV_ARGS(&dx12Resource)));
+            resourceSize = GetResourceGpuMemorySizeDX12(dx12Resource);
+        }
         backendResource->initialState = resourceStates;
         backendResource->currentState = resourceStates;
 
@@ -1663,10 +1753,36 @@ FfxErrorCode DestroyResourceDX12(
 
 		if (dx12Resource) {
 
-            uint64_t resourceSize = GetResourceGpuMemorySizeDX12(dx12Resource);
+            BackendContext_DX12::Resource& backendResource = backendContext->pResources[resource.internalIndex];
+            uint64_t resourceSize = 0;
+
+            // aliased resources only account for their heap, which goes away with the last member
+            if (backendResource.aliasGroup > 0) {
+
+                BackendContext_DX12::AliasHeap& aliasHeap = effectContext.aliasHeaps[backendResource.aliasGroup - 1];
+                FFX_ASSERT(aliasHeap.refCount > 0);
+                if (--aliasHeap.refCount == 0)
+                    resourceSize = aliasHeap.size;
+            }
+            else {
+                resourceSize = GetResourceGpuMemorySizeDX12(dx12Resource);
+            }
 
 			dx12Resource->Release();
 
+            // the heap outlives its last placed resource
+            if (backendResource.aliasGroup > 0) {
+
+                BackendContext_DX12::AliasHeap& aliasHeap = effectContext.aliasHeaps[backendResource.aliasGroup - 1];
+                if (aliasHeap.refCount == 0) {
+
+                    aliasHeap.heapPtr->Release();
+                    aliasHeap.heapPtr = nullptr;
+                    aliasHeap.size    = 0;
+                }
+                backendResource.aliasGroup = 0;
+            }
+
             // update effect memory usage
             effectContext.vramUsage.totalUsageInBytes -= resourceSize;
             if ((backendContext->pResources[resource.internalIndex].resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
@@ -1771,6 +1887,7 @@ FfxErrorCode RegisterResourceDX12(
     backendResource->resourcePtr = dx12Resource;
     backendResource->initialState = state;
     backendResource->currentState = state;
+    backendResource->aliasGroup = 0;
 
 #ifdef _DEBUG
     const wchar_t* name = inFfxResource->name;
@@ -2399,6 +2516,7 @@ FfxErrorCode CreatePipelineDX12(
     FfxShaderBlob shaderBlob = { };
     backendInterface->fpGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob);
     FFX_ASSERT(shaderBlob.data && shaderBlob.size);
+    FfxShaderBlobScope shaderBlobScope = { &shaderBlob };  // archived blobs are only decompressed while the pipeline is created
 
     int32_t staticTextureSrvCount = 0;
     int32_t staticBufferSrvCount  = 0;
@@ -3436,6 +3554,13 @@ static FfxErrorCode executeGpuJobDiscard(BackendContext_DX12*       backendConte
     BackendContext_DX12::Resource       ffxResource   = backendContext->pResources[idx];
     ID3D12Resource*                     dx12Resource  = reinterpret_cast<ID3D12Resource*>(ffxResource.resourcePtr);
 
+    // the resource takes over the heap from whichever member of its alias group was used before
+    if (ffxResource.aliasGroup > 0) {
+
+        FFX_ASSERT(backendContext->barrierCount < FFX_MAX_BARRIERS);
+        backendContext->barriers[backendContext->barrierCount++] = CD3DX12_RESOURCE_BARRIER::Aliasing(nullptr, dx12Resource);
+    }
+
     addBarrier(backendContext, &job->discardJobDescriptor.target, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
     flushBarriers(backendContext, dx12CommandList);
 
@@ -0,0 +1,348 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+#if !defined(_WIN32)
+#include <time.h>
+#endif  // #if !defined(_WIN32)
+
+// Moving average and standard deviation of the last Size samples. Mean and sum of squared deviations are kept up to date
+// in O(1) per sample (Welford, removing the sample that leaves the window) and recomputed from the history each time the
+// window wraps, so rounding errors can't build up over a long session.
+template <const int Size, typename Type = double>
+struct SimpleMovingAverage
+{
+    Type         history[Size] = {};
+    unsigned int idx           = 0;
+    unsigned int updateCount   = 0;
+    Type         mean          = 0.0;
+    Type         m2            = 0.0;
+
+    Type getAverage()
+    {
+        if (updateCount < Size)
+            return 0.0;
+
+        return mean;
+    }
+
+    Type getVariance()
+    {
+        if (updateCount < Size)
+            return 0.0;
+
+        return (m2 > 0.0) ? sqrt(m2 / Size) : 0.0;
+    }
+
+    void reset()
+    {
+        updateCount = 0;
+        idx         = 0;
+        mean        = 0.0;
+        m2          = 0.0;
+    }
+
+    void update(Type newValue)
+    {
+        if (updateCount < Size)
+        {
+            const Type delta = newValue - mean;
+            mean += delta / Type(updateCount + 1);
+            m2 += delta * (newValue - mean);
+        }
+        else
+        {
+            const Type oldValue = history[idx];
+            const Type oldMean  = mean;
+            mean += (newValue - oldValue) / Type(Size);
+            m2 += (newValue - oldValue) * (newValue - mean + oldValue - oldMean);
+        }
+
+        history[idx] = newValue;
+        idx          = (idx + 1) % Size;
+        updateCount++;
+
+        if (idx == 0)
+        {
+            recompute();
+        }
+    }
+
+private:
+    void recompute()
+    {
+        Type sum = 0.0;
+        for (size_t i = 0; i < Size; i++)
+        {
+            sum += history[i];
+        }
+        mean = sum / Size;
+
+        m2 = 0.0;
+        for (size_t i = 0; i < Size; i++)
+        {
+            m2 += (history[i] - mean) * (history[i] - mean);
+        }
+    }
+};
+
+// Streaming quantile estimate in constant memory (P-square algorithm, Jain & Chlamtac 1985). Tracks e.g. the median
+// frame time, which unlike the average isn't dragged along by single hitches.
+template <typename Type = double>
+struct P2QuantileEstimator
+{
+    Type         quantile      = 0.5;
+    Type         heights[5]    = {};
+    Type         positions[5]  = {};
+    Type         desired[5]    = {};
+    Type         increments[5] = {};
+    unsigned int updateCount   = 0;
+
+    explicit P2QuantileEstimator(Type p = 0.5)
+        : quantile(p)
+    {
+        reset();
+    }
+
+    Type getQuantile()
+    {
+        if (updateCount == 0)
+            return 0.0;
+
+        if (updateCount >= 5)
+            return heights[2];
+
+        // too few samples for the markers, use the exact quantile of what's there
+        Type sorted[5] = {};
+        for (unsigned int i = 0; i < updateCount; i++)
+        {
+            sorted[i] = heights[i];
+        }
+        sortMarkers(sorted, updateCount);
+        return sorted[static_cast<unsigned int>(quantile * (updateCount - 1) + 0.5)];
+    }
+
+    void reset()
+    {
+        updateCount = 0;
+        for (int i = 0; i < 5; i++)
+        {
+            positions[i] = Type(i + 1);
+        }
+
+        desired[0] = 1.0;
+        desired[1] = 1.0 + 2.0 * quantile;
+        desired[2] = 1.0 + 4.0 * quantile;
+        desired[3] = 3.0 + 2.0 * quantile;
+        desired[4] = 5.0;
+
+        increments[0] = 0.0;
+        increments[1] = quantile * 0.5;
+        increments[2] = quantile;
+        increments[3] = (1.0 + quantile) * 0.5;
+        increments[4] = 1.0;
+    }
+
+    void update(Type newValue)
+    {
+        if (updateCount < 5)
+        {
+            heights[updateCount++] = newValue;
+            if (updateCount == 5)
+            {
+                sortMarkers(heights, 5);
+            }
+            return;
+        }
+
+        // find the cell the sample falls into and extend the outer markers if needed
+        int cell = 0;
+        if (newValue < heights[0])
+        {
+            heights[0] = newValue;
+        }
+        else if (newValue >= heights[4])
+        {
+            heights[4] = newValue;
+            cell       = 3;
+        }
+        else
+        {
+            while (newValue >= heights[cell + 1])
+            {
+                cell++;
+            }
+        }
+
+        for (int i = cell + 1; i < 5; i++)
+        {
+            positions[i] += 1.0;
+        }
+        for (int i = 0; i < 5; i++)
+        {
+            desired[i] += increments[i];
+        }
+        updateCount++;
+
+        // move the inner markers towards their desired positions
+        for (int i = 1; i < 4; i++)
+        {
+            const Type offset = desired[i] - positions[i];
+            if ((offset >= 1.0 && positions[i + 1] - positions[i] > 1.0) || (offset <= -1.0 && positions[i - 1] - positions[i] < -1.0))
+            {
+                const int step   = (offset >= 0.0) ? 1 : -1;
+                Type      height = parabolic(i, Type(step));
+                if (!(heights[i - 1] < height && height < heights[i + 1]))
+                {
+                    height = heights[i] + step * (heights[i + step] - heights[i]) / (positions[i + step] - positions[i]);
+                }
+                heights[i] = height;
+                positions[i] += step;
+            }
+        }
+    }
+
+private:
+    Type parabolic(int i, Type step) const
+    {
+        return heights[i] + step / (positions[i + 1] - positions[i - 1]) *
+                                ((positions[i] - positions[i - 1] + step) * (heights[i + 1] - heights[i]) / (positions[i + 1] - positions[i]) +
+                                 (positions[i + 1] - positions[i] - step) * (heights[i] - heights[i - 1]) / (positions[i] - positions[i - 1]));
+    }
+
+    static void sortMarkers(Type* values, unsigned int count)
+    {
+        for (unsigned int i = 1; i < count; i++)
+        {
+            const Type value = values[i];
+            unsigned int j   = i;
+            for (; j > 0 && values[j - 1] > value; j--)
+            {
+                values[j] = values[j - 1];
+            }
+            values[j] = value;
+        }
+    }
+};
+
+// Time source of the pacing policy. The swapchains use the performance counter, the frame pacing simulator replays a trace.
+class FramePacingClock
+{
+public:
+    virtual ~FramePacingClock() {}
+
+    virtual int64_t now()       = 0;
+    virtual int64_t frequency() = 0;
+};
+
+#if defined(_WIN32)
+class QpcFramePacingClock : public FramePacingClock
+{
+public:
+    int64_t now() override
+    {
+        int64_t qpc = 0;
+        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&qpc));
+        return qpc;
+    }
+
+    int64_t frequency() override
+    {
+        int64_t qpcFrequency = 0;
+        QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency));
+        return qpcFrequency;
+    }
+};
+#else
+// Same units as the QueryPerformanceCounter shim of the Vulkan swapchain: CLOCK_MONOTONIC in nanoseconds
+class QpcFramePacingClock : public FramePacingClock
+{
+public:
+    int64_t now() override
+    {
+        timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return int64_t(time.tv_sec) * 1000000000 + time.tv_nsec;
+    }
+
+    int64_t frequency() override
+    {
+        return 1000000000;
+    }
+};
+#endif  // #if defined(_WIN32)
+
+// Decides how far apart the interpolated and the real frame of a frame pair get presented, from the time between the
+// frames completing interpolation.
+class FramePacingPolicy
+{
+public:
+    // reset pacing averaging if delta > 10 fps
+    static constexpr double ResetTimeoutInSeconds = 0.1;
+
+    explicit FramePacingPolicy(FramePacingClock& inClock)
+        : clock(inClock)
+    {
+    }
+
+    // Called once per frame pair when its interpolated frame is done. Returns the present delta in clock ticks.
+    int64_t update(bool resetTimer, double safetyMarginInSec, double varianceFactor)
+    {
+        const int64_t frequency   = clock.frequency();
+        const int64_t currentTime = clock.now();
+
+        const double deltaTime = double(currentTime - previousTime) * (previousTime > 0);
+        previousTime           = currentTime;
+
+        if ((deltaTime > double(frequency) * ResetTimeoutInSeconds) || resetTimer)
+        {
+            frameTime.reset();
+        }
+        else
+        {
+            frameTime.update(deltaTime);
+        }
+
+        // set presentation time: reduce based on variance and subract safety margin so we don't lock on a framerate lower than necessary
+        const int64_t safetyMargin    = int64_t(frequency * safetyMarginInSec);
+        const int64_t conservativeAvg = int64_t(frameTime.getAverage() * 0.5 - frameTime.getVariance() * varianceFactor);
+        presentDelta                  = conservativeAvg > safetyMargin ? (conservativeAvg - safetyMargin) : 0;
+
+        return presentDelta;
+    }
+
+    int64_t getPresentDelta() const
+    {
+        return presentDelta;
+    }
+
+private:
+    FramePacingClock&               clock;
+    SimpleMovingAverage<10, double> frameTime{};
+    int64_t                         previousTime = 0;
+    int64_t                         presentDelta = 0;
+};
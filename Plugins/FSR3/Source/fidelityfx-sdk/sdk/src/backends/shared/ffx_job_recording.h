@@ -0,0 +1,256 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <FidelityFX/host/ffx_types.h>
+
+// Job list recording format shared by the UE RHI backend (r.FidelityFX.FSR3.RecordRHIJobLists) and tools/ffx_job_replay.
+//
+// A recording is a FfxJobRecordingHeader, resourceCount FfxJobRecordingResource entries and jobCount job records.
+// Each job record is a FfxJobRecordingJob followed by its bindings (texture SRVs, texture UAVs, buffer SRVs,
+// buffer UAVs then constant buffers, as FfxJobRecordingBinding) and the constant buffer contents as 32-bit words.
+// Only the fields the backends consume are kept so a frame's job list is a few KB rather than the ~70KB per
+// FfxGpuJobDescription, names are stored as narrow strings so recordings are portable between platforms.
+
+#define FFX_JOB_RECORDING_MAGIC     0x4A584646  // "FFXJ"
+#define FFX_JOB_RECORDING_VERSION   1
+#define FFX_JOB_RECORDING_NAME_SIZE 64
+
+typedef struct FfxJobRecordingHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t frameIndex;
+    uint32_t resourceCount;
+    uint32_t jobCount;
+} FfxJobRecordingHeader;
+
+typedef struct FfxJobRecordingResource
+{
+    int32_t  internalIndex;
+    uint32_t type;
+    uint32_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+    uint32_t mipCount;
+    uint32_t flags;
+    uint32_t usage;
+} FfxJobRecordingResource;
+
+typedef struct FfxJobRecordingBinding
+{
+    uint32_t resourceIdentifier;                    ///< Binding identifier from the pipeline.
+    int32_t  internalIndex;                         ///< Backend resource index, -1 for constant buffers.
+    uint32_t mip;                                   ///< Texture UAV mip.
+    uint32_t offset;                                ///< Buffer view offset in bytes.
+    uint32_t size;                                  ///< Buffer view size in bytes, or 32-bit entries for constant buffers.
+    uint32_t stride;                                ///< Buffer view stride in bytes.
+    char     name[FFX_JOB_RECORDING_NAME_SIZE];
+} FfxJobRecordingBinding;
+
+typedef struct FfxJobRecordingJob
+{
+    uint32_t size;                                  ///< Size of the record in bytes, including bindings & constants.
+    uint32_t jobType;                               ///< FfxGpuJobType.
+    char     label[FFX_JOB_RECORDING_NAME_SIZE];
+    char     pipelineName[FFX_JOB_RECORDING_NAME_SIZE];
+    int32_t  resources[2];                          ///< Clear: target. Copy: source & destination. Compute: indirect arguments.
+    uint32_t offsets[2];                            ///< Copy: source & destination offsets. Compute: indirect arguments offset.
+    uint32_t copySize;
+    float    clearColor[4];
+    uint32_t passId;
+    uint32_t dimensions[3];
+    uint32_t srvTextureCount;
+    uint32_t uavTextureCount;
+    uint32_t srvBufferCount;
+    uint32_t uavBufferCount;
+    uint32_t constCount;
+    uint32_t constantWordCount;                     ///< Total 32-bit words of constant data following the bindings.
+} FfxJobRecordingJob;
+
+static inline void ffxJobRecordingCopyName(char* dst, const wchar_t* src)
+{
+    uint32_t i = 0;
+    for (; src && src[i] && i < FFX_JOB_RECORDING_NAME_SIZE - 1; ++i)
+        dst[i] = (src[i] < 0x80) ? (char)src[i] : '?';
+    memset(dst + i, 0, FFX_JOB_RECORDING_NAME_SIZE - i);
+}
+
+static inline FfxJobRecordingResource ffxJobRecordingResource(int32_t internalIndex, const FfxResourceDescription& desc)
+{
+    FfxJobRecordingResource resource = { internalIndex, (uint32_t)desc.type, (uint32_t)desc.format, desc.width, desc.height, desc.depth, desc.mipCount, (uint32_t)desc.flags, (uint32_t)desc.usage };
+    return resource;
+}
+
+// Encodes a job into dst and returns the record size, pass dst == NULL to only query the size.
+static inline uint32_t ffxJobRecordingEncodeJob(const FfxGpuJobDescription& job, uint8_t* dst)
+{
+    FfxJobRecordingJob record;
+    memset(&record, 0, sizeof(record));
+    record.jobType = (uint32_t)job.jobType;
+    record.resources[0] = record.resources[1] = -1;
+
+    const FfxComputeJobDescription& compute = job.computeJobDescriptor;
+    if (job.jobType == FFX_GPU_JOB_COMPUTE)
+    {
+        record.srvTextureCount = compute.pipeline.srvTextureCount;
+        record.uavTextureCount = compute.pipeline.uavTextureCount;
+        record.srvBufferCount  = compute.pipeline.srvBufferCount;
+        record.uavBufferCount  = compute.pipeline.uavBufferCount;
+        record.constCount      = compute.pipeline.constCount;
+        for (uint32_t i = 0; i < record.constCount; ++i)
+            record.constantWordCount += compute.cbs[i].num32BitEntries;
+    }
+
+    const uint32_t bindingCount = record.srvTextureCount + record.uavTextureCount + record.srvBufferCount + record.uavBufferCount + record.constCount;
+    record.size = (uint32_t)(sizeof(FfxJobRecordingJob) + bindingCount * sizeof(FfxJobRecordingBinding) + record.constantWordCount * sizeof(uint32_t));
+    if (dst == NULL)
+        return record.size;
+
+    ffxJobRecordingCopyName(record.label, job.jobLabel);
+    switch (job.jobType)
+    {
+    case FFX_GPU_JOB_CLEAR_FLOAT:
+        record.resources[0] = job.clearJobDescriptor.target.internalIndex;
+        memcpy(record.clearColor, job.clearJobDescriptor.color, sizeof(record.clearColor));
+        break;
+    case FFX_GPU_JOB_COPY:
+        record.resources[0] = job.copyJobDescriptor.src.internalIndex;
+        record.resources[1] = job.copyJobDescriptor.dst.internalIndex;
+        record.offsets[0]   = job.copyJobDescriptor.srcOffset;
+        record.offsets[1]   = job.copyJobDescriptor.dstOffset;
+        record.copySize     = job.copyJobDescriptor.size;
+        break;
+    case FFX_GPU_JOB_COMPUTE:
+        ffxJobRecordingCopyName(record.pipelineName, compute.pipeline.name);
+        record.passId       = compute.pipeline.passId;
+        memcpy(record.dimensions, compute.dimensions, sizeof(record.dimensions));
+        record.resources[0] = compute.cmdArgument.internalIndex;
+        record.offsets[0]   = compute.cmdArgumentOffset;
+        break;
+    default:
+        break;
+    }
+    memcpy(dst, &record, sizeof(record));
+
+    FfxJobRecordingBinding* binding = (FfxJobRecordingBinding*)(dst + sizeof(record));
+    uint32_t* constants = (uint32_t*)(binding + bindingCount);
+    auto writeBinding = [&binding](const FfxResourceBinding& pipelineBinding, int32_t internalIndex, uint32_t mip, uint32_t offset, uint32_t size, uint32_t stride) {
+        FfxJobRecordingBinding out = { pipelineBinding.resourceIdentifier, internalIndex, mip, offset, size, stride, {} };
+        ffxJobRecordingCopyName(out.name, pipelineBinding.name);
+        memcpy(binding++, &out, sizeof(out));
+    };
+    for (uint32_t i = 0; i < record.srvTextureCount; ++i)
+        writeBinding(compute.pipeline.srvTextureBindings[i], compute.srvTextures[i].resource.internalIndex, 0, 0, 0, 0);
+    for (uint32_t i = 0; i < record.uavTextureCount; ++i)
+        writeBinding(compute.pipeline.uavTextureBindings[i], compute.uavTextures[i].resource.internalIndex, compute.uavTextures[i].mip, 0, 0, 0);
+    for (uint32_t i = 0; i < record.srvBufferCount; ++i)
+        writeBinding(compute.pipeline.srvBufferBindings[i], compute.srvBuffers[i].resource.internalIndex, 0, compute.srvBuffers[i].offset, compute.srvBuffers[i].size, compute.srvBuffers[i].stride);
+    for (uint32_t i = 0; i < record.uavBufferCount; ++i)
+        writeBinding(compute.pipeline.uavBufferBindings[i], compute.uavBuffers[i].resource.internalIndex, 0, compute.uavBuffers[i].offset, compute.uavBuffers[i].size, compute.uavBuffers[i].stride);
+    for (uint32_t i = 0; i < record.constCount; ++i)
+    {
+        writeBinding(compute.pipeline.constantBufferBindings[i], -1, 0, 0, compute.cbs[i].num32BitEntries, 0);
+        if (compute.cbs[i].num32BitEntries)
+            memcpy(constants, compute.cbs[i].data, compute.cbs[i].num32BitEntries * sizeof(uint32_t));
+        constants += compute.cbs[i].num32BitEntries;
+    }
+    return record.size;
+}
+
+// A job decoded from a recording, pointers reference the recording's memory.
+typedef struct FfxJobRecordingJobView
+{
+    FfxJobRecordingJob            job;
+    const FfxJobRecordingBinding* srvTextures;
+    const FfxJobRecordingBinding* uavTextures;
+    const FfxJobRecordingBinding* srvBuffers;
+    const FfxJobRecordingBinding* uavBuffers;
+    const FfxJobRecordingBinding* constantBuffers;
+    const uint32_t*               constants;
+} FfxJobRecordingJobView;
+
+// Walks a recording held in memory, every read is bounds checked so truncated or corrupt files are rejected.
+class FfxJobRecordingReader
+{
+public:
+    bool open(const uint8_t* data, size_t size)
+    {
+        m_data = data;
+        m_size = size;
+        m_jobsRead = 0;
+        if (data == NULL || size < sizeof(m_header))
+            return false;
+
+        memcpy(&m_header, data, sizeof(m_header));
+        m_offset = sizeof(m_header) + (size_t)m_header.resourceCount * sizeof(FfxJobRecordingResource);
+        return m_header.magic == FFX_JOB_RECORDING_MAGIC && m_header.version == FFX_JOB_RECORDING_VERSION && m_offset <= size;
+    }
+
+    const FfxJobRecordingHeader& header() const { return m_header; }
+
+    FfxJobRecordingResource resource(uint32_t index) const
+    {
+        FfxJobRecordingResource resource;
+        memcpy(&resource, m_data + sizeof(m_header) + index * sizeof(resource), sizeof(resource));
+        return resource;
+    }
+
+    // Returns false once all jobs are read or if the next record is malformed, see failed().
+    bool next(FfxJobRecordingJobView& out)
+    {
+        if (m_jobsRead >= m_header.jobCount || m_offset + sizeof(FfxJobRecordingJob) > m_size)
+            return false;
+
+        memcpy(&out.job, m_data + m_offset, sizeof(out.job));
+        const uint64_t bindingCount = (uint64_t)out.job.srvTextureCount + out.job.uavTextureCount + out.job.srvBufferCount + out.job.uavBufferCount + out.job.constCount;
+        const uint64_t expectedSize = sizeof(FfxJobRecordingJob) + bindingCount * sizeof(FfxJobRecordingBinding) + (uint64_t)out.job.constantWordCount * sizeof(uint32_t);
+        if (out.job.size != expectedSize || m_offset + expectedSize > m_size)
+            return false;
+
+        const FfxJobRecordingBinding* bindings = (const FfxJobRecordingBinding*)(m_data + m_offset + sizeof(FfxJobRecordingJob));
+        out.srvTextures     = bindings;
+        out.uavTextures     = out.srvTextures + out.job.srvTextureCount;
+        out.srvBuffers      = out.uavTextures + out.job.uavTextureCount;
+        out.uavBuffers      = out.srvBuffers + out.job.srvBufferCount;
+        out.constantBuffers = out.uavBuffers + out.job.uavBufferCount;
+        out.constants       = (const uint32_t*)(out.constantBuffers + out.job.constCount);
+
+        m_offset += out.job.size;
+        m_jobsRead++;
+        return true;
+    }
+
+    bool failed() const { return m_jobsRead != m_header.jobCount; }
+
+private:
+    const uint8_t*        m_data = NULL;
+    size_t                m_size = 0;
+    size_t                m_offset = 0;
+    uint32_t              m_jobsRead = 0;
+    FfxJobRecordingHeader m_header = {};
+};
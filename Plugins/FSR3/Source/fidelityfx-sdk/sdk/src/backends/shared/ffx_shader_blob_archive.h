@@ -0,0 +1,210 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Compressed shader blob format shared by FidelityFX-SC (-compress) and the backends (FFX_SHADER_BLOB_ARCHIVE).
+//
+// A compressed blob is a FfxShaderBlobArchiveHeader followed by a single LZ4 block
+// (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md). LZ4 is used as it decompresses at several GB/s
+// with a few dozen lines of code, so the backends don't need an extra library. Blob headers and tables keep
+// pointing at the compressed bytes, the magic tells the backend they need to be decompressed before use.
+
+#define FFX_SHADER_BLOB_ARCHIVE_MAGIC 0x5A584646  // "FFXZ"
+
+typedef struct FfxShaderBlobArchiveHeader
+{
+    uint32_t magic;
+    uint32_t uncompressedSize;
+} FfxShaderBlobArchiveHeader;
+
+// Returns the size of the blob once decompressed, or 0 if the blob isn't compressed.
+static inline uint32_t ffxShaderBlobArchiveUncompressedSize(const uint8_t* blob, uint32_t blobSize)
+{
+    FfxShaderBlobArchiveHeader header;
+    if (blob == NULL || blobSize < sizeof(header))
+        return 0;
+
+    memcpy(&header, blob, sizeof(header));
+    return header.magic == FFX_SHADER_BLOB_ARCHIVE_MAGIC ? header.uncompressedSize : 0;
+}
+
+// Decompresses a blob into dst, which must hold ffxShaderBlobArchiveUncompressedSize() bytes.
+// Returns false if the stream is malformed.
+static inline bool ffxShaderBlobArchiveDecompress(const uint8_t* blob, uint32_t blobSize, uint8_t* dst, uint32_t dstSize)
+{
+    if (ffxShaderBlobArchiveUncompressedSize(blob, blobSize) != dstSize)
+        return false;
+
+    const uint8_t* src    = blob + sizeof(FfxShaderBlobArchiveHeader);
+    const uint8_t* srcEnd = blob + blobSize;
+    uint8_t*       out    = dst;
+    uint8_t*       outEnd = dst + dstSize;
+
+    while (src < srcEnd)
+    {
+        const uint8_t token = *src++;
+
+        // literals
+        size_t literalLength = token >> 4;
+        if (literalLength == 15)
+        {
+            uint8_t extra;
+            do
+            {
+                if (src >= srcEnd)
+                    return false;
+                extra = *src++;
+                literalLength += extra;
+            } while (extra == 255);
+        }
+        if (literalLength > size_t(srcEnd - src) || literalLength > size_t(outEnd - out))
+            return false;
+        memcpy(out, src, literalLength);
+        src += literalLength;
+        out += literalLength;
+
+        // the last sequence only has literals
+        if (src == srcEnd)
+            break;
+
+        // match
+        if (srcEnd - src < 2)
+            return false;
+        const size_t offset = size_t(src[0]) | (size_t(src[1]) << 8);
+        src += 2;
+        if (offset == 0 || offset > size_t(out - dst))
+            return false;
+
+        size_t matchLength = (token & 15) + 4;
+        if ((token & 15) == 15)
+        {
+            uint8_t extra;
+            do
+            {
+                if (src >= srcEnd)
+                    return false;
+                extra = *src++;
+                matchLength += extra;
+            } while (extra == 255);
+        }
+        if (matchLength > size_t(outEnd - out))
+            return false;
+
+        // matches may overlap their own output (repeating patterns), copy those in growing multiples of the offset
+        size_t copied   = 0;
+        size_t distance = offset;
+        while (copied < matchLength)
+        {
+            const size_t count = (distance < matchLength - copied) ? distance : matchLength - copied;
+            memcpy(out + copied, out + copied - distance, count);
+            copied += count;
+            distance = ((copied + offset) / offset) * offset;
+        }
+        out += matchLength;
+    }
+
+    return out == outEnd;
+}
+
+#if defined(__cplusplus)
+#include <vector>
+
+// Compresses a blob with a greedy hash-chain-less LZ4 encoder, good enough for offline use in the shader compiler.
+static inline void ffxShaderBlobArchiveCompress(const uint8_t* src, uint32_t srcSize, std::vector<uint8_t>& outBlob)
+{
+    static const uint32_t MinMatch       = 4;
+    static const uint32_t LastLiterals   = 5;   // the block must end with at least 5 literals
+    static const uint32_t MatchSafeEnd   = 12;  // and the last match must start 12 bytes before the end
+    static const uint32_t MaxOffset      = 65535;
+    static const uint32_t HashLog        = 16;
+
+    FfxShaderBlobArchiveHeader header = {FFX_SHADER_BLOB_ARCHIVE_MAGIC, srcSize};
+    outBlob.resize(sizeof(header));
+    memcpy(outBlob.data(), &header, sizeof(header));
+
+    auto read32 = [src](uint32_t position) {
+        uint32_t value;
+        memcpy(&value, src + position, sizeof(value));
+        return value;
+    };
+    auto hash = [](uint32_t value) { return (value * 2654435761u) >> (32 - HashLog); };
+    auto writeLength = [&outBlob](size_t length) {
+        for (; length >= 255; length -= 255)
+            outBlob.push_back(255);
+        outBlob.push_back(uint8_t(length));
+    };
+    auto writeSequence = [&](uint32_t literalStart, uint32_t literalEnd, uint32_t offset, uint32_t matchLength) {
+        const size_t literalLength = literalEnd - literalStart;
+        const size_t tokenPosition = outBlob.size();
+        outBlob.push_back(uint8_t((literalLength >= 15 ? 15 : literalLength) << 4));
+        if (literalLength >= 15)
+            writeLength(literalLength - 15);
+        outBlob.insert(outBlob.end(), src + literalStart, src + literalEnd);
+
+        if (matchLength == 0)
+            return;
+
+        outBlob.push_back(uint8_t(offset & 0xff));
+        outBlob.push_back(uint8_t(offset >> 8));
+        const size_t matchCode = matchLength - MinMatch;
+        outBlob[tokenPosition] |= uint8_t(matchCode >= 15 ? 15 : matchCode);
+        if (matchCode >= 15)
+            writeLength(matchCode - 15);
+    };
+
+    std::vector<uint32_t> table(size_t(1) << HashLog, UINT32_MAX);
+    uint32_t              anchor = 0;
+
+    if (srcSize > MatchSafeEnd)
+    {
+        const uint32_t matchLimit = srcSize - LastLiterals;
+        uint32_t       position   = 0;
+        while (position + MatchSafeEnd <= srcSize)
+        {
+            const uint32_t sequence  = read32(position);
+            const uint32_t slot      = hash(sequence);
+            const uint32_t candidate = table[slot];
+            table[slot]              = position;
+
+            if (candidate == UINT32_MAX || position - candidate > MaxOffset || read32(candidate) != sequence)
+            {
+                ++position;
+                continue;
+            }
+
+            uint32_t matchLength = MinMatch;
+            while (position + matchLength < matchLimit && src[candidate + matchLength] == src[position + matchLength])
+                ++matchLength;
+
+            writeSequence(anchor, position, position - candidate, matchLength);
+            position += matchLength;
+            anchor = position;
+        }
+    }
+
+    writeSequence(anchor, srcSize, 0, 0);
+}
+#endif  // #if defined(__cplusplus)
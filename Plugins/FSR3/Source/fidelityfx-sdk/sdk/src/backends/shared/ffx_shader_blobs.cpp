@@ -99,8 +99,139 @@
 #endif  // #if defined(FFX_BRIXELIZER_GI) || defined(FFX_ALL)
 
 #include <string.h> // for memset
+#include <stddef.h> // for offsetof
 
-FfxErrorCode ffxGetPermutationBlobByIndex(
+#if defined(FFX_SHADER_BLOB_ARCHIVE)
+#include "ffx_shader_blob_archive.h"
+
+#include <stdlib.h>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+// Decompressed bytes kept around for permutations that aren't in use anymore. Blobs in use are never evicted,
+// so the cache can temporarily grow past this while many pipelines are being created at once.
+#if !defined(FFX_SHADER_BLOB_CACHE_BUDGET)
+#define FFX_SHADER_BLOB_CACHE_BUDGET (8 * 1024 * 1024)
+#endif // #if !defined(FFX_SHADER_BLOB_CACHE_BUDGET)
+
+namespace
+{
+    struct DecompressedBlob
+    {
+        const uint8_t* archived;
+        uint8_t*       data;
+        uint32_t       size;
+        uint32_t       references;
+    };
+
+    // Decompressed permutations keyed by their archived data, which is unique per permutation.
+    // Least recently used blobs are at the back of the list.
+    class ShaderBlobCache
+    {
+    public:
+        ~ShaderBlobCache()
+        {
+            for (DecompressedBlob& blob : m_Blobs)
+                free(blob.data);
+        }
+
+        const uint8_t* acquire(const uint8_t* archived, uint32_t archivedSize, uint32_t size)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            auto found = m_ByArchived.find(archived);
+            if (found != m_ByArchived.end())
+            {
+                m_Blobs.splice(m_Blobs.begin(), m_Blobs, found->second);
+                found->second->references++;
+                m_Stats.hits++;
+                return found->second->data;
+            }
+
+            // malloc keeps the data aligned for SPIR-V words
+            uint8_t* data = static_cast<uint8_t*>(malloc(size));
+            if (data == nullptr)
+                return nullptr;
+
+            const auto start = std::chrono::steady_clock::now();
+            if (!ffxShaderBlobArchiveDecompress(archived, archivedSize, data, size))
+            {
+                FFX_ASSERT_MESSAGE(false, "Corrupt shader blob archive entry");
+                free(data);
+                return nullptr;
+            }
+            const uint64_t microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+            m_Blobs.push_front({archived, data, size, 1});
+            m_ByArchived[archived] = m_Blobs.begin();
+            m_ByData[data]         = m_Blobs.begin();
+
+            m_Stats.decompressions++;
+            m_Stats.decompressionMicroseconds += microseconds;
+            m_Stats.maxDecompressionMicroseconds = microseconds > m_Stats.maxDecompressionMicroseconds ? microseconds : m_Stats.maxDecompressionMicroseconds;
+            m_Stats.residentBytes += size;
+            m_Stats.peakResidentBytes = m_Stats.residentBytes > m_Stats.peakResidentBytes ? m_Stats.residentBytes : m_Stats.peakResidentBytes;
+
+            evict();
+            return data;
+        }
+
+        void release(const uint8_t* data)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            auto found = m_ByData.find(data);
+            if (found == m_ByData.end())
+                return;
+
+            FFX_ASSERT(found->second->references > 0);
+            found->second->references--;
+            evict();
+        }
+
+        void getStats(FfxShaderBlobCacheStats* outStats)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            *outStats = m_Stats;
+        }
+
+    private:
+        void evict()
+        {
+            auto it = m_Blobs.end();
+            while (m_Stats.residentBytes > FFX_SHADER_BLOB_CACHE_BUDGET && it != m_Blobs.begin())
+            {
+                --it;
+                if (it->references > 0)
+                    continue;
+
+                m_Stats.residentBytes -= it->size;
+                m_Stats.evictions++;
+                m_ByArchived.erase(it->archived);
+                m_ByData.erase(it->data);
+                free(it->data);
+                it = m_Blobs.erase(it);
+            }
+        }
+
+        std::mutex                                                            m_Mutex;
+        std::list<DecompressedBlob>                                           m_Blobs;
+        std::unordered_map<const uint8_t*, std::list<DecompressedBlob>::iterator> m_ByArchived;
+        std::unordered_map<const uint8_t*, std::list<DecompressedBlob>::iterator> m_ByData;
+        FfxShaderBlobCacheStats                                               m_Stats = {};
+    };
+
+    ShaderBlobCache& getShaderBlobCache()
+    {
+        static ShaderBlobCache cache;
+        return cache;
+    }
+} // namespace
+#endif // #if defined(FFX_SHADER_BLOB_ARCHIVE)
+
+static FfxErrorCode getPermutationBlobByIndex(
     FfxEffect effectId,
     FfxPass passId,
     FfxBindStage stageId,
@@ -222,6 +353,59 @@ FfxErrorCode ffxGetPermutationBlobByIndex(
     return FFX_OK;
 }
 
+FfxErrorCode ffxGetPermutationBlobByIndex(
+    FfxEffect effectId,
+    FfxPass passId,
+    FfxBindStage stageId,
+    uint32_t permutationOptions,
+    FfxShaderBlob* outBlob)
+{
+    const FfxErrorCode errorCode = getPermutationBlobByIndex(effectId, passId, stageId, permutationOptions, outBlob);
+
+#if defined(FFX_SHADER_BLOB_ARCHIVE)
+    // the blob isn't filled in on failure
+    if (errorCode != FFX_OK)
+        return errorCode;
+
+    // Archived permutations are decompressed on first use, the reflection data stays in the static tables
+    const uint32_t uncompressedSize = ffxShaderBlobArchiveUncompressedSize(outBlob->data, outBlob->size);
+    if (uncompressedSize != 0)
+    {
+        const uint8_t* data = getShaderBlobCache().acquire(outBlob->data, outBlob->size, uncompressedSize);
+        if (data == nullptr)
+        {
+            memset(outBlob, 0, sizeof(FfxShaderBlob));
+            return FFX_ERROR_OUT_OF_MEMORY;
+        }
+
+        // FfxShaderBlob members are const, patch data and size in place like the accessors fill the whole blob
+        memcpy(reinterpret_cast<uint8_t*>(outBlob) + offsetof(FfxShaderBlob, data), &data, sizeof(data));
+        memcpy(reinterpret_cast<uint8_t*>(outBlob) + offsetof(FfxShaderBlob, size), &uncompressedSize, sizeof(uncompressedSize));
+    }
+#endif // #if defined(FFX_SHADER_BLOB_ARCHIVE)
+
+    return errorCode;
+}
+
+void ffxReleasePermutationBlob(const FfxShaderBlob* blob)
+{
+#if defined(FFX_SHADER_BLOB_ARCHIVE)
+    if (blob && blob->data)
+        getShaderBlobCache().release(blob->data);
+#else
+    (void)blob;
+#endif // #if defined(FFX_SHADER_BLOB_ARCHIVE)
+}
+
+void ffxGetShaderBlobCacheStats(FfxShaderBlobCacheStats* outStats)
+{
+#if defined(FFX_SHADER_BLOB_ARCHIVE)
+    getShaderBlobCache().getStats(outStats);
+#else
+    memset(outStats, 0, sizeof(FfxShaderBlobCacheStats));
+#endif // #if defined(FFX_SHADER_BLOB_ARCHIVE)
+}
+
 FfxErrorCode ffxIsWave64(FfxEffect effectId, uint32_t permutationOptions, bool& isWave64)
 {
     (void)permutationOptions;
@@ -41,6 +41,31 @@ FfxErrorCode ffxGetPermutationBlobByIndex(FfxEffect effectId,
 // Check is Wave64 is requested on this permutation
 FfxErrorCode ffxIsWave64(FfxEffect effectId, uint32_t permutationOptions, bool& isWave64);
 
+// Hand back a blob from ffxGetPermutationBlobByIndex once its data has been consumed.
+// Only blobs decompressed from the shader blob archive (FFX_SHADER_BLOB_ARCHIVE) are reference counted, for others this does nothing.
+void ffxReleasePermutationBlob(const FfxShaderBlob* blob);
+
+// Decompressed shader blob cache counters (all zero unless built with FFX_SHADER_BLOB_ARCHIVE)
+typedef struct FfxShaderBlobCacheStats
+{
+    uint64_t residentBytes;                 // Decompressed bytes currently held by the cache
+    uint64_t peakResidentBytes;             // Highest residentBytes so far
+    uint64_t hits;                          // Requests served from the cache
+    uint64_t decompressions;                // Requests that had to decompress a blob
+    uint64_t evictions;                     // Blobs dropped to stay within the budget
+    uint64_t decompressionMicroseconds;     // Total time spent decompressing
+    uint64_t maxDecompressionMicroseconds;  // Slowest single decompression, i.e. worst first use latency
+} FfxShaderBlobCacheStats;
+
+void ffxGetShaderBlobCacheStats(FfxShaderBlobCacheStats* outStats);
+
 #if defined(__cplusplus)
 }
+
+// Releases a blob at the end of the scope, so early outs don't leak cache references
+struct FfxShaderBlobScope
+{
+    const FfxShaderBlob* blob;
+    ~FfxShaderBlobScope() { ffxReleasePermutationBlob(blob); }
+};
 #endif // #if defined(__cplusplus)
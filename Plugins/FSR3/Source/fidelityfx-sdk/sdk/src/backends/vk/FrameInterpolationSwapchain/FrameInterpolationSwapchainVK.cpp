@@ -1221,8 +1221,8 @@ DWORD WINAPI interpolationThread(LPVOID param)
             SetThreadPriority(presenterThreadHandle, THREAD_PRIORITY_HIGHEST);
             SetThreadDescription(presenterThreadHandle, L"AMD FSR Presenter Thread");
 
-            SimpleMovingAverage<10, double> frameTime{};
-            int64_t previousQpc = 0;
+            QpcFramePacingClock pacingClock;
+            FramePacingPolicy   pacingPolicy(pacingClock);
 
             while (!presenter->shutdown)
             {
@@ -1242,30 +1242,7 @@ DWORD WINAPI interpolationThread(LPVOID param)
                                           entry.frames[PacingData::FrameType::Interpolated_1].interpolationCompletedSemaphoreValue);
                     SetEvent(presenter->interpolationEvent); // unlocks the queuePresent method
 
-                    int64_t currentQpc = 0;
-                    QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentQpc));
-
-                    const double deltaQpc = double(currentQpc - previousQpc) * (previousQpc > 0);
-                    previousQpc           = currentQpc;
-
-                    // reset pacing averaging if delta > 10 fps,
-                    int64_t qpcFrequency;
-                    QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency));
-                    const float fTimeoutInSeconds       = 0.1f;
-                    double      deltaQpcResetThreashold = double(qpcFrequency * fTimeoutInSeconds);
-                    if ((deltaQpc > deltaQpcResetThreashold) || presenter->resetTimer)
-                    {
-                        frameTime.reset();
-                    }
-                    else
-                    {
-                        frameTime.update(deltaQpc);
-                    }
-
-                    // set presentation time: reduce based on variance and subract safety margin so we don't lock on a framerate lower than necessary
-                    int64_t qpcSafetyMargin         = int64_t(qpcFrequency * presenter->safetyMarginInSec);
-                    const int64_t conservativeAvg   = int64_t(frameTime.getAverage() * 0.5 - frameTime.getVariance() * presenter->varianceFactor);
-                    const int64_t deltaToUse        = conservativeAvg > qpcSafetyMargin ? (conservativeAvg - qpcSafetyMargin) : 0;
+                    const int64_t deltaToUse = pacingPolicy.update(presenter->resetTimer, presenter->safetyMarginInSec, presenter->varianceFactor);
                     entry.frames[PacingData::FrameType::Interpolated_1].presentQpcDelta = deltaToUse;
                     entry.frames[PacingData::FrameType::Real].presentQpcDelta           = deltaToUse;
 
@@ -1357,8 +1334,10 @@ struct SwapchainCreationInfo
 
     VkImageCompressionControlEXT             imageCompressionControl;
     VkImageFormatListCreateInfo              imageFormatList;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
     VkSurfaceFullScreenExclusiveInfoEXT      surfaceFullScreenExclusive;
     VkSurfaceFullScreenExclusiveWin32InfoEXT surfaceFullScreenExclusiveWin32;
+#endif  // #ifdef VK_USE_PLATFORM_WIN32_KHR
     VkSwapchainCounterCreateInfoEXT          swapchainCounter;
     VkSwapchainDisplayNativeHdrCreateInfoAMD swapchainDisplayNativeHdr;
     VkSwapchainPresentModesCreateInfoEXT     swapchainPresentModes;
@@ -1392,6 +1371,7 @@ VkResult getRealSwapchainCreateInfo(const VkSwapchainCreateInfoKHR* pCreateInfo,
         case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
             FFX_USE_PNEXT_AS_IS(imageFormatList, VkImageFormatListCreateInfo);
             break;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
         case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT:
             realSwapchainCreateInfo.surfaceFullScreenExclusive       = *reinterpret_cast<const VkSurfaceFullScreenExclusiveInfoEXT*>(pCurrent);
             realSwapchainCreateInfo.surfaceFullScreenExclusive.pNext = const_cast<void*>(realSwapchainCreateInfo.swapchain.pNext);  // because pNext is void* instead of const void* in vulkan header
@@ -1400,6 +1380,7 @@ VkResult getRealSwapchainCreateInfo(const VkSwapchainCreateInfoKHR* pCreateInfo,
         case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT:
             FFX_USE_PNEXT_AS_IS(surfaceFullScreenExclusiveWin32, VkSurfaceFullScreenExclusiveWin32InfoEXT);
             break;
+#endif  // #ifdef VK_USE_PLATFORM_WIN32_KHR
         case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
             FFX_USE_PNEXT_AS_IS(swapchainCounter, VkSwapchainCounterCreateInfoEXT);
             break;
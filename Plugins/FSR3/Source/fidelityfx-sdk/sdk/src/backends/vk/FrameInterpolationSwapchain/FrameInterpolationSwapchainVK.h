@@ -40,8 +40,8 @@
 // NOTES regarding using win32 objects:
 //   - On Windows, critical section and events are faster than their std counterparts
 //   - using Win32 threads to set the priorities
-//   - this needs to be ported to standard C++ or other platform if necessary
-#include <Windows.h>
+//   - other platforms get the same subset from FrameInterpolationSwapchainVK_Platform.h (pthreads and CLOCK_MONOTONIC)
+#include "FrameInterpolationSwapchainVK_Platform.h"
 
 #define FFX_FRAME_INTERPOLATION_SWAP_CHAIN_VERSION                     1
 #define FFX_FRAME_INTERPOLATION_SWAP_CHAIN_MAX_BUFFER_COUNT            6
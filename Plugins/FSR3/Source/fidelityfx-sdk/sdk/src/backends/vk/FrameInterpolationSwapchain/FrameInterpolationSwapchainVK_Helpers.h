@@ -27,11 +27,9 @@
 #include <FidelityFX/host/ffx_assert.h>
 #include <FidelityFX/host/backends/vk/ffx_vk.h>
 
-#include <Windows.h>
-#include <synchapi.h>
+#include "FrameInterpolationSwapchainVK_Platform.h"
 
-
-void waitForPerformanceCount(const int64_t targetCount);
+#include <ffx_frame_pacing.h>
 
 
 struct SubmissionSemaphores
@@ -343,66 +341,4 @@ public:
     }
 };
 
-template <const int Size, typename Type = double>
-struct SimpleMovingAverage
-{
-    Type         history[Size] = {};
-    unsigned int idx           = 0;
-    unsigned int updateCount   = 0;
-
-    Type getAverage()
-    {
-        if (updateCount < Size)
-            return 0.0;
-
-        Type         average    = 0.f;
-        unsigned int iterations = (updateCount >= Size) ? Size : updateCount;
-
-        if (iterations > 0)
-        {
-            for (size_t i = 0; i < iterations; i++)
-            {
-                average += history[i];
-            }
-            average /= iterations;
-        }
-
-        return average;
-    }
-
-    Type getVariance()
-    {
-        if (updateCount < Size)
-            return 0.0;
-
-        Type         average    = getAverage();
-        Type         variance   = 0.f;
-        unsigned int iterations = (updateCount >= Size) ? Size : updateCount;
-
-        if (iterations > 0)
-        {
-            for (size_t i = 0; i < iterations; i++)
-            {
-                variance += (history[i] - average) * (history[i] - average);
-            }
-            variance /= iterations;
-        }
-
-        return sqrt(variance);
-    }
-
-    void reset()
-    {
-        updateCount = 0;
-        idx         = 0;
-    }
-
-    void update(Type newValue)
-    {
-        history[idx] = newValue;
-        idx          = (idx + 1) % Size;
-        updateCount++;
-    }
-};
-
 VkResult CreateShaderModule(VkDevice device, size_t codeSize, const uint32_t* pCode, VkShaderModule* pModule, const VkAllocationCallbacks* pAllocator);
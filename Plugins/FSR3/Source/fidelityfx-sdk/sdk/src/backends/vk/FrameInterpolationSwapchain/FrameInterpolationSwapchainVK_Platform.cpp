@@ -0,0 +1,355 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FrameInterpolationSwapchainVK_Platform.h"
+
+#if !defined(_WIN32)
+
+#include <atomic>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+namespace
+{
+    enum class HandleType
+    {
+        Event,
+        Thread
+    };
+
+    // common part of events and threads: a condition that threads can wait on until it's signaled
+    struct WaitableHandle
+    {
+        HandleType       type;
+        pthread_mutex_t  mutex;
+        pthread_cond_t   condition;
+        bool             signaled;
+
+        explicit WaitableHandle(HandleType inType, bool initialState)
+            : type(inType)
+            , signaled(initialState)
+        {
+            pthread_condattr_t attributes;
+            pthread_condattr_init(&attributes);
+            pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+            pthread_cond_init(&condition, &attributes);
+            pthread_condattr_destroy(&attributes);
+            pthread_mutex_init(&mutex, nullptr);
+        }
+
+        ~WaitableHandle()
+        {
+            pthread_cond_destroy(&condition);
+            pthread_mutex_destroy(&mutex);
+        }
+    };
+
+    struct Event : WaitableHandle
+    {
+        bool manualReset;
+
+        Event(bool inManualReset, bool initialState)
+            : WaitableHandle(HandleType::Event, initialState)
+            , manualReset(inManualReset)
+        {
+        }
+    };
+
+    // the thread object is shared by the handle and the running thread, whichever is done last frees it
+    struct Thread : WaitableHandle
+    {
+        pthread_t              thread;
+        LPTHREAD_START_ROUTINE startAddress;
+        LPVOID                 parameter;
+        std::atomic<int>       references{2};
+        // set by SetThreadDescription, applied by the thread itself since it may already have exited by then
+        char                   name[16] = {};
+        std::atomic<bool>      namePending{false};
+
+        Thread(LPTHREAD_START_ROUTINE inStartAddress, LPVOID inParameter)
+            : WaitableHandle(HandleType::Thread, false)
+            , startAddress(inStartAddress)
+            , parameter(inParameter)
+        {
+        }
+
+        void release()
+        {
+            if (--references == 0)
+                delete this;
+        }
+    };
+
+    thread_local Thread* currentThread = nullptr;
+
+    // called on the thread being named: when it starts and whenever it waits, which the swapchain threads do every frame
+    void applyPendingThreadName()
+    {
+        Thread* thread = currentThread;
+        if (thread == nullptr || !thread->namePending.exchange(false))
+            return;
+
+        char name[sizeof(thread->name)];
+        pthread_mutex_lock(&thread->mutex);
+        memcpy(name, thread->name, sizeof(name));
+        pthread_mutex_unlock(&thread->mutex);
+
+#if defined(__linux__)
+        pthread_setname_np(pthread_self(), name);
+#endif  // #if defined(__linux__)
+    }
+
+    void* threadEntry(void* parameter)
+    {
+        Thread* thread = static_cast<Thread*>(parameter);
+        currentThread  = thread;
+        applyPendingThreadName();
+
+        thread->startAddress(thread->parameter);
+        currentThread = nullptr;
+
+        pthread_mutex_lock(&thread->mutex);
+        thread->signaled = true;
+        pthread_cond_broadcast(&thread->condition);
+        pthread_mutex_unlock(&thread->mutex);
+
+        thread->release();
+        return nullptr;
+    }
+
+    timespec deadlineAfter(DWORD milliseconds)
+    {
+        timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += milliseconds / 1000;
+        deadline.tv_nsec += long(milliseconds % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= 1000000000;
+        }
+        return deadline;
+    }
+}  // namespace
+
+void InitializeCriticalSection(CRITICAL_SECTION* criticalSection)
+{
+    // critical sections can be entered recursively by the owning thread
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&criticalSection->mutex, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+}
+
+void DeleteCriticalSection(CRITICAL_SECTION* criticalSection)
+{
+    pthread_mutex_destroy(&criticalSection->mutex);
+}
+
+void EnterCriticalSection(CRITICAL_SECTION* criticalSection)
+{
+    pthread_mutex_lock(&criticalSection->mutex);
+}
+
+void LeaveCriticalSection(CRITICAL_SECTION* criticalSection)
+{
+    pthread_mutex_unlock(&criticalSection->mutex);
+}
+
+HANDLE CreateEvent(void* /*eventAttributes*/, BOOL manualReset, BOOL initialState, const wchar_t* /*name*/)
+{
+    return new Event(manualReset != FALSE, initialState != FALSE);
+}
+
+BOOL SetEvent(HANDLE event)
+{
+    Event* pEvent = static_cast<Event*>(event);
+    if (pEvent == nullptr || pEvent->type != HandleType::Event)
+        return FALSE;
+
+    pthread_mutex_lock(&pEvent->mutex);
+    pEvent->signaled = true;
+    if (pEvent->manualReset)
+        pthread_cond_broadcast(&pEvent->condition);
+    else
+        pthread_cond_signal(&pEvent->condition);
+    pthread_mutex_unlock(&pEvent->mutex);
+
+    return TRUE;
+}
+
+BOOL ResetEvent(HANDLE event)
+{
+    Event* pEvent = static_cast<Event*>(event);
+    if (pEvent == nullptr || pEvent->type != HandleType::Event)
+        return FALSE;
+
+    pthread_mutex_lock(&pEvent->mutex);
+    pEvent->signaled = false;
+    pthread_mutex_unlock(&pEvent->mutex);
+
+    return TRUE;
+}
+
+HANDLE CreateThread(void* /*threadAttributes*/, size_t stackSize, LPTHREAD_START_ROUTINE startAddress, LPVOID parameter, DWORD /*creationFlags*/, DWORD* threadId)
+{
+    Thread* thread = new Thread(startAddress, parameter);
+
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+    if (stackSize > 0)
+        pthread_attr_setstacksize(&attributes, stackSize);
+
+    const int result = pthread_create(&thread->thread, &attributes, threadEntry, thread);
+    pthread_attr_destroy(&attributes);
+
+    if (result != 0)
+    {
+        delete thread;
+        return nullptr;
+    }
+
+    if (threadId)
+        *threadId = 0;
+
+    return thread;
+}
+
+BOOL SetThreadPriority(HANDLE thread, int /*priority*/)
+{
+    // raising the priority of a SCHED_OTHER thread requires privileges, the threads keep the default priority
+    return thread != nullptr ? TRUE : FALSE;
+}
+
+HRESULT SetThreadDescription(HANDLE thread, const wchar_t* threadDescription)
+{
+    Thread* pThread = static_cast<Thread*>(thread);
+    if (pThread == nullptr || pThread->type != HandleType::Thread || threadDescription == nullptr)
+        return -1;
+
+    // thread names are limited to 15 characters plus terminator
+    pthread_mutex_lock(&pThread->mutex);
+    memset(pThread->name, 0, sizeof(pThread->name));
+    for (size_t i = 0; i < sizeof(pThread->name) - 1 && threadDescription[i] != L'\0'; ++i)
+        pThread->name[i] = (threadDescription[i] < 0x80) ? char(threadDescription[i]) : '?';
+    pthread_mutex_unlock(&pThread->mutex);
+
+    // the thread is detached and may have exited already, so it names itself rather than being named from here
+    pThread->namePending = true;
+    if (currentThread == pThread)
+        applyPendingThreadName();
+
+    return 0;
+}
+
+DWORD WaitForSingleObject(HANDLE handle, DWORD milliseconds)
+{
+    applyPendingThreadName();
+
+    WaitableHandle* waitable = static_cast<WaitableHandle*>(handle);
+    if (waitable == nullptr)
+        return WAIT_FAILED;
+
+    const timespec deadline = deadlineAfter(milliseconds == INFINITE ? 0 : milliseconds);
+
+    pthread_mutex_lock(&waitable->mutex);
+
+    int result = 0;
+    while (!waitable->signaled && result != ETIMEDOUT)
+    {
+        if (milliseconds == INFINITE)
+            result = pthread_cond_wait(&waitable->condition, &waitable->mutex);
+        else
+            result = pthread_cond_timedwait(&waitable->condition, &waitable->mutex, &deadline);
+    }
+
+    const bool signaled = waitable->signaled;
+    if (signaled && waitable->type == HandleType::Event && !static_cast<Event*>(waitable)->manualReset)
+        waitable->signaled = false;
+
+    pthread_mutex_unlock(&waitable->mutex);
+
+    return signaled ? WAIT_OBJECT_0 : WAIT_TIMEOUT;
+}
+
+BOOL CloseHandle(HANDLE handle)
+{
+    WaitableHandle* waitable = static_cast<WaitableHandle*>(handle);
+    if (waitable == nullptr)
+        return FALSE;
+
+    if (waitable->type == HandleType::Thread)
+        static_cast<Thread*>(waitable)->release();
+    else
+        delete static_cast<Event*>(waitable);
+
+    return TRUE;
+}
+
+BOOL QueryPerformanceCounter(LARGE_INTEGER* performanceCount)
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    performanceCount->QuadPart = int64_t(now.tv_sec) * 1000000000 + now.tv_nsec;
+    return TRUE;
+}
+
+BOOL QueryPerformanceFrequency(LARGE_INTEGER* frequency)
+{
+    frequency->QuadPart = 1000000000;
+    return TRUE;
+}
+
+#endif  // #if !defined(_WIN32)
+
+#if !defined(_WIN32)
+// Sleeping wakes up late by the timer slack and scheduling latency, the last part of the wait is spent spinning
+static const int64_t WaitSpinTailInNanoseconds = 250000;
+#endif  // #if !defined(_WIN32)
+
+void waitForPerformanceCount(const int64_t targetCount)
+{
+#if !defined(_WIN32)
+    // the performance counter is CLOCK_MONOTONIC in nanoseconds here, so the target can be slept on directly
+    const int64_t sleepTarget = targetCount - WaitSpinTailInNanoseconds;
+    timespec      now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (int64_t(now.tv_sec) * 1000000000 + now.tv_nsec < sleepTarget)
+    {
+        timespec wakeUp;
+        wakeUp.tv_sec  = time_t(sleepTarget / 1000000000);
+        wakeUp.tv_nsec = long(sleepTarget % 1000000000);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUp, nullptr) == EINTR)
+        {
+        }
+    }
+#endif  // #if !defined(_WIN32)
+
+    int64_t currentCount = 0;
+    do
+    {
+        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentCount));
+    } while (currentCount < targetCount);
+}
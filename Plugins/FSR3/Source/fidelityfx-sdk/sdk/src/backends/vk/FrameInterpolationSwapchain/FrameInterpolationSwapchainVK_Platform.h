@@ -0,0 +1,100 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// The swapchain is written against a small subset of Win32 (critical sections, auto/manual reset events, threads and the
+// performance counter). On Windows those are used directly, elsewhere this header provides the same subset on top of
+// pthreads and CLOCK_MONOTONIC so the pacer and presenter threads run unchanged.
+
+#if defined(_WIN32)
+
+#include <Windows.h>
+#include <synchapi.h>
+#include <stdint.h>
+
+#else
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
+typedef void*    HANDLE;
+typedef void*    LPVOID;
+typedef uint32_t DWORD;
+typedef int      BOOL;
+typedef long     HRESULT;
+
+typedef union _LARGE_INTEGER
+{
+    struct
+    {
+        uint32_t LowPart;
+        int32_t  HighPart;
+    };
+    int64_t QuadPart;
+} LARGE_INTEGER;
+
+typedef DWORD (*LPTHREAD_START_ROUTINE)(LPVOID);
+
+#define WINAPI
+#define TRUE                    1
+#define FALSE                   0
+#define INFINITE                0xFFFFFFFF
+#define WAIT_OBJECT_0           0x00000000
+#define WAIT_TIMEOUT            0x00000102
+#define WAIT_FAILED             0xFFFFFFFF
+#define THREAD_PRIORITY_HIGHEST 2
+#define TEXT(quote)             L##quote
+
+#ifndef _countof
+#define _countof(a) (sizeof(a) / sizeof(*(a)))
+#endif
+
+typedef struct CRITICAL_SECTION
+{
+    pthread_mutex_t mutex;
+} CRITICAL_SECTION;
+
+void InitializeCriticalSection(CRITICAL_SECTION* criticalSection);
+void DeleteCriticalSection(CRITICAL_SECTION* criticalSection);
+void EnterCriticalSection(CRITICAL_SECTION* criticalSection);
+void LeaveCriticalSection(CRITICAL_SECTION* criticalSection);
+
+HANDLE  CreateEvent(void* eventAttributes, BOOL manualReset, BOOL initialState, const wchar_t* name);
+BOOL    SetEvent(HANDLE event);
+BOOL    ResetEvent(HANDLE event);
+HANDLE  CreateThread(void* threadAttributes, size_t stackSize, LPTHREAD_START_ROUTINE startAddress, LPVOID parameter, DWORD creationFlags, DWORD* threadId);
+BOOL    SetThreadPriority(HANDLE thread, int priority);
+HRESULT SetThreadDescription(HANDLE thread, const wchar_t* threadDescription);
+DWORD   WaitForSingleObject(HANDLE handle, DWORD milliseconds);
+BOOL    CloseHandle(HANDLE handle);
+
+// CLOCK_MONOTONIC in nanoseconds
+BOOL QueryPerformanceCounter(LARGE_INTEGER* performanceCount);
+BOOL QueryPerformanceFrequency(LARGE_INTEGER* frequency);
+
+#endif  // #if defined(_WIN32)
+
+// Blocks until the performance counter reaches targetCount. Windows spins the whole time, other platforms sleep until
+// shortly before the target and spin the rest
+void waitForPerformanceCount(const int64_t targetCount);
@@ -101,8 +101,21 @@ typedef struct BackendContext_VK {
         bool                    undefined;
         bool                    dynamic;
 
+        uint32_t                aliasGroup;     // bound to the memory of this alias group, 0 for dedicated allocations
+
     } Resource;
 
+    // memory shared by the resources of one alias group
+    typedef struct AliasHeap
+    {
+        VkDeviceMemory          memory;
+        VkDeviceSize            size;
+        uint32_t                memoryTypeIndex;
+        VkMemoryPropertyFlags   memoryProperties;
+        uint32_t                refCount;
+
+    } AliasHeap;
+
     typedef struct PipelineLayout {
 
         VkSampler               samplers[FFX_MAX_SAMPLERS];
@@ -242,6 +255,9 @@ typedef struct BackendContext_VK {
         // VRAM usage
         FfxEffectMemoryUsage vramUsage;
 
+        // Memory aliasing
+        AliasHeap            aliasHeaps[FFX_MAX_ALIAS_GROUPS];
+
     } EffectContext;
 
     Resource*               pResources;
@@ -944,6 +960,48 @@ FfxErrorCode allocateDeviceMemory(BackendContext_VK* backendContext, VkMemoryReq
     return FFX_OK;
 }
 
+// Reserve the memory of the alias group for a transient resource, which is then bound at offset 0. The first member of a
+// group allocates the memory, later members that don't fit or need another memory type return false and get their own allocation.
+static bool acquireAliasHeapVK(BackendContext_VK*               backendContext,
+                               BackendContext_VK::AliasHeap&    aliasHeap,
+                               const VkMemoryRequirements&      memRequirements,
+                               VkMemoryPropertyFlags            requiredMemoryProperties,
+                               BackendContext_VK::Resource*     backendResource,
+                               VkDeviceSize&                    outNewHeapSize)
+{
+    outNewHeapSize = 0;
+
+    if (aliasHeap.memory == VK_NULL_HANDLE)
+    {
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = memRequirements.size;
+        allocInfo.memoryTypeIndex = findMemoryTypeIndex(backendContext->physicalDevice, memRequirements, requiredMemoryProperties, aliasHeap.memoryProperties);
+
+        if (allocInfo.memoryTypeIndex == UINT32_MAX)
+            return false;
+
+        if (backendContext->vkFunctionTable.vkAllocateMemory(backendContext->device, &allocInfo, nullptr, &aliasHeap.memory) != VK_SUCCESS)
+        {
+            aliasHeap.memory = VK_NULL_HANDLE;
+            return false;
+        }
+
+        aliasHeap.size = memRequirements.size;
+        aliasHeap.memoryTypeIndex = allocInfo.memoryTypeIndex;
+        aliasHeap.refCount = 0;
+        outNewHeapSize = aliasHeap.size;
+    }
+    else if (aliasHeap.size < memRequirements.size || (memRequirements.memoryTypeBits & (1u << aliasHeap.memoryTypeIndex)) == 0)
+    {
+        return false;
+    }
+
+    ++aliasHeap.refCount;
+    backendResource->memoryProperties = aliasHeap.memoryProperties;
+    return true;
+}
+
 void setVKObjectName(BackendContext_VK::VKFunctionTable& vkFunctionTable, VkDevice device, VkObjectType objectType, uint64_t object, char* name)
 {
     VkDebugUtilsObjectNameInfoEXT s{ VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr, objectType, object, name };
@@ -1742,6 +1800,7 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
             }
             effectContext.nextPipelineLayout = (i * FFX_MAX_PASS_COUNT);
             effectContext.frameIndex = 0;
+            memset(effectContext.aliasHeaps, 0, sizeof(effectContext.aliasHeaps));
 
             if (bindlessConfig)
             {
@@ -2227,9 +2286,22 @@ FfxErrorCode CreateResourceVK(
     backendResource->dynamic = false;   // Not a dynamic resource (need to track them separately for image views)
     backendResource->resourceDescription = resourceDesc;
     backendResource->allocationSize = 0;
+    backendResource->deviceMemory = VK_NULL_HANDLE;
+    backendResource->aliasGroup = 0;
 
     const auto& initData = createResourceDescription->initData;
 
+    // transient resources share the memory of their alias group, their contents are never initialized
+    const uint32_t aliasGroup =
+        (createResourceDescription->aliasGroup <= FFX_MAX_ALIAS_GROUPS &&
+         createResourceDescription->heapType == FFX_HEAP_TYPE_DEFAULT &&
+         initData.type == FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED &&
+         (createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
+            ? createResourceDescription->aliasGroup : 0;
+
+    // aliased resources only account for the memory of their group once
+    VkDeviceSize accountedSize = 0;
+
     const FfxResourceStates resourceState =
         ((initData.type != FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED) && (createResourceDescription->heapType != FFX_HEAP_TYPE_UPLOAD))
             ? FFX_RESOURCE_STATE_COPY_DEST
@@ -2275,11 +2347,23 @@ FfxErrorCode CreateResourceVK(
         backendContext->vkFunctionTable.vkGetBufferMemoryRequirements(backendContext->device, backendResource->bufferResource, &memRequirements);
 
         // allocate the memory
-        FfxErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, backendResource);
-        if (FFX_OK != errorCode)
-            return errorCode;
+        VkDeviceMemory boundMemory = VK_NULL_HANDLE;
+        if (aliasGroup != 0 && acquireAliasHeapVK(backendContext, effectContext.aliasHeaps[aliasGroup - 1], memRequirements, requiredMemoryProperties, backendResource, accountedSize))
+        {
+            backendResource->aliasGroup = aliasGroup;
+            boundMemory = effectContext.aliasHeaps[aliasGroup - 1].memory;
+        }
+        else
+        {
+            FfxErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, backendResource);
+            if (FFX_OK != errorCode)
+                return errorCode;
+
+            boundMemory = backendResource->deviceMemory;
+            accountedSize = memRequirements.size;
+        }
 
-        if (backendContext->vkFunctionTable.vkBindBufferMemory(backendContext->device, backendResource->bufferResource, backendResource->deviceMemory, 0) != VK_SUCCESS) {
+        if (backendContext->vkFunctionTable.vkBindBufferMemory(backendContext->device, backendResource->bufferResource, boundMemory, 0) != VK_SUCCESS) {
             return FFX_ERROR_BACKEND_API_ERROR;
         }
 
@@ -2355,11 +2439,23 @@ FfxErrorCode CreateResourceVK(
         backendContext->vkFunctionTable.vkGetImageMemoryRequirements(backendContext->device, backendResource->imageResource, &memRequirements);
 
         // allocate the memory
-        FfxErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, backendResource);
-        if (FFX_OK != errorCode)
-            return errorCode;
+        VkDeviceMemory boundMemory = VK_NULL_HANDLE;
+        if (aliasGroup != 0 && acquireAliasHeapVK(backendContext, effectContext.aliasHeaps[aliasGroup - 1], memRequirements, requiredMemoryProperties, backendResource, accountedSize))
+        {
+            backendResource->aliasGroup = aliasGroup;
+            boundMemory = effectContext.aliasHeaps[aliasGroup - 1].memory;
+        }
+        else
+        {
+            FfxErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, backendResource);
+            if (FFX_OK != errorCode)
+                return errorCode;
+
+            boundMemory = backendResource->deviceMemory;
+            accountedSize = memRequirements.size;
+        }
 
-        if (backendContext->vkFunctionTable.vkBindImageMemory(backendContext->device, backendResource->imageResource, backendResource->deviceMemory, 0) != VK_SUCCESS) {
+        if (backendContext->vkFunctionTable.vkBindImageMemory(backendContext->device, backendResource->imageResource, boundMemory, 0) != VK_SUCCESS) {
             return FFX_ERROR_BACKEND_API_ERROR;
         }
 
@@ -2490,10 +2586,10 @@ FfxErrorCode CreateResourceVK(
     }
 
     backendResource->allocationSize = memRequirements.size;
-    effectContext.vramUsage.totalUsageInBytes += static_cast<uint64_t>(backendResource->allocationSize);
+    effectContext.vramUsage.totalUsageInBytes += static_cast<uint64_t>(accountedSize);
     if ((createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
     {
-        effectContext.vramUsage.aliasableUsageInBytes += static_cast<uint64_t>(backendResource->allocationSize);
+        effectContext.vramUsage.aliasableUsageInBytes += static_cast<uint64_t>(accountedSize);
     }
 
     return FFX_OK;
@@ -2565,6 +2661,23 @@ FfxErrorCode DestroyResourceVK(FfxInterface* backendInterface, FfxResourceIntern
             }
             backgroundResource.allocationSize = 0;
         }
+        else if (backgroundResource.aliasGroup > 0)
+        {
+            // the memory of an alias group goes away with its last member
+            BackendContext_VK::AliasHeap& aliasHeap = effectContext.aliasHeaps[backgroundResource.aliasGroup - 1];
+            FFX_ASSERT(aliasHeap.refCount > 0);
+            if (--aliasHeap.refCount == 0)
+            {
+                backendContext->vkFunctionTable.vkFreeMemory(backendContext->device, aliasHeap.memory, nullptr);
+                aliasHeap.memory = VK_NULL_HANDLE;
+
+                effectContext.vramUsage.totalUsageInBytes -= static_cast<uint64_t>(aliasHeap.size);
+                effectContext.vramUsage.aliasableUsageInBytes -= static_cast<uint64_t>(aliasHeap.size);
+                aliasHeap.size = 0;
+            }
+            backgroundResource.aliasGroup = 0;
+            backgroundResource.allocationSize = 0;
+        }
     }
 
     return FFX_OK;
@@ -2666,6 +2779,7 @@ FfxErrorCode RegisterResourceVK(
 
     // If we got here, we are setting up a new dynamic entry
     backendResource->resourceDescription = inFfxResource->description;
+    backendResource->aliasGroup = 0;
     if (inFfxResource->description.type == FFX_RESOURCE_TYPE_BUFFER)
         backendResource->bufferResource = reinterpret_cast<VkBuffer>(inFfxResource->resource);
     else
@@ -3249,6 +3363,7 @@ FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
     // WON'T WORK WITH FSR3!!
     backendInterface->fpGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob);
     FFX_ASSERT(shaderBlob.data && shaderBlob.size);
+    FfxShaderBlobScope shaderBlobScope = { &shaderBlob };  // archived blobs are only decompressed while the pipeline is created
 
     //////////////////////////////////////////////////////////////////////////
     // One root signature (or pipeline layout) per pipeline
@@ -4104,6 +4219,37 @@ static FfxErrorCode executeGpuJobBarrier(BackendContext_VK* backendContext, FfxG
     return FFX_OK;
 }
 
+static FfxErrorCode executeGpuJobDiscard(BackendContext_VK* backendContext, FfxGpuJobDescription* job, VkCommandBuffer vkCommandBuffer)
+{
+    BackendContext_VK::Resource& ffxResource = backendContext->pResources[job->discardJobDescriptor.target.internalIndex];
+
+    // resources with their own memory keep their contents
+    if (ffxResource.aliasGroup == 0)
+        return FFX_OK;
+
+    flushBarriers(backendContext, vkCommandBuffer);
+
+    // the previous contents belong to another member of the alias group, so transition from undefined
+    ffxResource.undefined = true;
+    addBarrier(backendContext, &job->discardJobDescriptor.target, ffxResource.currentState);
+
+    // and make all earlier writes to the shared memory visible before it is reused
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    const VkPipelineStageFlags stageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+    backendContext->vkFunctionTable.vkCmdPipelineBarrier(vkCommandBuffer, backendContext->srcStageMask | stageMask, backendContext->dstStageMask | stageMask, 0,
+        1, &memoryBarrier, backendContext->scheduledBufferBarrierCount, backendContext->bufferMemoryBarriers, backendContext->scheduledImageBarrierCount, backendContext->imageMemoryBarriers);
+    backendContext->scheduledImageBarrierCount = 0;
+    backendContext->scheduledBufferBarrierCount = 0;
+    backendContext->srcStageMask = 0;
+    backendContext->dstStageMask = 0;
+
+    return FFX_OK;
+}
+
 static FfxErrorCode executeGpuJobTimestamp(BackendContext_VK* backendContext, FfxGpuJobDescription* job, VkCommandBuffer vkCommandBuffer)
 {
     return FFX_OK;
@@ -4196,6 +4342,11 @@ FfxErrorCode ExecuteGpuJobsVK(FfxInterface* backendInterface, FfxCommandList com
             errorCode = executeGpuJobBarrier(backendContext, gpuJob, vkCommandBuffer);
             break;
         }
+        case FFX_GPU_JOB_DISCARD:
+        {
+            errorCode = executeGpuJobDiscard(backendContext, gpuJob, vkCommandBuffer);
+            break;
+        }
         default:;
         }
 
@@ -36,6 +36,7 @@
 #include <FidelityFX/gpu/ffx_core.h>
 #include <FidelityFX/gpu/spd/ffx_spd.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_lifetime.h>
 
 #include "ffx_frameinterpolation_private.h"
 
@@ -113,6 +114,75 @@ static const ResourceBinding cbResourceBindingTable[] =
     {FFX_FRAMEINTERPOLATION_INPAINTING_PYRAMID_CONSTANTBUFFER_IDENTIFIER,                   L"cbInpaintingPyramid"},
 };
 
+// order of the jobs scheduled by ffxFrameInterpolationDispatch
+typedef enum FrameInterpolationPassSlot
+{
+    FRAMEINTERPOLATION_PASS_SLOT_SETUP,
+    FRAMEINTERPOLATION_PASS_SLOT_CLEAR_RECONSTRUCTED_DEPTH,
+    FRAMEINTERPOLATION_PASS_SLOT_RECONSTRUCT_PREVIOUS_DEPTH,
+    FRAMEINTERPOLATION_PASS_SLOT_GAME_MOTION_VECTOR_FIELD,
+    FRAMEINTERPOLATION_PASS_SLOT_GAME_VECTOR_FIELD_INPAINTING_PYRAMID,
+    FRAMEINTERPOLATION_PASS_SLOT_OPTICAL_FLOW_VECTOR_FIELD,
+    FRAMEINTERPOLATION_PASS_SLOT_DISOCCLUSION_MASK,
+    FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION,
+    FRAMEINTERPOLATION_PASS_SLOT_INPAINTING_PYRAMID,
+    FRAMEINTERPOLATION_PASS_SLOT_INPAINTING,
+    FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW,
+} FrameInterpolationPassSlot;
+
+// aliasable resources read or written by each job
+static const FfxResourcePassUsage passUsageTable[] =
+{
+    {FRAMEINTERPOLATION_PASS_SLOT_SETUP,                                FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_SETUP,                                FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_SETUP,                                FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_SETUP,                                FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_SETUP,                                FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_CLEAR_RECONSTRUCTED_DEPTH,            FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_RECONSTRUCT_PREVIOUS_DEPTH,           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_GAME_MOTION_VECTOR_FIELD,             FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_GAME_MOTION_VECTOR_FIELD,             FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_GAME_VECTOR_FIELD_INPAINTING_PYRAMID,  FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_GAME_VECTOR_FIELD_INPAINTING_PYRAMID,  FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_GAME_VECTOR_FIELD_INPAINTING_PYRAMID,  FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_OPTICAL_FLOW_VECTOR_FIELD,            FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_OPTICAL_FLOW_VECTOR_FIELD,            FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_Y},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_DISOCCLUSION_MASK,                    FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_DISOCCLUSION_MASK,                    FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_DISOCCLUSION_MASK,                    FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID},
+    {FRAMEINTERPOLATION_PASS_SLOT_DISOCCLUSION_MASK,                    FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME},
+    {FRAMEINTERPOLATION_PASS_SLOT_DISOCCLUSION_MASK,                    FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION,                        FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION,                        FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION,                        FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION,                        FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION,                        FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID},
+    {FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION,                        FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_INPAINTING_PYRAMID,                   FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID},
+
+    {FRAMEINTERPOLATION_PASS_SLOT_INPAINTING,                           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID},
+};
+
+// the debug view rebuilds the game vector field pyramid before drawing. Only contexts created with debug checking
+// keep its resources alive until the end of the frame, otherwise it relies on nothing being activated after interpolation
+static const FfxResourcePassUsage debugViewPassUsageTable[] =
+{
+    {FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW,                           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW,                           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW,                           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_X},
+    {FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW,                           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_Y},
+    {FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW,                           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID},
+    {FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW,                           FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK},
+};
+
 // Broad structure of the root signature.
 typedef enum FrameInterpolationRootSignatureLayout {
 
@@ -486,8 +556,30 @@ static FfxErrorCode frameinterpolationCreate(FfxFrameInterpolationContext_Privat
     // clear the SRV resources to NULL.
     memset(context->srvResources, 0, sizeof(context->srvResources));
 
-    for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFX_ARRAY_ELEMENTS(internalSurfaceDesc); ++currentSurfaceIndex) {
+    // let aliasable resources with disjoint lifetimes share memory, the largest member of each group is created first
+    const uint32_t surfaceCount = FFX_ARRAY_ELEMENTS(internalSurfaceDesc);
+    uint32_t aliasGroups[surfaceCount];
+    uint32_t firstUse[surfaceCount];
+    uint32_t creationOrder[surfaceCount];
+
+    FfxResourcePassUsage passUsages[FFX_ARRAY_ELEMENTS(passUsageTable) + FFX_ARRAY_ELEMENTS(debugViewPassUsageTable)];
+    uint32_t passUsageCount = FFX_ARRAY_ELEMENTS(passUsageTable);
+    memcpy(passUsages, passUsageTable, sizeof(passUsageTable));
+    if (context->contextDescription.flags & FFX_FRAMEINTERPOLATION_ENABLE_DEBUG_CHECKING) {
+        memcpy(passUsages + passUsageCount, debugViewPassUsageTable, sizeof(debugViewPassUsageTable));
+        passUsageCount += FFX_ARRAY_ELEMENTS(debugViewPassUsageTable);
+    }
+
+    ffxAssignResourceAliasGroups(internalSurfaceDesc, surfaceCount, passUsages, passUsageCount, aliasGroups, firstUse);
+    ffxGetResourceCreationOrder(internalSurfaceDesc, surfaceCount, aliasGroups, creationOrder);
+
+    for (uint32_t resourceId = 0; resourceId < FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNT; ++resourceId) {
+        context->resourceActivationSlot[resourceId] = FFX_RESOURCE_LIFETIME_UNUSED;
+    }
 
+    for (uint32_t creationIndex = 0; creationIndex < surfaceCount; ++creationIndex) {
+
+        const uint32_t currentSurfaceIndex = creationOrder[creationIndex];
         const FfxInternalResourceDescription* currentSurfaceDescription = &internalSurfaceDesc[currentSurfaceIndex];
         const FfxResourceDescription          resourceDescription       = {currentSurfaceDescription->type,
                                                                            currentSurfaceDescription->format,
@@ -501,9 +593,16 @@ static FfxErrorCode frameinterpolationCreate(FfxFrameInterpolationContext_Privat
         if (currentSurfaceDescription->usage == FFX_RESOURCE_USAGE_READ_ONLY) initialState = FFX_RESOURCE_STATE_COMPUTE_READ;
         if (currentSurfaceDescription->usage == FFX_RESOURCE_USAGE_RENDERTARGET) initialState = FFX_RESOURCE_STATE_RENDER_TARGET;
 
-        const FfxCreateResourceDescription createResourceDescription = { FFX_HEAP_TYPE_DEFAULT, resourceDescription, initialState, currentSurfaceDescription->name, currentSurfaceDescription->id, currentSurfaceDescription->initData };
+        const FfxCreateResourceDescription createResourceDescription = { FFX_HEAP_TYPE_DEFAULT, resourceDescription, initialState, currentSurfaceDescription->name, currentSurfaceDescription->id, currentSurfaceDescription->initData, aliasGroups[currentSurfaceIndex] };
 
         FFX_VALIDATE(context->contextDescription.backendInterface.fpCreateResource(&context->contextDescription.backendInterface, &createResourceDescription, context->effectContextId, &context->srvResources[currentSurfaceDescription->id]));
+
+        if (currentSurfaceDescription->flags & FFX_RESOURCE_FLAGS_ALIASABLE) {
+            context->resourceActivationSlot[currentSurfaceDescription->id] = firstUse[currentSurfaceIndex];
+
+            // the debug view reads resources past their last use unless debugViewPassUsageTable was applied
+            FFX_ASSERT(firstUse[currentSurfaceIndex] <= FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION || firstUse[currentSurfaceIndex] == FFX_RESOURCE_LIFETIME_UNUSED);
+        }
     }
 
     // copy resources to uavResrouces list
@@ -1089,23 +1188,12 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
 
     // Schedule work for the interpolation command list
     {
-        FfxResourceInternal aliasableResources[] = {
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME],
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X],
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y],
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID],
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_X],
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_Y],
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_MASK],
-            contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK]
+        // aliasable resources take over their memory right before the first job that touches them
+        auto scheduleActivation = [&](uint32_t passSlot) {
+            ffxScheduleResourceActivation(&contextPrivate->contextDescription.backendInterface, contextPrivate->uavResources, contextPrivate->resourceActivationSlot, FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNT, passSlot);
         };
-        for (int i = 0; i < _countof(aliasableResources); ++i)
-        {
-            FfxGpuJobDescription discardJob        = {FFX_GPU_JOB_DISCARD};
-            discardJob.discardJobDescriptor.target = aliasableResources[i];
-            contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &discardJob);
-        }
 
+        scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_SETUP);
         scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiSetup, renderDispatchSizeX, renderDispatchSizeY);
 
             // game vector field inpainting pyramid
@@ -1137,6 +1225,7 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
         if (bExecutePreparationPasses)
         {
             // clear estimated depth resources
+            scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_CLEAR_RECONSTRUCTED_DEPTH);
             {
                 FfxGpuJobDescription clearJob = {FFX_GPU_JOB_CLEAR_FLOAT};
 
@@ -1151,16 +1240,22 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
                 contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &clearJob);
             }
 
+            scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_RECONSTRUCT_PREVIOUS_DEPTH);
             scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiReconstructPreviousDepth, renderDispatchSizeX, renderDispatchSizeY);
+            scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_GAME_MOTION_VECTOR_FIELD);
             scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiGameMotionVectorField, renderDispatchSizeX, renderDispatchSizeY);
 
+            scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_GAME_VECTOR_FIELD_INPAINTING_PYRAMID);
             scheduleDispatchGameVectorFieldInpaintingPyramid();
 
+            scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_OPTICAL_FLOW_VECTOR_FIELD);
             scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiOpticalFlowVectorField, opticalFlowDispatchSizeX, opticalFlowDispatchSizeY);
 
+            scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_DISOCCLUSION_MASK);
             scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiDisocclusionMask, renderDispatchSizeX, renderDispatchSizeY);
         }
 
+        scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_INTERPOLATION);
         scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiScfi, displayDispatchSizeX, displayDispatchSizeY);
 
         // inpainting pyramid
@@ -1184,11 +1279,14 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
                 sizeof(contextPrivate->inpaintingPyramidContants),
                 &contextPrivate->constantBuffers[FFX_FRAMEINTERPOLATION_INPAINTING_PYRAMID_CONSTANTBUFFER_IDENTIFIER]);
 
+            scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_INPAINTING_PYRAMID);
             scheduleDispatch(contextPrivate, &contextPrivate->pipelineInpaintingPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
         }
 
+        scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_INPAINTING);
         scheduleDispatch(contextPrivate, &contextPrivate->pipelineInpainting, displayDispatchSizeX, displayDispatchSizeY);
 
+        scheduleActivation(FRAMEINTERPOLATION_PASS_SLOT_DEBUG_VIEW);
         if (params->flags & FFX_FRAMEINTERPOLATION_DISPATCH_DRAW_DEBUG_VIEW)
         {
             scheduleDispatchGameVectorFieldInpaintingPyramid();
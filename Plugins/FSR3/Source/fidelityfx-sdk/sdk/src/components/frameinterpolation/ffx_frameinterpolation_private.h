@@ -137,6 +137,9 @@ typedef struct FfxFrameInterpolationContext_Private {
     FfxResourceInternal                         srvResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNT];
     FfxResourceInternal                         uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNT];
 
+    // pass slot before which each aliasable resource is activated (discarded), FFX_RESOURCE_LIFETIME_UNUSED otherwise
+    uint32_t                                    resourceActivationSlot[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNT];
+
     bool                                        firstExecution;
     bool                                        refreshPipelineStates;
 
@@ -40,6 +40,7 @@
 #include <FidelityFX/gpu/fsr3upscaler/ffx_fsr3upscaler_resources.h>
 #include <FidelityFX/gpu/fsr3upscaler/ffx_fsr3upscaler_common.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_lifetime.h>
 
 // max queued frames for descriptor management
 static const uint32_t FSR3UPSCALER_MAX_QUEUED_FRAMES = 16;
@@ -122,6 +123,50 @@ static const ResourceBinding constantBufferBindingTable[] =
     {FFX_FSR3UPSCALER_CONSTANTBUFFER_IDENTIFIER_GENREACTIVE,    L"cbGenerateReactive"},
 };
 
+// order of the jobs scheduled by fsr3upscalerDispatch
+typedef enum Fsr3UpscalerPassSlot
+{
+    FSR3UPSCALER_PASS_SLOT_CLEAR,
+    FSR3UPSCALER_PASS_SLOT_PREPARE_INPUTS,
+    FSR3UPSCALER_PASS_SLOT_LUMA_PYRAMID,
+    FSR3UPSCALER_PASS_SLOT_SHADING_CHANGE_PYRAMID,
+    FSR3UPSCALER_PASS_SLOT_SHADING_CHANGE,
+    FSR3UPSCALER_PASS_SLOT_PREPARE_REACTIVITY,
+    FSR3UPSCALER_PASS_SLOT_LUMA_INSTABILITY,
+    FSR3UPSCALER_PASS_SLOT_ACCUMULATE,
+    FSR3UPSCALER_PASS_SLOT_RCAS,
+    FSR3UPSCALER_PASS_SLOT_DEBUG_VIEW,
+} Fsr3UpscalerPassSlot;
+
+// aliasable resources read or written by each job, FARTHEST_DEPTH and LUMA_INSTABILITY live in INTERMEDIATE_FP16x1
+static const FfxResourcePassUsage passUsageTable[] =
+{
+    // only mip 0 of SPD_MIPS is cleared each frame, the other mips must keep what earlier frames wrote
+    {FFX_RESOURCE_LIFETIME_PERSISTENT,              FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS},
+
+    {FSR3UPSCALER_PASS_SLOT_PREPARE_INPUTS,         FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERMEDIATE_FP16x1},
+
+    {FSR3UPSCALER_PASS_SLOT_LUMA_PYRAMID,           FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERMEDIATE_FP16x1},
+    {FSR3UPSCALER_PASS_SLOT_LUMA_PYRAMID,           FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH_MIP1},
+
+    {FSR3UPSCALER_PASS_SLOT_SHADING_CHANGE,         FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SHADING_CHANGE},
+
+    {FSR3UPSCALER_PASS_SLOT_PREPARE_REACTIVITY,     FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SHADING_CHANGE},
+    {FSR3UPSCALER_PASS_SLOT_PREPARE_REACTIVITY,     FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS},
+    {FSR3UPSCALER_PASS_SLOT_PREPARE_REACTIVITY,     FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_NEW_LOCKS},
+
+    {FSR3UPSCALER_PASS_SLOT_LUMA_INSTABILITY,       FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS},
+    {FSR3UPSCALER_PASS_SLOT_LUMA_INSTABILITY,       FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH_MIP1},
+    {FSR3UPSCALER_PASS_SLOT_LUMA_INSTABILITY,       FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERMEDIATE_FP16x1},
+
+    {FSR3UPSCALER_PASS_SLOT_ACCUMULATE,             FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS},
+    {FSR3UPSCALER_PASS_SLOT_ACCUMULATE,             FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH_MIP1},
+    {FSR3UPSCALER_PASS_SLOT_ACCUMULATE,             FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERMEDIATE_FP16x1},
+    {FSR3UPSCALER_PASS_SLOT_ACCUMULATE,             FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_NEW_LOCKS},
+
+    {FSR3UPSCALER_PASS_SLOT_DEBUG_VIEW,             FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS},
+};
+
 typedef struct Fsr3UpscalerRcasConstants {
 
     uint32_t                    rcasConfig[4];
@@ -618,8 +663,21 @@ static FfxErrorCode fsr3upscalerCreate(FfxFsr3UpscalerContext_Private* context,
     // clear the SRV resources to NULL.
     memset(context->srvResources, 0, sizeof(context->srvResources));
 
-    for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFX_ARRAY_ELEMENTS(internalSurfaceDesc); ++currentSurfaceIndex) {
+    // let aliasable resources with disjoint lifetimes share memory, the largest member of each group is created first
+    const uint32_t surfaceCount = FFX_ARRAY_ELEMENTS(internalSurfaceDesc);
+    uint32_t aliasGroups[surfaceCount];
+    uint32_t firstUse[surfaceCount];
+    uint32_t creationOrder[surfaceCount];
+    ffxAssignResourceAliasGroups(internalSurfaceDesc, surfaceCount, passUsageTable, FFX_ARRAY_ELEMENTS(passUsageTable), aliasGroups, firstUse);
+    ffxGetResourceCreationOrder(internalSurfaceDesc, surfaceCount, aliasGroups, creationOrder);
 
+    for (uint32_t resourceId = 0; resourceId < FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_COUNT; ++resourceId) {
+        context->resourceActivationSlot[resourceId] = FFX_RESOURCE_LIFETIME_UNUSED;
+    }
+
+    for (uint32_t creationIndex = 0; creationIndex < surfaceCount; ++creationIndex) {
+
+        const uint32_t currentSurfaceIndex = creationOrder[creationIndex];
         const FfxInternalResourceDescription* currentSurfaceDescription = &internalSurfaceDesc[currentSurfaceIndex];
         const FfxResourceType resourceType = internalSurfaceDesc[currentSurfaceIndex].type;
         const FfxResourceDescription          resourceDescription       = {resourceType,
@@ -631,9 +689,13 @@ static FfxErrorCode fsr3upscalerCreate(FfxFsr3UpscalerContext_Private* context,
                                                                            currentSurfaceDescription->flags,
                                                                            currentSurfaceDescription->usage};
         const FfxResourceStates initialState = (currentSurfaceDescription->usage == FFX_RESOURCE_USAGE_READ_ONLY) ? FFX_RESOURCE_STATE_COMPUTE_READ : FFX_RESOURCE_STATE_UNORDERED_ACCESS;
-        const FfxCreateResourceDescription createResourceDescription = { FFX_HEAP_TYPE_DEFAULT, resourceDescription, initialState, currentSurfaceDescription->name, currentSurfaceDescription->id, currentSurfaceDescription->initData };
+        const FfxCreateResourceDescription createResourceDescription = { FFX_HEAP_TYPE_DEFAULT, resourceDescription, initialState, currentSurfaceDescription->name, currentSurfaceDescription->id, currentSurfaceDescription->initData, aliasGroups[currentSurfaceIndex] };
 
         FFX_VALIDATE(context->contextDescription.backendInterface.fpCreateResource(&context->contextDescription.backendInterface, &createResourceDescription, context->effectContextId, &context->srvResources[currentSurfaceDescription->id]));
+
+        if (currentSurfaceDescription->flags & FFX_RESOURCE_FLAGS_ALIASABLE) {
+            context->resourceActivationSlot[currentSurfaceDescription->id] = firstUse[currentSurfaceIndex];
+        }
     }
 
     // copy resources to uavResrouces list
@@ -1039,6 +1101,13 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
     const int32_t dispatchShadingChangePassX = (int32_t(context->constants.renderSize[0] * 0.5f) + (threadGroupWorkRegionDim - 1)) / threadGroupWorkRegionDim;
     const int32_t dispatchShadingChangePassY = (int32_t(context->constants.renderSize[1] * 0.5f) + (threadGroupWorkRegionDim - 1)) / threadGroupWorkRegionDim;
 
+    // aliasable resources take over their memory right before the first job that touches them
+    auto scheduleActivation = [&](Fsr3UpscalerPassSlot passSlot) {
+        ffxScheduleResourceActivation(&context->contextDescription.backendInterface, context->uavResources, context->resourceActivationSlot, FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_COUNT, passSlot);
+    };
+
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_CLEAR);
+
     // Clear reconstructed depth for max depth store.
     if (resetAccumulation) {
 
@@ -1113,22 +1182,7 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
     context->contextDescription.backendInterface.fpStageConstantBufferDataFunc(&context->contextDescription.backendInterface, &rcasConsts,                sizeof(rcasConsts),                &context->constantBuffers[FFX_FSR3UPSCALER_CONSTANTBUFFER_IDENTIFIER_RCAS]);
 
     {
-        FfxResourceInternal aliasableResources[] = {
-            context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERMEDIATE_FP16x1],
-            context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SHADING_CHANGE],
-            context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_NEW_LOCKS],
-            // SPD_MIPS are an aliasable resource, but need to be cleared to prevent reading pixels that have never been written
-            //context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS],
-            context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH_MIP1],
-            context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS],
-        };
-        for(int i = 0; i<_countof(aliasableResources); ++i)
-        {
-            FfxGpuJobDescription discardJob = { FFX_GPU_JOB_DISCARD };
-            discardJob.discardJobDescriptor.target = aliasableResources[i];
-            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &discardJob);
-        }
-        // SPD counter needs to be cleared
+        // SPD_MIPS are an aliasable resource, but need to be cleared to prevent reading pixels that have never been written
         {
             FfxGpuJobDescription clearJob = { FFX_GPU_JOB_CLEAR_FLOAT };
             wcscpy_s(clearJob.jobLabel, L"Clear Spd Atomic Count");
@@ -1139,16 +1193,24 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
         }
     }
 
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_PREPARE_INPUTS);
     scheduleDispatch(context, params, &context->pipelinePrepareInputs, dispatchSrcX, dispatchSrcY);
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_LUMA_PYRAMID);
     scheduleDispatch(context, params, &context->pipelineLumaPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_SHADING_CHANGE_PYRAMID);
     scheduleDispatch(context, params, &context->pipelineShadingChangePyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_SHADING_CHANGE);
     scheduleDispatch(context, params, &context->pipelineShadingChange, dispatchShadingChangePassX, dispatchShadingChangePassY);
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_PREPARE_REACTIVITY);
     scheduleDispatch(context, params, &context->pipelinePrepareReactivity, dispatchSrcX, dispatchSrcY);
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_LUMA_INSTABILITY);
     scheduleDispatch(context, params, &context->pipelineLumaInstability, dispatchSrcX, dispatchSrcY);
 
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_ACCUMULATE);
     scheduleDispatch(context, params, params->enableSharpening ? &context->pipelineAccumulateSharpen : &context->pipelineAccumulate, dispatchDstX, dispatchDstY);
 
     // RCAS
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_RCAS);
     if (params->enableSharpening)
     {
 
@@ -1159,6 +1221,7 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
         scheduleDispatch(context, params, &context->pipelineRCAS, dispatchX, dispatchY);
     }
     
+    scheduleActivation(FSR3UPSCALER_PASS_SLOT_DEBUG_VIEW);
     if (params->flags & FFX_FSR3UPSCALER_DISPATCH_DRAW_DEBUG_VIEW) {
         scheduleDispatch(context, params, &context->pipelineDebugView, dispatchDstX, dispatchDstY);
     }
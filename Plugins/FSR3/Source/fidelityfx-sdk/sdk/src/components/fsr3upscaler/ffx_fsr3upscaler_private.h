@@ -110,6 +110,9 @@ typedef struct FfxFsr3UpscalerContext_Private {
     FfxResourceInternal                 srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_COUNT];
     FfxResourceInternal                 uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_COUNT];
 
+    // pass slot before which each aliasable resource is activated (discarded), FFX_RESOURCE_LIFETIME_UNUSED otherwise
+    uint32_t                            resourceActivationSlot[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_COUNT];
+
     bool                                firstExecution;
     uint32_t                            resourceFrameIndex;
     float                               previousJitterOffset[2];
@@ -0,0 +1,283 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_interface.h>
+#include <FidelityFX/host/ffx_util.h>
+#include "ffx_resource_lifetime.h"
+
+static uint32_t getSurfaceFormatBytesPerPixel(FfxSurfaceFormat format)
+{
+    switch (format) {
+
+    case FFX_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_UINT:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        return 16;
+    case FFX_SURFACE_FORMAT_R32G32B32_FLOAT:
+        return 12;
+    case FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16G16B16A16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32_FLOAT:
+    case FFX_SURFACE_FORMAT_R32G32_TYPELESS:
+        return 8;
+    case FFX_SURFACE_FORMAT_R32_UINT:
+    case FFX_SURFACE_FORMAT_R32_FLOAT:
+    case FFX_SURFACE_FORMAT_R32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_UNORM:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SNORM:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SRGB:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_UNORM:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_SRGB:
+    case FFX_SURFACE_FORMAT_R11G11B10_FLOAT:
+    case FFX_SURFACE_FORMAT_R10G10B10A2_UNORM:
+    case FFX_SURFACE_FORMAT_R10G10B10A2_TYPELESS:
+    case FFX_SURFACE_FORMAT_R9G9B9E5_SHAREDEXP:
+    case FFX_SURFACE_FORMAT_R16G16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16G16_UINT:
+    case FFX_SURFACE_FORMAT_R16G16_SINT:
+    case FFX_SURFACE_FORMAT_R16G16_TYPELESS:
+        return 4;
+    case FFX_SURFACE_FORMAT_R16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16_UINT:
+    case FFX_SURFACE_FORMAT_R16_UNORM:
+    case FFX_SURFACE_FORMAT_R16_SNORM:
+    case FFX_SURFACE_FORMAT_R16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8_UNORM:
+    case FFX_SURFACE_FORMAT_R8G8_UINT:
+    case FFX_SURFACE_FORMAT_R8G8_TYPELESS:
+        return 2;
+    case FFX_SURFACE_FORMAT_R8_UINT:
+    case FFX_SURFACE_FORMAT_R8_UNORM:
+    case FFX_SURFACE_FORMAT_R8_TYPELESS:
+        return 1;
+    default:
+        return 4;
+    }
+}
+
+// Backends can only place resources of the same class in one allocation.
+static uint32_t getAliasClass(const FfxInternalResourceDescription* description)
+{
+    if (description->type == FFX_RESOURCE_TYPE_BUFFER)
+        return 0;
+
+    const uint32_t targetUsage = FFX_RESOURCE_USAGE_RENDERTARGET | FFX_RESOURCE_USAGE_DEPTHTARGET | FFX_RESOURCE_USAGE_STENCILTARGET;
+    return (description->usage & targetUsage) ? 1 : 2;
+}
+
+uint64_t ffxEstimateResourceSize(const FfxInternalResourceDescription* description)
+{
+    FFX_ASSERT(description);
+
+    if (description->type == FFX_RESOURCE_TYPE_BUFFER)
+        return description->width;
+
+    const uint64_t bytesPerPixel = getSurfaceFormatBytesPerPixel(description->format);
+    uint32_t width  = FFX_MAXIMUM(description->width, 1u);
+    uint32_t height = FFX_MAXIMUM(description->height, 1u);
+
+    // a mip count of 0 requests the full chain
+    uint32_t mipCount = description->mipCount;
+    if (mipCount == 0) {
+        for (uint32_t size = FFX_MAXIMUM(width, height); size > 0; size >>= 1)
+            ++mipCount;
+    }
+
+    uint64_t totalSize = 0;
+    for (uint32_t mip = 0; mip < mipCount; ++mip) {
+
+        totalSize += uint64_t(width) * height * bytesPerPixel;
+        width  = FFX_MAXIMUM(width >> 1, 1u);
+        height = FFX_MAXIMUM(height >> 1, 1u);
+    }
+
+    return totalSize;
+}
+
+void ffxAssignResourceAliasGroups(const FfxInternalResourceDescription* descriptions, uint32_t descriptionCount,
+                                  const FfxResourcePassUsage* usages, uint32_t usageCount,
+                                  uint32_t* outAliasGroups, uint32_t* outFirstUse)
+{
+    FFX_ASSERT(descriptions && outAliasGroups && outFirstUse);
+    FFX_ASSERT(descriptionCount <= FFX_MAX_RESOURCE_COUNT);
+
+    uint32_t lastUse[FFX_MAX_RESOURCE_COUNT];
+    uint64_t estimatedSize[FFX_MAX_RESOURCE_COUNT];
+    uint32_t candidates[FFX_MAX_RESOURCE_COUNT];
+    uint32_t candidateCount = 0;
+
+    for (uint32_t i = 0; i < descriptionCount; ++i) {
+
+        outAliasGroups[i] = 0;
+        outFirstUse[i]    = FFX_RESOURCE_LIFETIME_UNUSED;
+        lastUse[i]        = 0;
+        estimatedSize[i]  = ffxEstimateResourceSize(&descriptions[i]);
+
+        bool persistent = false;
+        for (uint32_t u = 0; u < usageCount; ++u) {
+
+            if (usages[u].resourceId != descriptions[i].id)
+                continue;
+
+            if (usages[u].passSlot == FFX_RESOURCE_LIFETIME_PERSISTENT) {
+                persistent = true;
+                continue;
+            }
+
+            outFirstUse[i] = FFX_MINIMUM(outFirstUse[i], usages[u].passSlot);
+            lastUse[i]     = FFX_MAXIMUM(lastUse[i], usages[u].passSlot);
+        }
+
+        // persistent resources are neither aliased nor activated
+        if (persistent) {
+            outFirstUse[i] = FFX_RESOURCE_LIFETIME_UNUSED;
+            continue;
+        }
+
+        if (descriptions[i].flags & FFX_RESOURCE_FLAGS_ALIASABLE)
+            candidates[candidateCount++] = i;
+    }
+
+#if FFX_RESOURCE_ALIASING_ENABLED
+    // order by first use, larger resources first on ties; unused resources go last
+    for (uint32_t i = 1; i < candidateCount; ++i) {
+
+        const uint32_t current = candidates[i];
+        uint32_t j = i;
+        for (; j > 0; --j) {
+
+            const uint32_t previous = candidates[j - 1];
+            const bool before = (outFirstUse[current] < outFirstUse[previous]) ||
+                                (outFirstUse[current] == outFirstUse[previous] && estimatedSize[current] > estimatedSize[previous]);
+            if (!before)
+                break;
+            candidates[j] = previous;
+        }
+        candidates[j] = current;
+    }
+
+    // greedy interval colouring: a group is free once the last use of its latest member has passed
+    struct AliasGroup {
+        uint32_t aliasClass;
+        uint32_t lastUse;
+        uint64_t size;
+        uint32_t memberCount;
+    } groups[FFX_MAX_ALIAS_GROUPS] = {};
+    uint32_t groupCount = 0;
+
+    for (uint32_t c = 0; c < candidateCount; ++c) {
+
+        const uint32_t index      = candidates[c];
+        const uint32_t aliasClass = getAliasClass(&descriptions[index]);
+        const bool     unused     = outFirstUse[index] == FFX_RESOURCE_LIFETIME_UNUSED;
+
+        // among the free groups pick the one that has to grow the least
+        uint32_t bestGroup  = UINT32_MAX;
+        uint64_t bestGrowth = UINT64_MAX;
+        for (uint32_t g = 0; g < groupCount; ++g) {
+
+            if (groups[g].aliasClass != aliasClass || (!unused && groups[g].lastUse >= outFirstUse[index]))
+                continue;
+
+            const uint64_t growth = estimatedSize[index] > groups[g].size ? estimatedSize[index] - groups[g].size : 0;
+            if (growth < bestGrowth) {
+                bestGroup  = g;
+                bestGrowth = growth;
+            }
+        }
+
+        if (bestGroup == UINT32_MAX) {
+
+            if (unused || groupCount == FFX_MAX_ALIAS_GROUPS)
+                continue;
+
+            bestGroup = groupCount++;
+            groups[bestGroup].aliasClass = aliasClass;
+        }
+
+        AliasGroup& group = groups[bestGroup];
+        if (!unused)
+            group.lastUse = lastUse[index];
+        group.size = FFX_MAXIMUM(group.size, estimatedSize[index]);
+        ++group.memberCount;
+        outAliasGroups[index] = bestGroup + 1;
+    }
+
+    // groups with a single member gain nothing from a shared allocation, number the rest consecutively
+    uint32_t remap[FFX_MAX_ALIAS_GROUPS + 1] = {};
+    uint32_t nextGroup = 1;
+    for (uint32_t g = 0; g < groupCount; ++g) {
+
+        if (groups[g].memberCount > 1)
+            remap[g + 1] = nextGroup++;
+    }
+
+    for (uint32_t i = 0; i < descriptionCount; ++i)
+        outAliasGroups[i] = remap[outAliasGroups[i]];
+#endif // #if FFX_RESOURCE_ALIASING_ENABLED
+}
+
+void ffxGetResourceCreationOrder(const FfxInternalResourceDescription* descriptions, uint32_t descriptionCount,
+                                 const uint32_t* aliasGroups, uint32_t* outOrder)
+{
+    FFX_ASSERT(descriptions && aliasGroups && outOrder);
+
+    // dedicated resources keep their declaration order
+    uint32_t orderCount = 0;
+    for (uint32_t i = 0; i < descriptionCount; ++i) {
+
+        if (aliasGroups[i] == 0)
+            outOrder[orderCount++] = i;
+    }
+
+    // aliased resources follow, largest first
+    const uint32_t aliasedStart = orderCount;
+    for (uint32_t i = 0; i < descriptionCount; ++i) {
+
+        if (aliasGroups[i] == 0)
+            continue;
+
+        const uint64_t size = ffxEstimateResourceSize(&descriptions[i]);
+        uint32_t j = orderCount++;
+        for (; j > aliasedStart && ffxEstimateResourceSize(&descriptions[outOrder[j - 1]]) < size; --j)
+            outOrder[j] = outOrder[j - 1];
+        outOrder[j] = i;
+    }
+}
+
+void ffxScheduleResourceActivation(FfxInterface* backendInterface, const FfxResourceInternal* resources,
+                                   const uint32_t* activationSlots, uint32_t resourceCount, uint32_t passSlot)
+{
+    FFX_ASSERT(backendInterface->fpScheduleGpuJob);
+
+    for (uint32_t id = 0; id < resourceCount; ++id) {
+
+        if (activationSlots[id] != passSlot)
+            continue;
+
+        FfxGpuJobDescription discardJob = { FFX_GPU_JOB_DISCARD };
+        discardJob.discardJobDescriptor.target = resources[id];
+        backendInterface->fpScheduleGpuJob(backendInterface, &discardJob);
+    }
+}
@@ -0,0 +1,95 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <FidelityFX/host/ffx_types.h>
+#include <FidelityFX/host/ffx_interface.h>
+
+/// Set to 0 to give every aliasable resource a dedicated allocation again.
+#ifndef FFX_RESOURCE_ALIASING_ENABLED
+#define FFX_RESOURCE_ALIASING_ENABLED   (1)
+#endif // #ifndef FFX_RESOURCE_ALIASING_ENABLED
+
+/// Pass slot value for resources that are never touched by a pass.
+#define FFX_RESOURCE_LIFETIME_UNUSED    (0xFFFFFFFFu)
+
+/// Pass slot value for resources whose contents have to survive between frames, e.g. because
+/// only part of them is cleared. Such resources keep a dedicated allocation and are never discarded.
+#define FFX_RESOURCE_LIFETIME_PERSISTENT (0xFFFFFFFEu)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif  // #if defined(__cplusplus)
+
+/// A single access of an internal resource by an effect pass.
+///
+/// Effects describe their frame as an ordered list of pass slots and list every
+/// aliasable resource each slot reads or writes. The first and last slot that
+/// touch a resource bound its lifetime within the frame.
+typedef struct FfxResourcePassUsage {
+
+    uint32_t    passSlot;       ///< Position of the pass in the effect's per-frame job order
+    uint32_t    resourceId;     ///< Internal resource identifier accessed by the pass
+} FfxResourcePassUsage;
+
+/// Estimate the memory footprint of an internal resource, including its mip chain.
+FFX_API uint64_t ffxEstimateResourceSize(const FfxInternalResourceDescription* description);
+
+/// Assign memory alias groups to the aliasable resources of an effect.
+///
+/// Resources whose lifetimes don't overlap and which a backend may place in the
+/// same memory (buffers, render/depth target textures and other textures never mix)
+/// share a group. Resources left on their own or listed with <c><i>FFX_RESOURCE_LIFETIME_PERSISTENT</i></c>
+/// receive group 0.
+///
+/// @param [in]  descriptions      Internal resource descriptions of the effect.
+/// @param [in]  descriptionCount  Number of entries in <c><i>descriptions</i></c>.
+/// @param [in]  usages            Pass usage table of the effect.
+/// @param [in]  usageCount        Number of entries in <c><i>usages</i></c>.
+/// @param [out] outAliasGroups    Alias group per description (<c><i>descriptionCount</i></c> entries).
+/// @param [out] outFirstUse       First pass slot per description, or <c><i>FFX_RESOURCE_LIFETIME_UNUSED</i></c>.
+FFX_API void ffxAssignResourceAliasGroups(const FfxInternalResourceDescription* descriptions, uint32_t descriptionCount,
+                                          const FfxResourcePassUsage* usages, uint32_t usageCount,
+                                          uint32_t* outAliasGroups, uint32_t* outFirstUse);
+
+/// Compute the order in which to create internal resources so that the first member
+/// of each alias group is its largest one and determines the size of the shared memory.
+FFX_API void ffxGetResourceCreationOrder(const FfxInternalResourceDescription* descriptions, uint32_t descriptionCount,
+                                         const uint32_t* aliasGroups, uint32_t* outOrder);
+
+/// Schedule discard jobs for the aliasable resources whose lifetime starts at <c><i>passSlot</i></c>.
+///
+/// The discard marks the point where a resource takes ownership of its (possibly shared)
+/// memory; backends use it to insert aliasing barriers.
+///
+/// @param [in] backendInterface   The backend interface of the effect.
+/// @param [in] resources          Internal resources of the effect, indexed by resource identifier.
+/// @param [in] activationSlots    First pass slot per resource identifier.
+/// @param [in] resourceCount      Number of resource identifiers.
+/// @param [in] passSlot           The pass slot about to be scheduled.
+FFX_API void ffxScheduleResourceActivation(FfxInterface* backendInterface, const FfxResourceInternal* resources,
+                                           const uint32_t* activationSlots, uint32_t resourceCount, uint32_t passSlot);
+
+#if defined(__cplusplus)
+}
+#endif  // #if defined(__cplusplus)
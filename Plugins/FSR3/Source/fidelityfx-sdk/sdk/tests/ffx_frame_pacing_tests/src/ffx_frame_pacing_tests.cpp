@@ -0,0 +1,188 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Checks the O(1) frame time statistics of the pacing policy against straightforward reference implementations:
+// a two-pass mean/deviation over the window and the exact quantile of all samples.
+//
+// Usage: FidelityFX_FramePacingTests, returns non-zero if a check fails.
+
+#include <ffx_frame_pacing.h>
+
+#include <stdio.h>
+#include <vector>
+#include <algorithm>
+
+static int failureCount = 0;
+
+#define CHECK(condition, ...)                            \
+    do                                                   \
+    {                                                    \
+        if (!(condition))                                \
+        {                                                \
+            printf("FAILED %s:%d ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__);                         \
+            printf("\n");                                \
+            failureCount++;                              \
+        }                                                \
+    } while (0)
+
+// Same generator as the frame pacing simulator, so the checks are identical on every platform.
+struct TestRandom
+{
+    uint64_t state;
+
+    explicit TestRandom(uint64_t seed)
+        : state(seed)
+    {
+    }
+
+    double uniform()
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return double(state >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // lognormal frame times around meanMs with occasional hitches
+    double frameTime(double meanMs, double hitchChance, double hitchScale)
+    {
+        const double u1     = std::max(uniform(), 1e-12);
+        const double u2     = uniform();
+        const double normal = sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+        double       value  = meanMs * exp(0.1 * normal);
+        if (uniform() < hitchChance)
+        {
+            value *= hitchScale;
+        }
+        return value;
+    }
+};
+
+static bool isClose(double value, double reference, double relativeTolerance)
+{
+    return fabs(value - reference) <= relativeTolerance * std::max(fabs(reference), 1e-9);
+}
+
+template <int Size>
+static void testMovingAverage(const char* name, double hitchChance, double hitchScale, int sampleCount)
+{
+    SimpleMovingAverage<Size> average;
+    std::vector<double>       samples;
+    TestRandom                random(Size * 7919 + sampleCount);
+    double                    maxMeanError      = 0.0;
+    double                    maxDeviationError = 0.0;
+
+    for (int i = 0; i < sampleCount; i++)
+    {
+        const double value = random.frameTime(16.6, hitchChance, hitchScale);
+        average.update(value);
+        samples.push_back(value);
+
+        if (int(samples.size()) < Size)
+        {
+            CHECK(average.getAverage() == 0.0 && average.getVariance() == 0.0, "%s: statistics must be zero until the window is full", name);
+            continue;
+        }
+
+        // two-pass reference over the window
+        double sum = 0.0;
+        for (size_t s = samples.size() - Size; s < samples.size(); s++)
+        {
+            sum += samples[s];
+        }
+        const double mean = sum / Size;
+
+        double squares = 0.0;
+        for (size_t s = samples.size() - Size; s < samples.size(); s++)
+        {
+            squares += (samples[s] - mean) * (samples[s] - mean);
+        }
+        const double deviation = sqrt(squares / Size);
+
+        maxMeanError      = std::max(maxMeanError, fabs(average.getAverage() - mean) / mean);
+        maxDeviationError = std::max(maxDeviationError, fabs(average.getVariance() - deviation) / std::max(deviation, 1e-9));
+    }
+
+    CHECK(maxMeanError < 1e-9, "%s: mean differs from the two-pass reference by %g", name, maxMeanError);
+    CHECK(maxDeviationError < 1e-6, "%s: deviation differs from the two-pass reference by %g", name, maxDeviationError);
+    printf("%-32s max relative error mean %.3g deviation %.3g\n", name, maxMeanError, maxDeviationError);
+
+    average.reset();
+    CHECK(average.getAverage() == 0.0 && average.getVariance() == 0.0, "%s: statistics must be zero after reset", name);
+    for (int i = 0; i < Size; i++)
+    {
+        average.update(5.0);
+    }
+    CHECK(isClose(average.getAverage(), 5.0, 1e-12) && average.getVariance() < 1e-9, "%s: constant input after reset", name);
+}
+
+static double exactQuantile(std::vector<double> samples, double quantile)
+{
+    std::sort(samples.begin(), samples.end());
+    return samples[size_t(quantile * (samples.size() - 1) + 0.5)];
+}
+
+static void testQuantile(const char* name, double quantile, double hitchChance, int sampleCount, double tolerance)
+{
+    P2QuantileEstimator<> estimator(quantile);
+    std::vector<double>   samples;
+    TestRandom            random(sampleCount + int(quantile * 1000));
+
+    for (int i = 0; i < sampleCount; i++)
+    {
+        const double value = random.frameTime(16.6, hitchChance, 5.0);
+        estimator.update(value);
+        samples.push_back(value);
+
+        // fewer samples than markers must give the exact quantile
+        if (samples.size() < 5)
+        {
+            CHECK(estimator.getQuantile() == exactQuantile(samples, quantile), "%s: exact quantile expected for %d samples", name, int(samples.size()));
+        }
+    }
+
+    const double reference = exactQuantile(samples, quantile);
+    const double estimate  = estimator.getQuantile();
+    CHECK(isClose(estimate, reference, tolerance), "%s: estimate %f, exact %f", name, estimate, reference);
+    printf("%-32s estimate %.4f exact %.4f\n", name, estimate, reference);
+}
+
+int main()
+{
+    testMovingAverage<32>("average 32, steady", 0.0, 1.0, 10000);
+    testMovingAverage<32>("average 32, hitches", 0.02, 5.0, 10000);
+    testMovingAverage<64>("average 64, hitches", 0.05, 10.0, 100000);
+    testMovingAverage<7>("average 7, wraps often", 0.1, 3.0, 1000);
+
+    testQuantile("median, steady", 0.5, 0.0, 100000, 0.002);
+    testQuantile("median, hitches", 0.5, 0.02, 100000, 0.002);
+    testQuantile("p90, hitches", 0.9, 0.02, 100000, 0.01);
+    testQuantile("median, 3 samples", 0.5, 0.0, 3, 0.0);
+
+    if (failureCount)
+    {
+        printf("%d check(s) failed\n", failureCount);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,298 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Offline check of the cauldron frame rate limiter wait. The histogram and percentile logic is fed known wake up
+// errors, the overshoot estimate known sleep overshoots, and then the sleep then spin wait is replayed against a
+// simulated scheduler to compare the learned spin tail with fixed ones.
+//
+// Usage: FidelityFX_FPSLimiterSim
+//   Prints the error percentiles and CPU usage of every policy per scheduler model, returns 0 if every check passed.
+
+#include "fpslimiterwaitstats.h"
+
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+using cauldron::FPSLimiterWaitStats;
+
+static const int64_t SimulatedFrequency = 10000000;  // same tick rate as the performance counter on most systems
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char* description)
+{
+    printf("%s: %s\n", condition ? "PASS" : "FAIL", description);
+    failedChecks += condition ? 0 : 1;
+}
+
+static int64_t usToTicks(double us)
+{
+    return int64_t(us * double(SimulatedFrequency) / 1000000.0);
+}
+
+// Small deterministic generator so runs are identical on every platform and standard library.
+struct SimRandom
+{
+    uint64_t state;
+
+    explicit SimRandom(uint64_t seed)
+        : state(seed * 2654435761ull + 1)
+    {
+    }
+
+    // uniform in [0, 1)
+    double next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return double(state >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    double range(double lo, double hi)
+    {
+        return lo + (hi - lo) * next();
+    }
+};
+
+//////////////////////////////////////////////
+/// Histogram and percentiles
+//////////////////////////////////////////////
+
+// The reported percentile is the upper edge of the bucket holding the sample, so it may only be above the exact value
+// by the width of that bucket: 10us in the linear range, at most the value itself beyond it
+static bool isWithinBucket(double reportedUs, double exactUs, double maxUs)
+{
+    const double slack = std::max(double(FPSLimiterWaitStats::s_ERROR_HISTOGRAM_BUCKET_US), exactUs);
+    return reportedUs >= exactUs && reportedUs <= exactUs + slack && reportedUs <= maxUs;
+}
+
+static void testHistogram()
+{
+    bool edgesIncrease = true;
+    for (uint32_t i = 1; i < FPSLimiterWaitStats::s_ERROR_HISTOGRAM_BUCKETS; ++i)
+        edgesIncrease &= FPSLimiterWaitStats::GetErrorBucketUpperEdgeUs(i) > FPSLimiterWaitStats::GetErrorBucketUpperEdgeUs(i - 1);
+    check(edgesIncrease, "bucket edges increase");
+    check(FPSLimiterWaitStats::GetErrorBucketUpperEdgeUs(FPSLimiterWaitStats::s_ERROR_HISTOGRAM_LINEAR_BUCKETS - 1) ==
+              FPSLimiterWaitStats::s_ERROR_HISTOGRAM_LINEAR_BUCKETS * FPSLimiterWaitStats::s_ERROR_HISTOGRAM_BUCKET_US,
+          "linear buckets end at 160 us");
+
+    FPSLimiterWaitStats empty(SimulatedFrequency);
+    check(empty.GetErrorPercentileUs(0.99) == 0.0 && empty.GetSpinRatio() == 0.0, "no waits report no error and no spinning");
+
+    // errors spread over the linear buckets, the doubling ones and past the last edge
+    SimRandom           random(30);
+    FPSLimiterWaitStats stats(SimulatedFrequency);
+    std::vector<double> errorsUs;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const double roll    = random.next();
+        const double errorUs = double(int64_t(roll < 0.7 ? random.range(0.0, 160.0) : roll < 0.999 ? random.range(160.0, 20000.0) : random.range(6e6, 8e6)));
+        stats.AddWait(usToTicks(1000.0), usToTicks(100.0), usToTicks(errorUs));
+        errorsUs.push_back(errorUs);
+    }
+    std::sort(errorsUs.begin(), errorsUs.end());
+
+    check(stats.GetErrorCount() == errorsUs.size(), "every wait is counted");
+    uint64_t histogramTotal = 0;
+    for (uint32_t i = 0; i < FPSLimiterWaitStats::s_ERROR_HISTOGRAM_BUCKETS; ++i)
+        histogramTotal += stats.GetErrorHistogram()[i];
+    check(histogramTotal == errorsUs.size(), "every wait lands in a bucket");
+    check(stats.GetErrorHistogram()[FPSLimiterWaitStats::s_ERROR_HISTOGRAM_BUCKETS - 1] > 0, "errors past the last edge go to the last bucket");
+
+    bool withinBucket = true;
+    for (double fraction : {0.0, 0.1, 0.5, 0.7, 0.9, 0.99, 0.995})
+    {
+        const size_t rank  = std::max<size_t>(size_t(fraction * double(errorsUs.size()) + 0.999999), 1);
+        const double exact = errorsUs[rank - 1];
+        const double reported = stats.GetErrorPercentileUs(fraction);
+        printf("  p%g: exact %.0f us, reported %.0f us\n", fraction * 100.0, exact, reported);
+        withinBucket &= isWithinBucket(reported, exact, errorsUs.back());
+    }
+    check(withinBucket, "percentiles are the upper edge of the bucket holding the exact value");
+    check(stats.GetErrorPercentileUs(1.0) == errorsUs.back(), "100th percentile is the exact maximum");
+    check(fabs(stats.GetSpinRatio() - 0.1) < 1e-9, "spin ratio is the spun share of the waited time");
+
+    // a late wait never reports a negative error
+    FPSLimiterWaitStats early(SimulatedFrequency);
+    early.AddWait(usToTicks(100.0), 0, -usToTicks(50.0));
+    check(early.GetErrorHistogram()[0] == 1 && early.GetErrorPercentileUs(1.0) == 0.0, "early wake ups count as no error");
+
+    const double marginBefore = stats.GetSleepMarginUs();
+    stats.ResetStats();
+    check(stats.GetErrorCount() == 0 && stats.GetErrorPercentileUs(0.5) == 0.0 && stats.GetSpinRatio() == 0.0, "reset clears the histogram");
+    check(stats.GetSleepMarginUs() == marginBefore, "reset keeps the overshoot estimate");
+}
+
+//////////////////////////////////////////////
+/// Overshoot estimate
+//////////////////////////////////////////////
+
+static void testOvershootEstimate()
+{
+    FPSLimiterWaitStats stats(SimulatedFrequency);
+    check(stats.GetSleepMarginUs() == 1000.0, "margin starts at 1 ms before anything was measured");
+
+    for (int i = 0; i < 1000; ++i)
+        stats.AddOvershootSample(usToTicks(300.0));
+    check(fabs(stats.GetSleepMarginUs() - 300.0) < 1.0, "constant overshoot converges to a margin of that overshoot");
+
+    // one outlier widens the margin but doesn't double it
+    stats.AddOvershootSample(usToTicks(2000.0));
+    const double afterOutlier = stats.GetSleepMarginUs();
+    check(afterOutlier > 300.0 && afterOutlier < 2000.0, "single outlier widens the margin by less than itself");
+
+    for (int i = 0; i < 1000; ++i)
+        stats.AddOvershootSample(-usToTicks(100.0));
+    check(stats.GetSleepMarginUs() == 50.0, "early wake ups clamp the margin to 50 us");
+
+    for (int i = 0; i < 1000; ++i)
+        stats.AddOvershootSample(usToTicks(20000.0));
+    check(stats.GetSleepMarginUs() == 4000.0, "huge overshoots clamp the margin to 4 ms");
+
+    // jittery overshoot: mean plus three deviations covers nearly every sample
+    FPSLimiterWaitStats jittery(SimulatedFrequency);
+    SimRandom           random(7);
+    int                 covered = 0;
+    for (int i = 0; i < 10000; ++i)
+    {
+        const double overshootUs = random.range(100.0, 500.0);
+        covered += (i >= 1000 && overshootUs <= jittery.GetSleepMarginUs()) ? 1 : 0;
+        jittery.AddOvershootSample(usToTicks(overshootUs));
+    }
+    printf("  uniform 100-500 us overshoot: margin %.0f us, covers %.1f%% of the sleeps\n", jittery.GetSleepMarginUs(), covered / 90.0);
+    check(covered >= 9000 * 99 / 100, "margin covers at least 99% of uniformly distributed overshoots");
+}
+
+//////////////////////////////////////////////
+/// Simulated scheduler
+//////////////////////////////////////////////
+
+// How late a sleep returns: a base overshoot range with occasional hiccups, which change halfway through the run
+struct SchedulerModel
+{
+    std::string name;
+    double      minOvershootUs;
+    double      maxOvershootUs;
+    double      hiccupChance;
+    double      hiccupUs;
+    double      loadedMinOvershootUs;
+    double      loadedMaxOvershootUs;
+    double      loadedHiccupChance;
+    double      loadedHiccupUs;
+};
+
+struct WaitResults
+{
+    double p50Us;
+    double p99Us;
+    double maxUs;
+    double spinPercent;
+};
+
+// Replays FPSLimiterWaiter::WaitUntil: sleep until the margin before the target, spin the rest. A negative fixed
+// margin uses the learned one
+static WaitResults simulateWaits(const SchedulerModel& model, double fixedMarginUs)
+{
+    static const int    NumFrames   = 20000;
+    static const double FrameUs     = 1000000.0 / 60.0;
+    SimRandom           random(1);
+    FPSLimiterWaitStats stats(SimulatedFrequency);
+    int64_t             now = 0;
+
+    for (int frame = 0; frame < NumFrames; ++frame)
+    {
+        // 4-10 ms of work before the wait
+        now += usToTicks(random.range(4000.0, 10000.0));
+        const int64_t target = usToTicks(FrameUs * (frame + 1));
+
+        const int64_t waitStart = now;
+        if (now >= target)
+            continue;
+
+        const double  marginUs   = fixedMarginUs >= 0.0 ? fixedMarginUs : stats.GetSleepMarginUs();
+        const int64_t sleepTicks = target - now - usToTicks(marginUs);
+        if (sleepTicks > 0)
+        {
+            const bool   loaded      = frame >= NumFrames / 2;
+            double       overshootUs = loaded ? random.range(model.loadedMinOvershootUs, model.loadedMaxOvershootUs)
+                                              : random.range(model.minOvershootUs, model.maxOvershootUs);
+            if (random.next() < (loaded ? model.loadedHiccupChance : model.hiccupChance))
+                overshootUs += loaded ? model.loadedHiccupUs : model.hiccupUs;
+
+            const int64_t woken = now + sleepTicks + usToTicks(overshootUs);
+            stats.AddOvershootSample(woken - now - sleepTicks);
+            now = woken;
+        }
+
+        // spinning ends right on the target
+        const int64_t spinStart = now;
+        now                     = std::max(now, target);
+        stats.AddWait(now - waitStart, now - spinStart, now - target);
+    }
+
+    return {stats.GetErrorPercentileUs(0.5), stats.GetErrorPercentileUs(0.99), stats.GetErrorPercentileUs(1.0), stats.GetSpinRatio() * 100.0};
+}
+
+static void testSimulatedScheduler()
+{
+    const SchedulerModel models[] = {
+        {"high resolution timer", 20.0, 150.0, 0.005, 1500.0, 20.0, 150.0, 0.005, 1500.0},
+        {"timer under load", 50.0, 300.0, 0.01, 2000.0, 300.0, 1200.0, 0.03, 3000.0},
+        {"coarse timer", 500.0, 2000.0, 0.0, 0.0, 500.0, 2000.0, 0.0, 0.0},
+    };
+    const double fixedMarginsUs[] = {0.0, 1000.0, 4000.0};
+
+    for (const SchedulerModel& model : models)
+    {
+        printf("%s\n", model.name.c_str());
+        const WaitResults learned = simulateWaits(model, -1.0);
+        printf("  %-16s p50 %6.0f us, p99 %6.0f us, max %6.0f us, spinning %5.1f%% of the wait\n", "learned margin", learned.p50Us, learned.p99Us, learned.maxUs, learned.spinPercent);
+
+        WaitResults fixed[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            fixed[i] = simulateWaits(model, fixedMarginsUs[i]);
+            char name[32];
+            snprintf(name, sizeof(name), "fixed %.0f us", fixedMarginsUs[i]);
+            printf("  %-16s p50 %6.0f us, p99 %6.0f us, max %6.0f us, spinning %5.1f%% of the wait\n", name, fixed[i].p50Us, fixed[i].p99Us, fixed[i].maxUs, fixed[i].spinPercent);
+        }
+
+        std::string description = model.name + ": learned margin has a lower p99 error than sleeping all the way";
+        check(learned.p99Us < fixed[0].p99Us, description.c_str());
+        description = model.name + ": learned margin spins less than the largest fixed margin";
+        check(learned.spinPercent < fixed[2].spinPercent, description.c_str());
+    }
+}
+
+int main(int, char**)
+{
+    testHistogram();
+    testOvershootEstimate();
+    testSimulatedScheduler();
+
+    printf("%d check(s) failed\n", failedChecks);
+    return failedChecks == 0 ? 0 : 1;
+}
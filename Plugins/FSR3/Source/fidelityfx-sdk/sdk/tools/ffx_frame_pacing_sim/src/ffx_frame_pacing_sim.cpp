@@ -0,0 +1,295 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Offline replay of the frame interpolation swapchain pacing. Frame time traces (synthetic or recorded) drive the
+// pacing policy through a simulated clock, and the resulting presents are scanned out by a VRR display model.
+//
+// Usage: FidelityFX_FramePacingSim [trace.txt ...]
+//   Without arguments a set of synthetic scenarios is replayed. Trace files contain one frame time in milliseconds per
+//   line, lines starting with # are ignored.
+
+#include <ffx_frame_pacing.h>
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+
+static const int64_t SimulatedFrequency = 10000000;  // same tick rate as the performance counter on most systems
+
+class SimulatedClock : public FramePacingClock
+{
+public:
+    int64_t time = 0;
+
+    int64_t now() override
+    {
+        return time;
+    }
+
+    int64_t frequency() override
+    {
+        return SimulatedFrequency;
+    }
+};
+
+// Small deterministic generator so traces are identical on every platform and standard library.
+struct TraceRandom
+{
+    uint64_t state;
+
+    explicit TraceRandom(uint64_t seed)
+        : state(seed * 2654435761ull + 1)
+    {
+    }
+
+    // uniform in [0, 1)
+    double next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return double(state >> 11) * (1.0 / 9007199254740992.0);
+    }
+};
+
+struct Display
+{
+    double minRefreshHz;
+    double maxRefreshHz;
+};
+
+struct Scenario
+{
+    std::string         name;
+    std::vector<double> frameTimesMs;
+    Display             display;
+};
+
+struct Tuning
+{
+    double safetyMarginInMs;
+    double varianceFactor;
+};
+
+struct Results
+{
+    double intervalStdDevMs;   // standard deviation of the scan out intervals
+    double judderMs;           // mean change between consecutive scan out intervals
+    double addedLatencyMs;     // mean time from interpolation completing to the real frame being scanned out
+    double repeatPercent;      // intervals above the VRR window, where the display repeats a frame
+    double droppedPercent;     // frame pairs replaced by a newer one before the pacer picked them up
+};
+
+static int64_t msToTicks(double ms)
+{
+    return int64_t(ms * 0.001 * SimulatedFrequency);
+}
+
+static double ticksToMs(double ticks)
+{
+    return ticks * 1000.0 / SimulatedFrequency;
+}
+
+static Results simulate(const Scenario& scenario, const Tuning& tuning)
+{
+    SimulatedClock    clock;
+    FramePacingPolicy policy(clock);
+
+    const double minScanoutInterval = msToTicks(1000.0 / scenario.display.maxRefreshHz);
+    const double maxScanoutInterval = msToTicks(1000.0 / scenario.display.minRefreshHz);
+
+    std::vector<int64_t> arrivals;
+    int64_t              arrival = msToTicks(100.0);
+    for (double frameTimeMs : scenario.frameTimesMs)
+    {
+        arrival += msToTicks(frameTimeMs);
+        arrivals.push_back(arrival);
+    }
+
+    std::vector<double> intervals;
+    double              latencySum      = 0.0;
+    size_t              presentedPairs  = 0;
+    double              previousPresent = 0.0;
+    double              previousScanout = -1.0;
+
+    auto scanout = [&](double presentTime) {
+        const double scanoutTime = (previousScanout < 0.0) ? presentTime : std::max(presentTime, previousScanout + minScanoutInterval);
+        if (previousScanout >= 0.0)
+        {
+            intervals.push_back(scanoutTime - previousScanout);
+        }
+        previousScanout = scanoutTime;
+        return scanoutTime;
+    };
+
+    for (size_t frame = 0; frame < arrivals.size(); ++frame)
+    {
+        // the interpolated frame of this pair is done once the real frame arrived
+        const double arrivalTime = double(arrivals[frame]);
+        clock.time               = arrivals[frame];
+
+        const double delta = double(policy.update(false, tuning.safetyMarginInMs * 0.001, tuning.varianceFactor));
+
+        // like scheduledPresents, a pair the pacer hasn't picked up yet gets replaced by the next one
+        const double pickupTime = std::max(arrivalTime, previousPresent);
+        if (frame + 1 < arrivals.size() && double(arrivals[frame + 1]) <= pickupTime)
+            continue;
+
+        // the pacer presents the interpolated frame, then the real one, each at least delta after the previous present
+        // presents block until the display can take the next flip, so scan out time is when the pacer continues
+        const double interpolatedScanout = scanout(std::max(arrivalTime, previousPresent + delta));
+        const double realScanout         = scanout(interpolatedScanout + delta);
+        previousPresent                  = realScanout;
+
+        latencySum += realScanout - arrivalTime;
+        ++presentedPairs;
+    }
+
+    Results results = {};
+    if (intervals.size() < 2)
+        return results;
+
+    double mean = 0.0;
+    for (double interval : intervals)
+        mean += interval;
+    mean /= intervals.size();
+
+    double variance = 0.0;
+    double judder   = 0.0;
+    size_t repeats  = 0;
+    for (size_t i = 0; i < intervals.size(); ++i)
+    {
+        variance += (intervals[i] - mean) * (intervals[i] - mean);
+        if (i > 0)
+            judder += fabs(intervals[i] - intervals[i - 1]);
+        if (intervals[i] > maxScanoutInterval)
+            ++repeats;
+    }
+
+    results.intervalStdDevMs = ticksToMs(sqrt(variance / intervals.size()));
+    results.judderMs         = ticksToMs(judder / (intervals.size() - 1));
+    results.addedLatencyMs   = ticksToMs(latencySum / presentedPairs);
+    results.repeatPercent    = 100.0 * repeats / intervals.size();
+    results.droppedPercent   = 100.0 * (arrivals.size() - presentedPairs) / arrivals.size();
+    return results;
+}
+
+static std::vector<double> generateTrace(double baseMs, double jitter, uint32_t hitchPeriod, double hitchScale, double rampToMs, uint64_t seed)
+{
+    const uint32_t      frameCount = 3000;
+    TraceRandom         random(seed);
+    std::vector<double> frameTimes;
+    frameTimes.reserve(frameCount);
+
+    for (uint32_t i = 0; i < frameCount; ++i)
+    {
+        const double target = (rampToMs > 0.0) ? baseMs + (rampToMs - baseMs) * i / (frameCount - 1) : baseMs;
+        double       frameTime = target * (1.0 + jitter * (2.0 * random.next() - 1.0));
+        if (hitchPeriod && (i % hitchPeriod) == hitchPeriod - 1)
+            frameTime *= hitchScale;
+        frameTimes.push_back(frameTime);
+    }
+
+    return frameTimes;
+}
+
+static bool loadTrace(const char* path, std::vector<double>& outFrameTimes)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        const double frameTime = atof(line.c_str());
+        if (frameTime > 0.0)
+            outFrameTimes.push_back(frameTime);
+    }
+
+    return !outFrameTimes.empty();
+}
+
+int main(int argc, char** argv)
+{
+    const Display vrr     = { 48.0, 144.0 };
+    const Display vrrWide = { 30.0, 240.0 };
+
+    std::vector<Scenario> scenarios;
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            Scenario scenario = { argv[i], {}, vrr };
+            if (!loadTrace(argv[i], scenario.frameTimesMs))
+            {
+                fprintf(stderr, "Failed to read frame times from %s\n", argv[i]);
+                return 1;
+            }
+            scenarios.push_back(scenario);
+        }
+    }
+    else
+    {
+        scenarios.push_back({ "steady 60 fps",                  generateTrace(16.667, 0.00, 0,  1.0, 0.0,    1), vrr });
+        scenarios.push_back({ "60 fps, 10% jitter",             generateTrace(16.667, 0.10, 0,  1.0, 0.0,    2), vrr });
+        scenarios.push_back({ "60 fps, 30% jitter",             generateTrace(16.667, 0.30, 0,  1.0, 0.0,    3), vrr });
+        scenarios.push_back({ "60 fps, 3x hitch every 90",      generateTrace(16.667, 0.05, 90, 3.0, 0.0,    4), vrr });
+        scenarios.push_back({ "ramp 40 -> 90 fps",              generateTrace(25.0,   0.05, 0,  1.0, 11.111, 5), vrr });
+        scenarios.push_back({ "30 fps, below 48 Hz VRR floor",  generateTrace(33.333, 0.05, 0,  1.0, 0.0,    6), vrr });
+        scenarios.push_back({ "30 fps, 30-240 Hz VRR",          generateTrace(33.333, 0.05, 0,  1.0, 0.0,    6), vrrWide });
+        scenarios.push_back({ "100 fps, above 144 Hz VRR cap",  generateTrace(10.0,   0.05, 0,  1.0, 0.0,    7), vrr });
+    }
+
+    const Tuning tunings[] = {
+        { 0.1, 0.0 }, { 0.1, 0.1 }, { 0.1, 0.3 },
+        { 0.5, 0.1 }, { 1.0, 0.1 }, { 1.0, 0.3 },
+    };
+
+    for (const Scenario& scenario : scenarios)
+    {
+        printf("%s (%zu frames, VRR %.0f-%.0f Hz)\n", scenario.name.c_str(), scenario.frameTimesMs.size(), scenario.display.minRefreshHz, scenario.display.maxRefreshHz);
+        printf("  margin ms  variance  | interval sd ms  judder ms  latency ms  repeats %%  dropped %%\n");
+
+        for (const Tuning& tuning : tunings)
+        {
+            const Results results = simulate(scenario, tuning);
+            printf("  %9.2f  %8.2f  | %14.3f  %9.3f  %10.3f  %9.2f  %9.2f%s\n",
+                   tuning.safetyMarginInMs,
+                   tuning.varianceFactor,
+                   results.intervalStdDevMs,
+                   results.judderMs,
+                   results.addedLatencyMs,
+                   results.repeatPercent,
+                   results.droppedPercent,
+                   (tuning.safetyMarginInMs == 0.1 && tuning.varianceFactor == 0.1) ? "  (default)" : "");
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
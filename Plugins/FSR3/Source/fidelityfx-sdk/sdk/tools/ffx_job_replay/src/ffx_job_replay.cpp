@@ -0,0 +1,318 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Offline replay of job lists recorded by the UE RHI backend (r.FidelityFX.FSR3.RecordRHIJobLists). The jobs are
+// walked the way FlushRenderJobs_UE executes them to report the work a frame submits, and two recordings can be
+// compared to catch regressions in the job stream without launching the engine.
+//
+// Usage: FidelityFX_JobReplay recording.ffxjobs [...]
+//        FidelityFX_JobReplay --compare baseline.ffxjobs candidate.ffxjobs [--constants]
+//   The compare mode returns 1 when the job sequences differ in type, pipeline, dispatch size, bindings or bound
+//   resource descriptions. Constant buffer contents change every frame (jitter, time) so are only compared with
+//   --constants.
+
+#include <ffx_job_recording.h>
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+// Matches FFX_MAX_CLEAR_BATCH_COUNT in the RHI backend, consecutive clears are recorded as one pass per batch.
+static const uint32_t ClearBatchCount = 16;
+
+struct Recording
+{
+    std::string                          path;
+    std::vector<uint8_t>                 data;
+    FfxJobRecordingHeader                header = {};
+    std::map<int32_t, FfxJobRecordingResource> resources;
+    std::vector<FfxJobRecordingJobView>  jobs;
+};
+
+static bool loadRecording(const char* path, Recording& recording)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    recording.path = path;
+    recording.data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    FfxJobRecordingReader reader;
+    if (!reader.open(recording.data.data(), recording.data.size()))
+    {
+        fprintf(stderr, "%s: not a version %u job recording\n", path, FFX_JOB_RECORDING_VERSION);
+        return false;
+    }
+    recording.header = reader.header();
+    for (uint32_t i = 0; i < recording.header.resourceCount; ++i)
+    {
+        FfxJobRecordingResource resource = reader.resource(i);
+        recording.resources[resource.internalIndex] = resource;
+    }
+
+    FfxJobRecordingJobView job;
+    while (reader.next(job))
+        recording.jobs.push_back(job);
+    if (reader.failed())
+    {
+        fprintf(stderr, "%s: truncated or corrupt after %zu of %u jobs\n", path, recording.jobs.size(), recording.header.jobCount);
+        return false;
+    }
+    return true;
+}
+
+static uint32_t bitsPerPixel(uint32_t format)
+{
+    switch (format)
+    {
+    case FFX_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_UINT:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        return 128;
+    case FFX_SURFACE_FORMAT_R32G32B32_FLOAT:
+        return 96;
+    case FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16G16B16A16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32_FLOAT:
+    case FFX_SURFACE_FORMAT_R32G32_TYPELESS:
+        return 64;
+    case FFX_SURFACE_FORMAT_R8_UINT:
+    case FFX_SURFACE_FORMAT_R8_UNORM:
+    case FFX_SURFACE_FORMAT_R8_TYPELESS:
+        return 8;
+    case FFX_SURFACE_FORMAT_R16G16_SINT:
+        return 64;  // widened to R16G16B16A16 by the RHI backend
+    case FFX_SURFACE_FORMAT_R16_SNORM:
+        return 64;  // widened to R16G16B16A16 by the RHI backend
+    case FFX_SURFACE_FORMAT_R16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16_UINT:
+    case FFX_SURFACE_FORMAT_R16_UNORM:
+    case FFX_SURFACE_FORMAT_R16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8_UNORM:
+    case FFX_SURFACE_FORMAT_R8G8_UINT:
+    case FFX_SURFACE_FORMAT_R8G8_TYPELESS:
+        return 16;
+    default:
+        return 32;
+    }
+}
+
+// Size of the bound subresource, buffers use the bound range when there is one.
+static uint64_t boundBytes(const Recording& recording, const FfxJobRecordingBinding& binding, bool buffer)
+{
+    auto it = recording.resources.find(binding.internalIndex);
+    if (it == recording.resources.end())
+        return 0;
+
+    const FfxJobRecordingResource& resource = it->second;
+    if (buffer || resource.type == FFX_RESOURCE_TYPE_BUFFER)
+        return binding.size ? binding.size : resource.width;
+
+    const uint64_t width  = std::max(1u, resource.width >> binding.mip);
+    const uint64_t height = std::max(1u, resource.height >> binding.mip);
+    const uint64_t depth  = resource.type == FFX_RESOURCE_TYPE_TEXTURE3D ? std::max(1u, resource.depth >> binding.mip) : 1;
+    return width * height * depth * bitsPerPixel(resource.format) / 8;
+}
+
+struct PipelineStats
+{
+    uint32_t dispatches = 0;
+    uint64_t threadGroups = 0;
+    uint64_t readBytes = 0;
+    uint64_t writeBytes = 0;
+};
+
+static void summarize(const Recording& recording)
+{
+    uint32_t typeCounts[5] = {};
+    uint32_t passes = 0;
+    uint32_t pendingClears = 0;
+    uint64_t constantBytes = 0;
+    std::map<std::string, PipelineStats> pipelines;
+
+    for (const FfxJobRecordingJobView& view : recording.jobs)
+    {
+        const FfxJobRecordingJob& job = view.job;
+        if (job.jobType < 5)
+            typeCounts[job.jobType]++;
+
+        if (job.jobType == FFX_GPU_JOB_CLEAR_FLOAT)
+        {
+            // The clear batch takes one UAV per mip of the target.
+            auto it = recording.resources.find(job.resources[0]);
+            pendingClears += (it != recording.resources.end() && it->second.type != FFX_RESOURCE_TYPE_BUFFER) ? std::max(1u, it->second.mipCount) : 1;
+            continue;
+        }
+        if (job.jobType == FFX_GPU_JOB_BARRIER)
+            continue;
+
+        passes += (pendingClears + ClearBatchCount - 1) / ClearBatchCount;
+        pendingClears = 0;
+        passes++;
+
+        if (job.jobType == FFX_GPU_JOB_COMPUTE)
+        {
+            PipelineStats& stats = pipelines[job.pipelineName];
+            stats.dispatches++;
+            stats.threadGroups += (uint64_t)job.dimensions[0] * job.dimensions[1] * job.dimensions[2];
+            for (uint32_t i = 0; i < job.srvTextureCount; ++i)
+                stats.readBytes += boundBytes(recording, view.srvTextures[i], false);
+            for (uint32_t i = 0; i < job.srvBufferCount; ++i)
+                stats.readBytes += boundBytes(recording, view.srvBuffers[i], true);
+            for (uint32_t i = 0; i < job.uavTextureCount; ++i)
+                stats.writeBytes += boundBytes(recording, view.uavTextures[i], false);
+            for (uint32_t i = 0; i < job.uavBufferCount; ++i)
+                stats.writeBytes += boundBytes(recording, view.uavBuffers[i], true);
+            constantBytes += job.constantWordCount * sizeof(uint32_t);
+        }
+    }
+    passes += (pendingClears + ClearBatchCount - 1) / ClearBatchCount;
+
+    printf("%s: frame %llu, %u resources, %u jobs (%u clear, %u copy, %u compute, %u barrier, %u discard)\n",
+           recording.path.c_str(), (unsigned long long)recording.header.frameIndex, recording.header.resourceCount, recording.header.jobCount,
+           typeCounts[FFX_GPU_JOB_CLEAR_FLOAT], typeCounts[FFX_GPU_JOB_COPY], typeCounts[FFX_GPU_JOB_COMPUTE], typeCounts[FFX_GPU_JOB_BARRIER], typeCounts[FFX_GPU_JOB_DISCARD]);
+    printf("  %u RDG passes, %llu bytes of constants\n", passes, (unsigned long long)constantBytes);
+    printf("  %-48s %10s %14s %12s %12s\n", "pipeline", "dispatches", "thread groups", "bound SRV MB", "bound UAV MB");
+    for (const auto& it : pipelines)
+    {
+        printf("  %-48s %10u %14llu %12.2f %12.2f\n", it.first.c_str(), it.second.dispatches, (unsigned long long)it.second.threadGroups,
+               it.second.readBytes / (1024.0 * 1024.0), it.second.writeBytes / (1024.0 * 1024.0));
+    }
+}
+
+static bool sameResource(const Recording& a, int32_t indexA, const Recording& b, int32_t indexB)
+{
+    auto itA = a.resources.find(indexA);
+    auto itB = b.resources.find(indexB);
+    if (itA == a.resources.end() || itB == b.resources.end())
+        return (itA == a.resources.end()) == (itB == b.resources.end());
+
+    // Internal indices depend on allocation order, so resources are compared by description.
+    FfxJobRecordingResource resA = itA->second;
+    FfxJobRecordingResource resB = itB->second;
+    resA.internalIndex = resB.internalIndex = 0;
+    return memcmp(&resA, &resB, sizeof(resA)) == 0;
+}
+
+static bool sameBindings(const Recording& a, const FfxJobRecordingBinding* bindingsA, const Recording& b, const FfxJobRecordingBinding* bindingsB, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const FfxJobRecordingBinding& bindingA = bindingsA[i];
+        const FfxJobRecordingBinding& bindingB = bindingsB[i];
+        if (bindingA.resourceIdentifier != bindingB.resourceIdentifier || bindingA.mip != bindingB.mip || bindingA.offset != bindingB.offset ||
+            bindingA.size != bindingB.size || bindingA.stride != bindingB.stride || !sameResource(a, bindingA.internalIndex, b, bindingB.internalIndex))
+            return false;
+    }
+    return true;
+}
+
+static const char* describeMismatch(const Recording& a, const FfxJobRecordingJobView& viewA, const Recording& b, const FfxJobRecordingJobView& viewB, bool compareConstants)
+{
+    const FfxJobRecordingJob& jobA = viewA.job;
+    const FfxJobRecordingJob& jobB = viewB.job;
+    if (jobA.jobType != jobB.jobType)
+        return "job type";
+    if (strcmp(jobA.pipelineName, jobB.pipelineName) != 0 || jobA.passId != jobB.passId)
+        return "pipeline";
+    if (memcmp(jobA.dimensions, jobB.dimensions, sizeof(jobA.dimensions)) != 0)
+        return "dispatch dimensions";
+    if (jobA.jobType == FFX_GPU_JOB_CLEAR_FLOAT && memcmp(jobA.clearColor, jobB.clearColor, sizeof(jobA.clearColor)) != 0)
+        return "clear value";
+    if (jobA.jobType == FFX_GPU_JOB_COPY && (memcmp(jobA.offsets, jobB.offsets, sizeof(jobA.offsets)) != 0 || jobA.copySize != jobB.copySize))
+        return "copy range";
+    for (int i = 0; i < 2; ++i)
+    {
+        if (!sameResource(a, jobA.resources[i], b, jobB.resources[i]))
+            return "target resource";
+    }
+    if (jobA.srvTextureCount != jobB.srvTextureCount || jobA.uavTextureCount != jobB.uavTextureCount || jobA.srvBufferCount != jobB.srvBufferCount ||
+        jobA.uavBufferCount != jobB.uavBufferCount || jobA.constCount != jobB.constCount)
+        return "binding counts";
+    if (!sameBindings(a, viewA.srvTextures, b, viewB.srvTextures, jobA.srvTextureCount) ||
+        !sameBindings(a, viewA.uavTextures, b, viewB.uavTextures, jobA.uavTextureCount) ||
+        !sameBindings(a, viewA.srvBuffers, b, viewB.srvBuffers, jobA.srvBufferCount) ||
+        !sameBindings(a, viewA.uavBuffers, b, viewB.uavBuffers, jobA.uavBufferCount))
+        return "bindings";
+    if (compareConstants && (jobA.constantWordCount != jobB.constantWordCount || memcmp(viewA.constants, viewB.constants, jobA.constantWordCount * sizeof(uint32_t)) != 0))
+        return "constants";
+    return nullptr;
+}
+
+static int compare(const Recording& baseline, const Recording& candidate, bool compareConstants)
+{
+    int mismatches = 0;
+    const size_t count = std::min(baseline.jobs.size(), candidate.jobs.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char* mismatch = describeMismatch(baseline, baseline.jobs[i], candidate, candidate.jobs[i], compareConstants);
+        if (mismatch)
+        {
+            printf("job %zu (%s / %s): %s differs\n", i, baseline.jobs[i].job.label, candidate.jobs[i].job.label, mismatch);
+            mismatches++;
+        }
+    }
+    if (baseline.jobs.size() != candidate.jobs.size())
+    {
+        printf("job count differs: %zu / %zu\n", baseline.jobs.size(), candidate.jobs.size());
+        mismatches++;
+    }
+
+    printf("%s\n", mismatches ? "FAILED" : "OK");
+    return mismatches ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 4 && strcmp(argv[1], "--compare") == 0)
+    {
+        Recording baseline, candidate;
+        if (!loadRecording(argv[2], baseline) || !loadRecording(argv[3], candidate))
+            return 2;
+        const bool compareConstants = argc >= 5 && strcmp(argv[4], "--constants") == 0;
+        return compare(baseline, candidate, compareConstants);
+    }
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s recording.ffxjobs [...]\n       %s --compare baseline.ffxjobs candidate.ffxjobs [--constants]\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    int result = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        Recording recording;
+        if (loadRecording(argv[i], recording))
+            summarize(recording);
+        else
+            result = 2;
+    }
+    return result;
+}
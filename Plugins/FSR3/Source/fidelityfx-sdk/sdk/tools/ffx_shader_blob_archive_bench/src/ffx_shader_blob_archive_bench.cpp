@@ -0,0 +1,356 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Measures what FFX_SHADER_BLOB_ARCHIVE buys on a set of shader binaries: how much smaller the embedded blobs get,
+// how long the first use of each blob waits for its decompression, and how much memory the decompressed blobs take
+// compared to keeping all of them resident.
+//
+// Usage: FidelityFX_ShaderBlobArchiveBench [-budget <MB>] [-scan] <file or directory> [...]
+//   Headers generated by FidelityFX-SC (or any header of g_ byte or uint32_t arrays) contribute one blob per array,
+//   .dxil, .cso, .spv and .bin files are one blob each, directories are searched for both. With -scan, DXBC containers
+//   embedded in any file (e.g. DLLs) are extracted instead. The budget defaults to the one of the backend cache, 8 MB.
+
+#include <ffx_shader_blob_archive.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <list>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+// Matches the default FFX_SHADER_BLOB_CACHE_BUDGET of the backends
+static const size_t DefaultCacheBudget = 8 * 1024 * 1024;
+
+struct Blob
+{
+    std::string          name;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> archived;
+};
+
+static bool readFile(const std::filesystem::path& path, std::vector<uint8_t>& outData)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    outData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Every "g_name[] = { 0x.., ... };" initializer of a header, elements are stored little endian with the size of the
+// declared type, so both FidelityFX-SC output (unsigned char) and SPIR-V headers (uint32_t) are read as-is
+static void parseHeader(const std::string& path, const std::string& text, std::vector<Blob>& outBlobs)
+{
+    size_t position = 0;
+    while ((position = text.find("[] = {", position)) != std::string::npos)
+    {
+        const size_t lineStart = text.rfind('\n', position) + 1;
+        const std::string declaration = text.substr(lineStart, position - lineStart);
+        const size_t end = text.find("};", position);
+        if (end == std::string::npos)
+            break;
+
+        const std::string name = declaration.substr(declaration.find_last_of(' ') + 1);
+        if (name.compare(0, 2, "g_") != 0)
+        {
+            position = end;
+            continue;
+        }
+
+        const size_t elementSize = declaration.find("uint32_t") != std::string::npos ? 4 : (declaration.find("uint16_t") != std::string::npos ? 2 : 1);
+
+        Blob blob;
+        blob.name = path + ":" + name;
+        for (size_t element = text.find("0x", position); element != std::string::npos && element < end; element = text.find("0x", element + 2))
+        {
+            const unsigned long value = strtoul(text.c_str() + element, nullptr, 16);
+            for (size_t byte = 0; byte < elementSize; ++byte)
+                blob.data.push_back(uint8_t(value >> (8 * byte)));
+        }
+        if (!blob.data.empty())
+            outBlobs.push_back(std::move(blob));
+        position = end;
+    }
+}
+
+// DXBC containers start with "DXBC", a 16 byte digest, a version and the size of the whole container
+static void scanContainers(const std::string& path, const std::vector<uint8_t>& data, std::vector<Blob>& outBlobs)
+{
+    static const size_t HeaderSize = 32;
+    for (size_t position = 0; position + HeaderSize <= data.size(); ++position)
+    {
+        if (memcmp(&data[position], "DXBC", 4) != 0)
+            continue;
+
+        uint32_t version, size;
+        memcpy(&version, &data[position + 20], sizeof(version));
+        memcpy(&size, &data[position + 24], sizeof(size));
+        if (version != 1 || size < HeaderSize || size > data.size() - position)
+            continue;
+
+        Blob blob;
+        blob.name = path + "@" + std::to_string(position);
+        blob.data.assign(data.begin() + position, data.begin() + position + size);
+        outBlobs.push_back(std::move(blob));
+        position += size - 1;
+    }
+}
+
+static bool isShaderFile(const std::filesystem::path& path)
+{
+    const std::filesystem::path extension = path.extension();
+    return extension == ".h" || extension == ".dxil" || extension == ".cso" || extension == ".spv" || extension == ".bin";
+}
+
+static void loadBlobs(const std::filesystem::path& path, bool scan, std::vector<Blob>& outBlobs)
+{
+    if (std::filesystem::is_directory(path))
+    {
+        std::vector<std::filesystem::path> children;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path))
+            if (entry.is_regular_file() && (scan || isShaderFile(entry.path())))
+                children.push_back(entry.path());
+        std::sort(children.begin(), children.end());
+        for (const auto& child : children)
+            loadBlobs(child, scan, outBlobs);
+        return;
+    }
+
+    std::vector<uint8_t> data;
+    if (!readFile(path, data))
+    {
+        fprintf(stderr, "%s: cannot open\n", path.string().c_str());
+        return;
+    }
+
+    if (scan)
+        scanContainers(path.string(), data, outBlobs);
+    else if (path.extension() == ".h")
+        parseHeader(path.string(), std::string(data.begin(), data.end()), outBlobs);
+    else
+        outBlobs.push_back({path.string(), std::move(data), {}});
+}
+
+// Resident set size of the process in bytes, 0 where it can't be read
+static size_t residentBytes()
+{
+#if defined(__linux__)
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (file == nullptr)
+        return 0;
+    unsigned long pages = 0, residentPages = 0;
+    const int read = fscanf(file, "%lu %lu", &pages, &residentPages);
+    fclose(file);
+    return read == 2 ? size_t(residentPages) * 4096 : 0;
+#else
+    return 0;
+#endif  // #if defined(__linux__)
+}
+
+static double percentile(std::vector<double> values, double fraction)
+{
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, size_t(fraction * double(values.size())))];
+}
+
+// Decompressed blobs with the eviction policy of the backend cache: least recently used first, once they are
+// released and the budget is exceeded
+class BlobCache
+{
+public:
+    explicit BlobCache(size_t budget)
+        : m_Budget(budget)
+    {
+    }
+
+    ~BlobCache()
+    {
+        for (Entry& entry : m_Entries)
+            free(entry.data);
+    }
+
+    // Returns the decompression time in microseconds, 0 on a hit
+    double use(const Blob& blob)
+    {
+        for (auto it = m_Entries.begin(); it != m_Entries.end(); ++it)
+        {
+            if (it->blob == &blob)
+            {
+                m_Entries.splice(m_Entries.begin(), m_Entries, it);
+                ++hits;
+                return 0.0;
+            }
+        }
+
+        const uint32_t size  = ffxShaderBlobArchiveUncompressedSize(blob.archived.data(), uint32_t(blob.archived.size()));
+        const auto     start = std::chrono::steady_clock::now();
+        uint8_t*       data  = static_cast<uint8_t*>(malloc(size));
+        const bool     valid = ffxShaderBlobArchiveDecompress(blob.archived.data(), uint32_t(blob.archived.size()), data, size);
+        const double   microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        if (!valid || memcmp(data, blob.data.data(), size) != 0)
+        {
+            fprintf(stderr, "%s: round trip failed\n", blob.name.c_str());
+            ++failures;
+        }
+
+        m_Entries.push_front({&blob, data, size});
+        resident += size;
+        peakResident = std::max(peakResident, resident);
+
+        // the backend releases the blob right after creating the pipeline
+        while (resident > m_Budget && m_Entries.size() > 1)
+        {
+            resident -= m_Entries.back().size;
+            free(m_Entries.back().data);
+            m_Entries.pop_back();
+            ++evictions;
+        }
+        return microseconds;
+    }
+
+    size_t   resident     = 0;
+    size_t   peakResident = 0;
+    uint64_t hits         = 0;
+    uint64_t evictions    = 0;
+    uint64_t failures     = 0;
+
+private:
+    struct Entry
+    {
+        const Blob* blob;
+        uint8_t*    data;
+        uint32_t    size;
+    };
+
+    size_t           m_Budget;
+    std::list<Entry> m_Entries;
+};
+
+int main(int argc, char** argv)
+{
+    size_t                   budget = DefaultCacheBudget;
+    bool                     scan   = false;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "-budget" && i + 1 < argc)
+            budget = size_t(atof(argv[++i]) * 1024.0 * 1024.0);
+        else if (argument == "-scan")
+            scan = true;
+        else
+            inputs.push_back(argument);
+    }
+
+    if (inputs.empty())
+    {
+        fprintf(stderr, "Usage: FidelityFX_ShaderBlobArchiveBench [-budget <MB>] [-scan] <file or directory> [...]\n");
+        return 1;
+    }
+
+    std::vector<Blob> blobs;
+    for (const std::string& input : inputs)
+        loadBlobs(input, scan, blobs);
+    if (blobs.empty())
+    {
+        fprintf(stderr, "No shader blobs found\n");
+        return 1;
+    }
+
+    // binary size: the static arrays shrink from the raw to the archived bytes, the accessor tables stay the same
+    size_t rawBytes = 0, archivedBytes = 0, largestBlob = 0;
+    const auto compressStart = std::chrono::steady_clock::now();
+    for (Blob& blob : blobs)
+    {
+        ffxShaderBlobArchiveCompress(blob.data.data(), uint32_t(blob.data.size()), blob.archived);
+        rawBytes += blob.data.size();
+        archivedBytes += blob.archived.size();
+        largestBlob = std::max(largestBlob, blob.data.size());
+    }
+    const double compressSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - compressStart).count();
+
+    printf("%zu blobs, %.1f KB raw, %.1f KB archived (%.1f%%), largest %.1f KB, compressed in %.2f s\n",
+           blobs.size(),
+           rawBytes / 1024.0,
+           archivedBytes / 1024.0,
+           100.0 * double(archivedBytes) / double(rawBytes),
+           largestBlob / 1024.0,
+           compressSeconds);
+
+    // first use: every pipeline is created once, each blob is decompressed on its first request
+    const size_t        rssBefore = residentBytes();
+    BlobCache           cache(budget);
+    std::vector<double> firstUseUs;
+    for (const Blob& blob : blobs)
+        firstUseUs.push_back(cache.use(blob));
+    const size_t rssArchive = residentBytes();
+
+    // second pass, e.g. the context being recreated: hits for whatever the budget kept
+    for (const Blob& blob : blobs)
+        cache.use(blob);
+
+    double totalUs = 0.0;
+    for (double us : firstUseUs)
+        totalUs += us;
+    printf("first use: mean %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us, %.0f MB/s\n",
+           totalUs / double(firstUseUs.size()),
+           percentile(firstUseUs, 0.5),
+           percentile(firstUseUs, 0.99),
+           percentile(firstUseUs, 1.0),
+           totalUs > 0.0 ? double(rawBytes) / totalUs : 0.0);
+    printf("cache (budget %.1f MB): peak %.1f KB decompressed, %llu evictions, %llu hits on the second pass\n",
+           budget / (1024.0 * 1024.0),
+           cache.peakResident / 1024.0,
+           (unsigned long long)cache.evictions,
+           (unsigned long long)cache.hits);
+
+    // resident memory: archived blobs plus the decompressed ones against all blobs resident raw
+    const size_t peakArchive  = archivedBytes + cache.peakResident;
+    const size_t rssBeforeRaw = residentBytes();
+    uint8_t*     raw          = static_cast<uint8_t*>(malloc(rawBytes));
+    size_t       offset       = 0;
+    for (const Blob& blob : blobs)
+    {
+        memcpy(raw + offset, blob.data.data(), blob.data.size());
+        offset += blob.data.size();
+    }
+    const size_t rssRaw = residentBytes();
+    free(raw);
+
+    printf("resident: %.1f KB archived + decompressed vs %.1f KB raw", peakArchive / 1024.0, rawBytes / 1024.0);
+    // below that the allocations come from arenas that are resident already and the growth is noise
+    if (rssBefore != 0 && rawBytes >= 1024 * 1024)
+        printf(", measured RSS growth %.1f KB decompressing vs %.1f KB touching the raw blobs",
+               double(rssArchive - std::min(rssArchive, rssBefore)) / 1024.0,
+               double(rssRaw - std::min(rssRaw, rssBeforeRaw)) / 1024.0);
+    printf("\n");
+
+    return cache.failures == 0 ? 0 : 1;
+}
@@ -23,6 +23,7 @@
 #include "hlsl_compiler.h"
 #include "glsl_compiler.h"
 #include "utils.h"
+#include "ffx_shader_blob_archive.h"
 
 #include <Windows.h>
 #include <pathcch.h>
@@ -116,6 +117,7 @@ struct LaunchParameters
     bool                           printArguments     = false;
     bool                           disableLogs        = false;
     bool                           debugCompile       = false;
+    bool                           compress           = false;
 
     static void PrintCommandLineSyntax();
     void        ParseCommandLine(int argCount, const wchar_t* const* args);
@@ -205,6 +207,8 @@ void LaunchParameters::PrintCommandLineSyntax()
         L"  Dump depfile which recorded the include file dependencies in format of (gcc or msvc).\n"
         L"-debugcompile\n"
         L"  Compile shader with debug information.\n"
+        L"-compress\n"
+        L"  Store the shader binaries LZ4 compressed, for backends built with FFX_SHADER_BLOB_ARCHIVE.\n"
         L"-debugcmdline\n"
         L"  Print all the input arguments.\n"
     );
@@ -285,6 +289,8 @@ void LaunchParameters::ParseCommandLine(int argCount, const wchar_t* const* args
             disableLogs = true;
         else if (std::wstring(args[i]) == L"-debugcompile")
             debugCompile = true;
+        else if (std::wstring(args[i]) == L"-compress")
+            compress = true;
         else if (args[i][0] == L'-')
         {
             compilerArgs.push_back(args[i++]);
@@ -846,6 +852,15 @@ void Application::WriteShaderBinaryHeader(Permutation& permutation)
     int32_t shaderBinarySize = permutation.shaderBinary->BufferSize();
     uint8_t* shaderBinary     = permutation.shaderBinary->BufferPointer();
 
+    // Compressed binaries carry their uncompressed size in a header, the backend decompresses them on first use
+    std::vector<uint8_t> compressedBinary;
+    if (m_Params.compress)
+    {
+        ffxShaderBlobArchiveCompress(shaderBinary, shaderBinarySize, compressedBinary);
+        shaderBinarySize = (int32_t)compressedBinary.size();
+        shaderBinary     = compressedBinary.data();
+    }
+
     fprintf(fp, "static const uint32_t g_%s_size = %d;\n\n", permutationName.c_str(), (int)shaderBinarySize);
 
     fprintf(fp, "static const unsigned char g_%s_data[] = {\n", permutationName.c_str());
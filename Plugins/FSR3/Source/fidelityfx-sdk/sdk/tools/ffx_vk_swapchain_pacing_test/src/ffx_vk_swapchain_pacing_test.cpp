@@ -0,0 +1,291 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Headless test of the platform layer the Vulkan frame interpolation swapchain runs on outside Windows. Events,
+// threads and thread names are checked against the Win32 semantics the swapchain relies on, then a pacer and a
+// presenter thread are driven the way the swapchain drives them, with the Vulkan work left out, and the error of
+// each paced present against its target time is reported.
+//
+// Usage: FidelityFX_VkSwapchainPacingTest [frames] [max p99 error in us]
+//   Defaults to 300 frames at 60 fps and fails if the 99th percentile of the present error exceeds 2000 us, which
+//   leaves room for shared CI machines. Returns 0 if every check passed.
+
+#include "FrameInterpolationSwapchainVK_Platform.h"
+#include <ffx_frame_pacing.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char* description)
+{
+    printf("%s: %s\n", condition ? "PASS" : "FAIL", description);
+    failedChecks += condition ? 0 : 1;
+}
+
+static int64_t now()
+{
+    int64_t qpc = 0;
+    QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&qpc));
+    return qpc;
+}
+
+static int64_t frequency()
+{
+    int64_t qpcFrequency = 0;
+    QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency));
+    return qpcFrequency;
+}
+
+// Small deterministic generator so runs only differ by the scheduler.
+struct FrameTimeRandom
+{
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    // uniform in [0, 1)
+    double next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return double(state >> 11) * (1.0 / 9007199254740992.0);
+    }
+};
+
+//////////////////////////////////////////////
+/// Events and threads
+//////////////////////////////////////////////
+
+static DWORD WINAPI returnImmediately(LPVOID)
+{
+    return 0;
+}
+
+struct NamedThreadParams
+{
+    HANDLE startEvent;
+    char   name[16];
+};
+
+static DWORD WINAPI readOwnName(LPVOID param)
+{
+    NamedThreadParams* params = static_cast<NamedThreadParams*>(param);
+
+    // the swapchain threads pick up their name the next time they wait, like the presenter waiting on the pacer event
+    WaitForSingleObject(params->startEvent, INFINITE);
+#if defined(__linux__)
+    pthread_getname_np(pthread_self(), params->name, sizeof(params->name));
+#endif  // #if defined(__linux__)
+    return 0;
+}
+
+static void testEvents()
+{
+    HANDLE autoReset = CreateEvent(nullptr, FALSE, TRUE, nullptr);
+    check(WaitForSingleObject(autoReset, 0) == WAIT_OBJECT_0, "signaled auto reset event satisfies a wait");
+    check(WaitForSingleObject(autoReset, 0) == WAIT_TIMEOUT, "auto reset event resets after satisfying a wait");
+    CloseHandle(autoReset);
+
+    HANDLE manualReset = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    SetEvent(manualReset);
+    check(WaitForSingleObject(manualReset, 0) == WAIT_OBJECT_0 && WaitForSingleObject(manualReset, 0) == WAIT_OBJECT_0,
+          "manual reset event stays signaled");
+    ResetEvent(manualReset);
+    const int64_t waitStart = now();
+    check(WaitForSingleObject(manualReset, 20) == WAIT_TIMEOUT, "wait on a reset event times out");
+    check(now() - waitStart >= frequency() * 20 / 1000, "timed out wait lasts at least its timeout");
+    CloseHandle(manualReset);
+
+    HANDLE thread = CreateThread(nullptr, 0, returnImmediately, nullptr, 0, nullptr);
+    check(thread != nullptr && WaitForSingleObject(thread, INFINITE) == WAIT_OBJECT_0, "wait on a thread returns once it exits");
+    CloseHandle(thread);
+}
+
+static void testThreadNames()
+{
+    NamedThreadParams params = {};
+    params.startEvent        = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    HANDLE thread            = CreateThread(nullptr, 0, readOwnName, &params, 0, nullptr);
+    check(SetThreadPriority(thread, THREAD_PRIORITY_HIGHEST) != FALSE, "raising the priority doesn't fail");
+    check(SetThreadDescription(thread, L"AMD FSR Presenter Thread") == 0, "naming a running thread succeeds");
+    SetEvent(params.startEvent);
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+    CloseHandle(params.startEvent);
+#if defined(__linux__)
+    check(strcmp(params.name, "AMD FSR Present") == 0, "thread name is truncated to 15 characters and applied by the thread");
+#endif  // #if defined(__linux__)
+
+    // the threads are detached, naming one that has already exited must only touch the handle
+    bool allNamed = true;
+    for (int i = 0; i < 1000; ++i)
+    {
+        HANDLE exited = CreateThread(nullptr, 0, returnImmediately, nullptr, 0, nullptr);
+        WaitForSingleObject(exited, INFINITE);
+        allNamed &= SetThreadDescription(exited, L"AMD FSR Interpolation Thread") == 0;
+        CloseHandle(exited);
+    }
+    check(allNamed, "naming threads that have already exited succeeds");
+}
+
+//////////////////////////////////////////////
+/// Pacing
+//////////////////////////////////////////////
+
+struct ScheduledPresents
+{
+    int64_t presentQpcDelta;
+    bool    valid;
+};
+
+struct PacingState
+{
+    CRITICAL_SECTION  scheduledFrameCriticalSection;
+    HANDLE            pacerEvent;
+    ScheduledPresents scheduledPresents = {};
+    volatile bool     shutdown          = false;
+
+    uint64_t             numPresents = 0;
+    std::vector<double>  presentErrorsUs;
+};
+
+// Same waits as the presenter thread of the swapchain: two presents per frame pair, each paced from the previous one
+static DWORD WINAPI presenterThread(LPVOID param)
+{
+    PacingState* state              = static_cast<PacingState*>(param);
+    int64_t      previousPresentQpc = 0;
+
+    while (!state->shutdown)
+    {
+        WaitForSingleObject(state->pacerEvent, INFINITE);
+
+        EnterCriticalSection(&state->scheduledFrameCriticalSection);
+        ScheduledPresents entry = state->scheduledPresents;
+        state->scheduledPresents.valid = false;
+        LeaveCriticalSection(&state->scheduledFrameCriticalSection);
+
+        if (!entry.valid)
+            continue;
+
+        for (int frameType = 0; frameType < 2; ++frameType)
+        {
+            const int64_t target = previousPresentQpc + entry.presentQpcDelta;
+            const bool    paced  = previousPresentQpc > 0 && target > now();
+
+            waitForPerformanceCount(target);
+            QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&previousPresentQpc));
+
+            // presents whose target had already passed aren't paced, there is nothing to measure for them
+            if (paced)
+                state->presentErrorsUs.push_back(double(previousPresentQpc - target) * 1000000.0 / double(frequency()));
+            ++state->numPresents;
+        }
+    }
+
+    return 0;
+}
+
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    return sorted.empty() ? 0.0 : sorted[std::min(sorted.size() - 1, size_t(p * double(sorted.size())))];
+}
+
+static void testPacing(int numFrames, double maxP99ErrorUs)
+{
+    PacingState state;
+    InitializeCriticalSection(&state.scheduledFrameCriticalSection);
+    state.pacerEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+    HANDLE presenter = CreateThread(nullptr, 0, presenterThread, &state, 0, nullptr);
+    SetThreadPriority(presenter, THREAD_PRIORITY_HIGHEST);
+    SetThreadDescription(presenter, L"AMD FSR Presenter Thread");
+
+    // stands in for the interpolation thread: frame pairs finish every 16.7 ms +-1 ms and get their present delta from the policy
+    QpcFramePacingClock pacingClock;
+    FramePacingPolicy   pacingPolicy(pacingClock);
+    FrameTimeRandom     random;
+    const int64_t       frameInterval = frequency() / 60;
+    const int64_t       jitter        = frequency() / 1000;
+    int64_t             frameDone     = now();
+    uint64_t            numDropped    = 0;
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        frameDone += frameInterval;
+        waitForPerformanceCount(frameDone + int64_t((random.next() * 2.0 - 1.0) * double(jitter)));
+
+        const int64_t deltaToUse = pacingPolicy.update(false, 0.0001, 0.1);
+
+        EnterCriticalSection(&state.scheduledFrameCriticalSection);
+        numDropped += state.scheduledPresents.valid ? 1 : 0;
+        state.scheduledPresents.presentQpcDelta = deltaToUse;
+        state.scheduledPresents.valid           = true;
+        LeaveCriticalSection(&state.scheduledFrameCriticalSection);
+        SetEvent(state.pacerEvent);
+    }
+
+    state.shutdown = true;
+    SetEvent(state.pacerEvent);
+    WaitForSingleObject(presenter, INFINITE);
+    CloseHandle(presenter);
+    CloseHandle(state.pacerEvent);
+    DeleteCriticalSection(&state.scheduledFrameCriticalSection);
+
+    std::vector<double> errors = state.presentErrorsUs;
+    std::sort(errors.begin(), errors.end());
+    double mean = 0.0;
+    for (double error : errors)
+        mean += error / double(errors.size());
+
+    printf("%d frame pairs, %llu presents, %llu dropped, %zu paced\n",
+           numFrames,
+           (unsigned long long)state.numPresents,
+           (unsigned long long)numDropped,
+           errors.size());
+    printf("present error: mean %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us\n",
+           mean,
+           percentile(errors, 0.5),
+           percentile(errors, 0.99),
+           errors.empty() ? 0.0 : errors.back());
+
+    check(state.numPresents == 2 * (uint64_t(numFrames) - numDropped), "every frame pair that wasn't replaced gets presented twice");
+    check(numDropped * 20 <= uint64_t(numFrames), "at most 5% of the frame pairs are replaced before the presenter picks them up");
+    check(errors.size() * 4 >= state.numPresents, "at least a quarter of the presents are paced");
+    check(percentile(errors, 0.99) <= maxP99ErrorUs, "99th percentile of the present error is within the limit");
+}
+
+int main(int argc, char** argv)
+{
+    const int    numFrames     = argc > 1 ? atoi(argv[1]) : 300;
+    const double maxP99ErrorUs = argc > 2 ? atof(argv[2]) : 2000.0;
+
+    testEvents();
+    testThreadNames();
+    testPacing(numFrames > 0 ? numFrames : 300, maxP99ErrorUs);
+
+    printf("%d check(s) failed\n", failedChecks);
+    return failedChecks == 0 ? 0 : 1;
+}
@@ -14,6 +14,8 @@
 #include "Framework/Application/SlateApplication.h"
 #include "HAL/IConsoleManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 #include "RHI.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -31,6 +33,8 @@
 #include "StreamlineLatewarp.h"
 #include "StreamlineRHI.h"
 
+#include "StreamlinePredictiveFrameLimiter.h"
+
 static TAutoConsoleVariable<bool> CVarStreamlineUnregisterReflexPlugin(
 	TEXT("r.Streamline.UnregisterReflexPlugin"),
 	true,
@@ -86,6 +90,32 @@ static TAutoConsoleVariable<bool> CVarStreamlineReflexHandleMaxTickRate(
 	TEXT("Controls whether Streamline Reflex handles frame rate limiting instead of the engine (default = true)"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<bool> CVarStreamlineReflexPredictiveFrameLimiter(
+	TEXT("t.Streamline.Reflex.PredictiveFrameLimiter"),
+	false,
+	TEXT("When Streamline Reflex handles the max tick rate, limit the frame rate with the plugin's predictive frame limiter instead of the Reflex frame limit (default = false)\n")
+	TEXT("The predictive limiter starts each frame as late as the recent frame costs allow, see t.Streamline.Reflex.PredictiveFrameLimiter.*"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineFrameLimiterPercentile(
+	TEXT("t.Streamline.Reflex.PredictiveFrameLimiter.Percentile"),
+	0.95f,
+	TEXT("Percentile of the recent frame costs the predictive frame limiter budgets for the next frame (default = 0.95)\n")
+	TEXT("Higher values miss fewer deadlines, lower values start frames later and reduce latency further"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineFrameLimiterMarginMs(
+	TEXT("t.Streamline.Reflex.PredictiveFrameLimiter.MarginMs"),
+	1.0f,
+	TEXT("Safety margin in milliseconds added to the predicted frame cost (default = 1.0)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineFrameLimiterSpinMs(
+	TEXT("t.Streamline.Reflex.PredictiveFrameLimiter.SpinMs"),
+	1.0f,
+	TEXT("How long before the wake up time the predictive frame limiter stops sleeping and starts spinning, in milliseconds (default = 1.0)"),
+	ECVF_Default);
+
 TUniquePtr<FStreamlineMaxTickRateHandler> FStreamlineMaxTickRateHandler::StreamlineMaxTickRateHandler = nullptr;
 TUniquePtr<FStreamlineLatencyMarkers> FStreamlineLatencyMarkers::StreamlineLatencyMarkers = nullptr;
 
@@ -282,6 +312,13 @@ uint32 FStreamlineMaxTickRateHandler::GetFlags()
 	}
 }
 
+FStreamlineMaxTickRateHandler::FStreamlineMaxTickRateHandler()
+	: FrameLimiter(MakeUnique<FStreamlinePredictiveFrameLimiter>())
+{
+}
+
+FStreamlineMaxTickRateHandler::~FStreamlineMaxTickRateHandler() = default;
+
 FStreamlineMaxTickRateHandler* FStreamlineMaxTickRateHandler::Get()
 {
 	if (!StreamlineMaxTickRateHandler)
@@ -350,10 +387,14 @@ bool FStreamlineMaxTickRateHandler::HandleMaxTickRate(float DesiredMaxTickRate)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_GameTickReflexWaitTime);
 		const double CurrentRealTime = FPlatformTime::Seconds();
-		static double LastRealTimeAfterSleep = CurrentRealTime - 0.0001;
+		if (LastRealTimeAfterSleep == 0.0)
+		{
+			LastRealTimeAfterSleep = CurrentRealTime - 0.0001;
+		}
 		const float DeltaRealTimeMinusSleep = static_cast<float>(CurrentRealTime - LastRealTimeAfterSleep);
 
 		sl::ReflexOptions ReflexOptions = {};
+		double FrameLimiterIntervalSeconds = 0.0;
 
 		static_assert(sl::ReflexMode_eCount == 3U, "sl::ReflexMode_eCount enum value mismatch. Dear NVIDIA Streamline plugin developer, please update this code!");
 		switch (static_cast<ReflexFlags>(GetFlags() & uint32(ReflexFlags::AllBits)))
@@ -381,6 +422,13 @@ bool FStreamlineMaxTickRateHandler::HandleMaxTickRate(float DesiredMaxTickRate)
 			// Issue seen in UE 5.2, not well tested in older engine versions
 			ReflexOptions.frameLimitUs = 0;
 		}
+		else if (CVarStreamlineReflexPredictiveFrameLimiter.GetValueOnAnyThread())
+		{
+			// The limiter keeps its own deadlines so it gets the plain interval, and Reflex doesn't limit on top of it
+			ReflexOptions.frameLimitUs = 0;
+			FrameLimiterIntervalSeconds = DesiredMaxTickRate > 0 ? (1.0 / DesiredMaxTickRate) : 0.0;
+			bFrameRateHandled = true;
+		}
 		else
 		{
 			const float DesiredMinimumIntervalUs = CalculateDesiredMinimumIntervalUs(DesiredMaxTickRate, DeltaRealTimeMinusSleep);
@@ -398,10 +446,25 @@ bool FStreamlineMaxTickRateHandler::HandleMaxTickRate(float DesiredMaxTickRate)
 		TRACE_CPUPROFILER_EVENT_SCOPE(ReflexSleep);
 		FThreadIdleStats::FScopeIdle Scope;
 
+		if (FrameLimiterIntervalSeconds > 0.0)
+		{
+			FStreamlinePredictiveFrameLimiter::FSettings Settings;
+			Settings.Percentile = CVarStreamlineFrameLimiterPercentile.GetValueOnAnyThread();
+			Settings.MarginSeconds = CVarStreamlineFrameLimiterMarginMs.GetValueOnAnyThread() / 1000.0;
+			Settings.SpinSeconds = CVarStreamlineFrameLimiterSpinMs.GetValueOnAnyThread() / 1000.0;
+			FrameLimiter->Wait(FrameLimiterIntervalSeconds, Settings);
+		}
+		else
+		{
+			FrameLimiter->Reset();
+		}
+
 		sl::FrameToken* FrameToken = FStreamlineCoreModule::GetStreamlineRHI()->GetFrameToken(GFrameCounter);
 		sl::Result Result = CALL_SL_FEATURE_FN(sl::kFeatureReflex, slReflexSleep, *FrameToken);
 		checkf(Result == sl::Result::eOk, TEXT("slReflexSleep failed (%s)"), ANSI_TO_TCHAR(sl::getResultAsStr(Result)));
 		LastRealTimeAfterSleep = FPlatformTime::Seconds();
+		// the frame starts once Reflex lets it go, so that's where its cost is measured from
+		FrameLimiter->OnFrameStarted(LastRealTimeAfterSleep);
 	}
 	else
 	{
@@ -427,6 +490,160 @@ void FStreamlineLatencyMarkers::Initialize()
 	}
 }
 
+const TCHAR* LexToString(EStreamlineLatencyStage Stage)
+{
+	switch (Stage)
+	{
+		case EStreamlineLatencyStage::Total:         return TEXT("Total");
+		case EStreamlineLatencyStage::Simulation:    return TEXT("Simulation");
+		case EStreamlineLatencyStage::RenderSubmit:  return TEXT("RenderSubmit");
+		case EStreamlineLatencyStage::Present:       return TEXT("Present");
+		case EStreamlineLatencyStage::Driver:        return TEXT("Driver");
+		case EStreamlineLatencyStage::OSRenderQueue: return TEXT("OSRenderQueue");
+		case EStreamlineLatencyStage::GPURender:     return TEXT("GPURender");
+		default:                                     return TEXT("Unknown");
+	}
+}
+
+void FStreamlineLatencyHistogram::AddSample(float LatencyMs)
+{
+	if (Buckets.Num() == 0)
+	{
+		Buckets.SetNumZeroed(NumBuckets);
+	}
+	const int32 Bucket = FMath::Clamp(FMath::FloorToInt(LatencyMs / BucketWidthMs), 0, NumBuckets - 1);
+	++Buckets[Bucket];
+	++NumSamples;
+}
+
+void FStreamlineLatencyHistogram::Reset()
+{
+	Buckets.Empty();
+	NumSamples = 0;
+}
+
+float FStreamlineLatencyHistogram::GetPercentileMs(float Percentile) const
+{
+	if (NumSamples == 0)
+	{
+		return 0.0f;
+	}
+
+	// nearest rank, so p50 of 2 samples is the lower one and p100 is the max
+	const uint64 Rank = FMath::Max<uint64>(1, uint64(FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0f, 1.0f) * double(NumSamples))));
+	uint64 Count = 0;
+	for (int32 Bucket = 0; Bucket < Buckets.Num(); ++Bucket)
+	{
+		Count += Buckets[Bucket];
+		if (Count >= Rank)
+		{
+			return (Bucket + 0.5f) * BucketWidthMs;
+		}
+	}
+	return (NumBuckets - 0.5f) * BucketWidthMs;
+}
+
+static float GetReportIntervalMs(uint64_t StartTimeUs, uint64_t EndTimeUs)
+{
+	// stages that didn't happen (yet) have zero timestamps
+	return EndTimeUs > StartTimeUs ? (EndTimeUs - StartTimeUs) / 1000.0f : 0.0f;
+}
+
+void FStreamlineLatencyMarkers::AccumulateFrameReport(const sl::ReflexReport& Report)
+{
+	const float TotalLatencyMs = GetReportIntervalMs(Report.simStartTime, Report.gpuRenderEndTime);
+	const float SimulationLatencyMs = GetReportIntervalMs(Report.simStartTime, Report.simEndTime);
+	const float RenderSubmitLatencyMs = GetReportIntervalMs(Report.renderSubmitStartTime, Report.renderSubmitEndTime);
+	const float PresentLatencyMs = GetReportIntervalMs(Report.presentStartTime, Report.presentEndTime);
+	const float DriverLatencyMs = GetReportIntervalMs(Report.driverStartTime, Report.driverEndTime);
+	const float OSRenderQueueLatencyMs = GetReportIntervalMs(Report.osRenderQueueStartTime, Report.osRenderQueueEndTime);
+	const float GPURenderLatencyMs = GetReportIntervalMs(Report.gpuRenderStartTime, Report.gpuRenderEndTime);
+
+	// A 3/4, 1/4 split per frame gets close to a simple 10 frame moving average
+	AverageTotalLatencyMs = AverageTotalLatencyMs * 0.75f + TotalLatencyMs * 0.25f;
+	AverageGameLatencyMs = AverageGameLatencyMs * 0.75f + GetReportIntervalMs(Report.simStartTime, Report.driverEndTime) * 0.25f;
+	AverageRenderLatencyMs = AverageRenderLatencyMs * 0.75f + GetReportIntervalMs(Report.osRenderQueueStartTime, Report.gpuRenderEndTime) * 0.25f;
+
+	AverageSimulationLatencyMs = AverageSimulationLatencyMs * 0.75f + SimulationLatencyMs * 0.25f;
+	AverageRenderSubmitLatencyMs = AverageRenderSubmitLatencyMs * 0.75f + RenderSubmitLatencyMs * 0.25f;
+	AveragePresentLatencyMs = AveragePresentLatencyMs * 0.75f + PresentLatencyMs * 0.25f;
+	AverageDriverLatencyMs = AverageDriverLatencyMs * 0.75f + DriverLatencyMs * 0.25f;
+	AverageOSRenderQueueLatencyMs = AverageOSRenderQueueLatencyMs * 0.75f + OSRenderQueueLatencyMs * 0.25f;
+	AverageGPURenderLatencyMs = AverageGPURenderLatencyMs * 0.75f + GPURenderLatencyMs * 0.25f;
+
+	RenderSubmitOffsetMs = GetReportIntervalMs(Report.simStartTime, Report.renderSubmitStartTime);
+	PresentOffsetMs = GetReportIntervalMs(Report.simStartTime, Report.presentStartTime);
+	DriverOffsetMs = GetReportIntervalMs(Report.simStartTime, Report.driverStartTime);
+	OSRenderQueueOffsetMs = GetReportIntervalMs(Report.simStartTime, Report.osRenderQueueStartTime);
+	GPURenderOffsetMs = GetReportIntervalMs(Report.simStartTime, Report.gpuRenderStartTime);
+
+	LatencyHistograms[int32(EStreamlineLatencyStage::Total)].AddSample(TotalLatencyMs);
+	LatencyHistograms[int32(EStreamlineLatencyStage::Simulation)].AddSample(SimulationLatencyMs);
+	LatencyHistograms[int32(EStreamlineLatencyStage::RenderSubmit)].AddSample(RenderSubmitLatencyMs);
+	LatencyHistograms[int32(EStreamlineLatencyStage::Present)].AddSample(PresentLatencyMs);
+	LatencyHistograms[int32(EStreamlineLatencyStage::Driver)].AddSample(DriverLatencyMs);
+	LatencyHistograms[int32(EStreamlineLatencyStage::OSRenderQueue)].AddSample(OSRenderQueueLatencyMs);
+	LatencyHistograms[int32(EStreamlineLatencyStage::GPURender)].AddSample(GPURenderLatencyMs);
+}
+
+void FStreamlineLatencyMarkers::ResetLatencyStats()
+{
+	AverageTotalLatencyMs = 0.0f;
+	AverageGameLatencyMs = 0.0f;
+	AverageRenderLatencyMs = 0.0f;
+
+	AverageSimulationLatencyMs = 0.0f;
+	AverageRenderSubmitLatencyMs = 0.0f;
+	AveragePresentLatencyMs = 0.0f;
+	AverageDriverLatencyMs = 0.0f;
+	AverageOSRenderQueueLatencyMs = 0.0f;
+	AverageGPURenderLatencyMs = 0.0f;
+
+	RenderSubmitOffsetMs = 0.0f;
+	PresentOffsetMs = 0.0f;
+	DriverOffsetMs = 0.0f;
+	OSRenderQueueOffsetMs = 0.0f;
+	GPURenderOffsetMs = 0.0f;
+
+	LastReportedFrameID = 0;
+	ResetLatencyHistograms();
+}
+
+int32 FStreamlineLatencyMarkers::ConsumeFrameReports(TArrayView<const sl::ReflexReport> FrameReports)
+{
+	if (FrameReports.Num() == 0)
+	{
+		return 0;
+	}
+
+	// frame IDs going backwards means the frame counting restarted, so everything in the report is new again
+	if (FrameReports.Last().frameID < LastReportedFrameID)
+	{
+		LastReportedFrameID = 0;
+	}
+
+	// The last report is the latest frame, older frames come before it.
+	// Consume every frame that completed since the last tick instead of only the latest one, skipping those already seen.
+	// Stop at the first frame that hasn't finished on the GPU yet so it gets picked up by a later tick instead of being skipped for good
+	int32 NumNewFrameReports = 0;
+	for (const sl::ReflexReport& Report : FrameReports)
+	{
+		if (Report.frameID <= LastReportedFrameID)
+		{
+			continue;
+		}
+		if (Report.gpuRenderEndTime <= Report.simStartTime)
+		{
+			break;
+		}
+
+		AccumulateFrameReport(Report);
+		LastReportedFrameID = Report.frameID;
+		++NumNewFrameReports;
+	}
+	return NumNewFrameReports;
+}
+
 void FStreamlineLatencyMarkers::Tick(float DeltaTime)
 {
 	if (IsStreamlineReflexSupported() && GetAvailable())
@@ -437,30 +654,11 @@ void FStreamlineLatencyMarkers::Tick(float DeltaTime)
 
 		if (ReflexState.latencyReportAvailable)
 		{
-			// frameReport[63] contains the latest completed frameReport
-			const uint64_t TotalLatencyUs = ReflexState.frameReport[63].gpuRenderEndTime - ReflexState.frameReport[63].simStartTime;
+			const int32 NumNewFrameReports = ConsumeFrameReports(MakeArrayView(ReflexState.frameReport));
 
-			if (TotalLatencyUs != 0)
+			if (NumNewFrameReports > 0)
 			{
-				// frameReport results available, get latest completed frame latency data
-				// A 3/4, 1/4 split gets close to a simple 10 frame moving average
-				AverageTotalLatencyMs = AverageTotalLatencyMs * 0.75f + TotalLatencyUs / 1000.0f * 0.25f;
-
-				AverageGameLatencyMs = AverageGameLatencyMs * 0.75f + (ReflexState.frameReport[63].driverEndTime - ReflexState.frameReport[63].simStartTime) / 1000.0f * 0.25f;
-				AverageRenderLatencyMs = AverageRenderLatencyMs * 0.75f + (ReflexState.frameReport[63].gpuRenderEndTime - ReflexState.frameReport[63].osRenderQueueStartTime) / 1000.0f * 0.25f;
-
-				AverageSimulationLatencyMs = AverageSimulationLatencyMs * 0.75f + (ReflexState.frameReport[63].simEndTime - ReflexState.frameReport[63].simStartTime) / 1000.0f * 0.25f;
-				AverageRenderSubmitLatencyMs = AverageRenderSubmitLatencyMs * 0.75f + (ReflexState.frameReport[63].renderSubmitEndTime - ReflexState.frameReport[63].renderSubmitStartTime) / 1000.0f * 0.25f;
-				AveragePresentLatencyMs = AveragePresentLatencyMs * 0.75f + (ReflexState.frameReport[63].presentEndTime - ReflexState.frameReport[63].presentStartTime) / 1000.0f * 0.25f;
-				AverageDriverLatencyMs = AverageDriverLatencyMs * 0.75f + (ReflexState.frameReport[63].driverEndTime - ReflexState.frameReport[63].driverStartTime) / 1000.0f * 0.25f;
-				AverageOSRenderQueueLatencyMs = AverageOSRenderQueueLatencyMs * 0.75f + (ReflexState.frameReport[63].osRenderQueueEndTime - ReflexState.frameReport[63].osRenderQueueStartTime) / 1000.0f * 0.25f;
-				AverageGPURenderLatencyMs = AverageGPURenderLatencyMs * 0.75f + (ReflexState.frameReport[63].gpuRenderEndTime - ReflexState.frameReport[63].gpuRenderStartTime) / 1000.0f * 0.25f;
-
-				RenderSubmitOffsetMs = (ReflexState.frameReport[63].renderSubmitStartTime - ReflexState.frameReport[63].simStartTime) / 1000.0f;
-				PresentOffsetMs = (ReflexState.frameReport[63].presentStartTime - ReflexState.frameReport[63].simStartTime) / 1000.0f;
-				DriverOffsetMs = (ReflexState.frameReport[63].driverStartTime - ReflexState.frameReport[63].simStartTime) / 1000.0f;
-				OSRenderQueueOffsetMs = (ReflexState.frameReport[63].osRenderQueueStartTime - ReflexState.frameReport[63].simStartTime) / 1000.0f;
-				GPURenderOffsetMs = (ReflexState.frameReport[63].gpuRenderStartTime - ReflexState.frameReport[63].simStartTime) / 1000.0f;
+				UE_LOG(LogStreamline, VeryVerbose, TEXT("NumNewFrameReports: %d, LastReportedFrameID: %llu"), NumNewFrameReports, LastReportedFrameID);
 
 				UE_LOG(LogStreamline, VeryVerbose, TEXT("AverageTotalLatencyMs: %f"), AverageTotalLatencyMs);
 				UE_LOG(LogStreamline, VeryVerbose, TEXT("AverageGameLatencyMs: %f"), AverageGameLatencyMs);
@@ -479,42 +677,104 @@ void FStreamlineLatencyMarkers::Tick(float DeltaTime)
 	{
 		// Reset module back to default values in case re-enabled in the same session
 		// doing this here in case the cvar gets used to disable latency (vs SetEnabled)
-		AverageTotalLatencyMs = 0.0f;
-		AverageGameLatencyMs = 0.0f;
-		AverageRenderLatencyMs = 0.0f;
-
-		AverageSimulationLatencyMs = 0.0f;
-		AverageRenderSubmitLatencyMs = 0.0f;
-		AveragePresentLatencyMs = 0.0f;
-		AverageDriverLatencyMs = 0.0f;
-		AverageOSRenderQueueLatencyMs = 0.0f;
-		AverageGPURenderLatencyMs = 0.0f;
-
-		RenderSubmitOffsetMs = 0.0f;
-		PresentOffsetMs = 0.0f;
-		DriverOffsetMs = 0.0f;
-		OSRenderQueueOffsetMs = 0.0f;
-		GPURenderOffsetMs = 0.0f;
-
-		AverageTotalLatencyMs = 0.0f;
-		AverageGameLatencyMs = 0.0f;
-		AverageRenderLatencyMs = 0.0f;
-
-		AverageSimulationLatencyMs = 0.0f;
-		AverageRenderSubmitLatencyMs = 0.0f;
-		AveragePresentLatencyMs = 0.0f;
-		AverageDriverLatencyMs = 0.0f;
-		AverageOSRenderQueueLatencyMs = 0.0f;
-		AverageGPURenderLatencyMs = 0.0f;
-
-		RenderSubmitOffsetMs = 0.0f;
-		PresentOffsetMs = 0.0f;
-		DriverOffsetMs = 0.0f;
-		OSRenderQueueOffsetMs = 0.0f;
-		GPURenderOffsetMs = 0.0f;
+		ResetLatencyStats();
+	}
+}
+
+float FStreamlineLatencyMarkers::GetLatencyPercentileInMs(EStreamlineLatencyStage Stage, float Percentile) const
+{
+	check(Stage < EStreamlineLatencyStage::Num);
+	return LatencyHistograms[int32(Stage)].GetPercentileMs(Percentile);
+}
+
+uint64 FStreamlineLatencyMarkers::GetNumLatencySamples() const
+{
+	return LatencyHistograms[int32(EStreamlineLatencyStage::Total)].GetNumSamples();
+}
+
+void FStreamlineLatencyMarkers::ResetLatencyHistograms()
+{
+	for (FStreamlineLatencyHistogram& Histogram : LatencyHistograms)
+	{
+		if (Histogram.GetNumSamples() != 0)
+		{
+			Histogram.Reset();
+		}
+	}
+}
+
+bool FStreamlineLatencyMarkers::ExportLatencyHistogramsToCSV(const FString& Filename) const
+{
+	FString CSV = TEXT("BucketStartMs");
+	for (int32 Stage = 0; Stage < int32(EStreamlineLatencyStage::Num); ++Stage)
+	{
+		CSV += FString::Printf(TEXT(",%s"), LexToString(EStreamlineLatencyStage(Stage)));
 	}
+	CSV += LINE_TERMINATOR;
+
+	for (int32 Bucket = 0; Bucket < FStreamlineLatencyHistogram::NumBuckets; ++Bucket)
+	{
+		bool bBucketUsed = false;
+		for (const FStreamlineLatencyHistogram& Histogram : LatencyHistograms)
+		{
+			bBucketUsed |= Histogram.GetBucketCount(Bucket) != 0;
+		}
+		if (!bBucketUsed)
+		{
+			continue;
+		}
+
+		CSV += FString::Printf(TEXT("%.1f"), Bucket * FStreamlineLatencyHistogram::BucketWidthMs);
+		for (const FStreamlineLatencyHistogram& Histogram : LatencyHistograms)
+		{
+			CSV += FString::Printf(TEXT(",%u"), Histogram.GetBucketCount(Bucket));
+		}
+		CSV += LINE_TERMINATOR;
+	}
+
+	return FFileHelper::SaveStringToFile(CSV, *Filename);
 }
 
+static FAutoConsoleCommand CCmdStreamlineReflexDumpLatency(
+	TEXT("t.Streamline.Reflex.DumpLatency"),
+	TEXT("Logs p50/p99 of each Reflex latency stage over all frames since the last reset. Pass a filename to also export the histograms as CSV, relative paths go into the profiling directory"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		// Get() would initialize Reflex on hardware that doesn't support it
+		if (!IsStreamlineReflexSupported())
+		{
+			UE_LOG(LogStreamline, Log, TEXT("Streamline Reflex is not supported, no latency to dump"));
+			return;
+		}
+
+		const FStreamlineLatencyMarkers* LatencyMarkers = FStreamlineLatencyMarkers::Get();
+		UE_LOG(LogStreamline, Log, TEXT("Reflex latency over %llu frames"), LatencyMarkers->GetNumLatencySamples());
+		for (int32 Stage = 0; Stage < int32(EStreamlineLatencyStage::Num); ++Stage)
+		{
+			UE_LOG(LogStreamline, Log, TEXT("  %-14s p50 %6.1f ms  p99 %6.1f ms"), LexToString(EStreamlineLatencyStage(Stage)),
+				LatencyMarkers->GetLatencyPercentileInMs(EStreamlineLatencyStage(Stage), 0.5f),
+				LatencyMarkers->GetLatencyPercentileInMs(EStreamlineLatencyStage(Stage), 0.99f));
+		}
+
+		if (Args.Num() > 0)
+		{
+			const FString Filename = FPaths::IsRelative(Args[0]) ? FPaths::Combine(FPaths::ProfilingDir(), Args[0]) : Args[0];
+			const bool bSaved = LatencyMarkers->ExportLatencyHistogramsToCSV(Filename);
+			UE_LOG(LogStreamline, Log, TEXT("%s Reflex latency histograms to %s"), bSaved ? TEXT("Exported") : TEXT("Failed to export"), *Filename);
+		}
+	}));
+
+static FAutoConsoleCommand CCmdStreamlineReflexResetLatency(
+	TEXT("t.Streamline.Reflex.ResetLatency"),
+	TEXT("Clears the Reflex latency histograms used by t.Streamline.Reflex.DumpLatency"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (IsStreamlineReflexSupported())
+		{
+			FStreamlineLatencyMarkers::Get()->ResetLatencyHistograms();
+		}
+	}));
+
 void FStreamlineLatencyMarkers::SetInputSampleLatencyMarker(uint64)
 {
 	//The engine calls this every frame, so making the log less chatty 
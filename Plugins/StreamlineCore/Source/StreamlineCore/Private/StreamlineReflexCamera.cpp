@@ -84,6 +84,18 @@ static TAutoConsoleVariable<float> CVarStreamlineReflexClipRadius(
 	TEXT("Collision radius for camera extrapolation clipping. (default = 10.f)\n"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<bool> CVarStreamlineReflexClipCorrectionAsync(
+	TEXT("r.Streamline.Reflex.ClipCorrection.Async"), 0,
+	TEXT("Whether clip correction also issues an asynchronous sweep, inflated by the predicted camera motion, so that the next frame\n")
+	TEXT("can skip its synchronous sweep when that one came back clear. (default = 0)\n"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<bool> CVarStreamlineReflexCacheLateUpdatePrimitives(
+	TEXT("r.Streamline.Reflex.CacheLateUpdatePrimitives"), 1,
+	TEXT("Whether the collision ignore list and custom depth setup for the primitives attached to the view target are kept across frames\n")
+	TEXT("and only rebuilt when components get attached, detached or change scene proxy. (default = 1)\n"),
+	ECVF_RenderThreadSafe);
+
 
 static TAutoConsoleVariable<int32> CVarStreamlineReflexActorDebug(
 	TEXT("r.Streamline.Reflex.ActorDebug"), 0,
@@ -291,8 +303,17 @@ void FStreamlineCameraManager::LateUpdate_GameThread(const APlayerController* Pl
 	LateUpdateData.FrameID = FrameID;
 	LateUpdateData.Primitives.Reset();
 	LateUpdateData.World = Component->GetWorld();
-	LateUpdateData.CollisionParams = FCollisionQueryParams(SCENE_QUERY_STAT(CameraPen), false, Player);
-	GatherLateUpdatePrimitives(FrameID, Component, LateUpdateData.CollisionParams);
+
+	if (CVarStreamlineReflexCacheLateUpdatePrimitives.GetValueOnGameThread())
+	{
+		GatherRegisteredLateUpdatePrimitives(FrameID, Component, Player);
+	}
+	else
+	{
+		LateUpdateRegistration.bValid = false;
+		LateUpdateData.CollisionParams = FCollisionQueryParams(SCENE_QUERY_STAT(CameraPen), false, Player);
+		GatherLateUpdatePrimitives(FrameID, Component, LateUpdateData.CollisionParams);
+	}
 }
 
 void FStreamlineCameraManager::CacheSceneInfo(int64 FrameID, USceneComponent* Component, FCollisionQueryParams& CollisionParams)
@@ -328,6 +349,105 @@ void FStreamlineCameraManager::GatherLateUpdatePrimitives(int64 FrameID, USceneC
 	}
 }
 
+static void HashAndGatherLateUpdatePrimitives(USceneComponent* Component, uint32& HierarchyHash, uint32& SceneProxyHash, TMap<FPrimitiveSceneInfo*, int32>& Primitives)
+{
+	HierarchyHash = HashCombine(HierarchyHash, GetTypeHash(Component));
+
+	UPrimitiveComponent* PrimitiveComponent = dynamic_cast<UPrimitiveComponent*>(Component);
+	if (PrimitiveComponent && PrimitiveComponent->SceneProxy)
+	{
+		FPrimitiveSceneInfo* PrimitiveSceneInfo = PrimitiveComponent->SceneProxy->GetPrimitiveSceneInfo();
+		const bool bIndexValid = PrimitiveSceneInfo && PrimitiveSceneInfo->IsIndexValid();
+		// A proxy only gets custom depth once its scene info is in the scene, so that has to invalidate the registration too
+		SceneProxyHash = HashCombine(SceneProxyHash, HashCombine(GetTypeHash(PrimitiveComponent->SceneProxy), GetTypeHash(bIndexValid)));
+		if (bIndexValid)
+		{
+			Primitives.Emplace(PrimitiveSceneInfo, PrimitiveSceneInfo->GetIndex());
+		}
+	}
+
+	for (USceneComponent* Child : Component->GetAttachChildren())
+	{
+		if (Child != nullptr)
+		{
+			HashAndGatherLateUpdatePrimitives(Child, HierarchyHash, SceneProxyHash, Primitives);
+		}
+	}
+}
+
+void FStreamlineCameraManager::GatherRegisteredLateUpdatePrimitives(int64 FrameID, USceneComponent* RootComponent, const APlayerController* Player)
+{
+	// The scene infos still have to be looked up every frame, but the same walk tells whether anything got attached, detached
+	// or had its scene proxy recreated. Only then do the ignore list and custom depth setup get redone
+	FLateUpdateState& LateUpdateData = UpdateStates[FrameID % FramesInFlight];
+	uint32 HierarchyHash = GetTypeHash(Player);
+	uint32 SceneProxyHash = 0;
+	HashAndGatherLateUpdatePrimitives(RootComponent, HierarchyHash, SceneProxyHash, LateUpdateData.Primitives);
+
+	FLateUpdateRegistration& Registration = LateUpdateRegistration;
+	if (!Registration.bValid || Registration.RootComponent.Get() != RootComponent
+		|| Registration.HierarchyHash != HierarchyHash || Registration.SceneProxyHash != SceneProxyHash)
+	{
+		Registration.RootComponent = RootComponent;
+		Registration.HierarchyHash = HierarchyHash;
+		Registration.SceneProxyHash = SceneProxyHash;
+		Registration.CollisionParams = FCollisionQueryParams(SCENE_QUERY_STAT(CameraPen), false, Player);
+		GatherLateUpdatePrimitives(FrameID, RootComponent, Registration.CollisionParams);
+
+		// Deduplicates the ignore list once here rather than in every query using a copy of it
+		Registration.CollisionParams.GetIgnoredComponents();
+		Registration.bValid = true;
+	}
+
+	LateUpdateData.CollisionParams = Registration.CollisionParams;
+}
+
+bool FStreamlineCameraManager::CanSkipClipCorrectionSweep(int64 FrameID, const FVector& CameraStart, const FVector& CameraEnd) const
+{
+	if (!CVarStreamlineReflexClipCorrectionAsync.GetValueOnGameThread()
+		|| ClipCorrectionSweepResult->FrameID != static_cast<uint32>(FrameID - 1)
+		|| !ClipCorrectionSweepResult->bClear)
+	{
+		return false;
+	}
+
+	// The asynchronous sweep issued last frame only covers this frame's sweep if both ends of it lie inside the inflated capsule,
+	// a camera cut, teleport or sudden acceleration leaves it and has to be swept again
+	const FClipCorrectionSweepResult& Result = *ClipCorrectionSweepResult;
+	return FMath::PointDistToSegment(CameraStart, Result.Start, Result.End) <= Result.Inflation
+		&& FMath::PointDistToSegment(CameraEnd, Result.Start, Result.End) <= Result.Inflation;
+}
+
+void FStreamlineCameraManager::StartAsyncClipCorrectionSweep(int64 FrameID, UWorld* World, const FVector& CameraStart, const FVector& CameraEnd, const FCollisionQueryParams& CollisionParams)
+{
+	if (!CVarStreamlineReflexClipCorrectionAsync.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	// Next frame's camera starts about where this frame's prediction ends and moves about as far again, so inflating the radius
+	// by twice the predicted motion lets a clear result cover the next frame too. CanSkipClipCorrectionSweep checks it actually does
+	const float Inflation = 2.0f * static_cast<float>((CameraEnd - CameraStart).Size());
+	const FCollisionShape SphereShape = FCollisionShape::MakeSphere(CVarStreamlineReflexClipRadius.GetValueOnGameThread() + Inflation);
+
+	TWeakPtr<FClipCorrectionSweepResult, ESPMode::ThreadSafe> WeakResult = ClipCorrectionSweepResult;
+	FTraceDelegate SweepDelegate;
+	SweepDelegate.BindLambda([WeakResult, CameraStart, CameraEnd, Inflation](const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+	{
+		if (TSharedPtr<FClipCorrectionSweepResult, ESPMode::ThreadSafe> Result = WeakResult.Pin())
+		{
+			Result->FrameID = TraceDatum.UserData;
+			Result->bClear = FHitResult::GetFirstBlockingHit(TraceDatum.OutHits) == nullptr;
+			Result->Start = CameraStart;
+			Result->End = CameraEnd;
+			Result->Inflation = Inflation;
+		}
+	});
+
+	World->AsyncSweepByChannel(EAsyncTraceType::Single, CameraStart, CameraEnd, FQuat::Identity, ECC_Camera, SphereShape, CollisionParams,
+		FCollisionResponseParams::DefaultResponseParam, &SweepDelegate, static_cast<uint32>(FrameID));
+}
+
 void FStreamlineCameraManager::PreRenderViewFamily_RenderThread(FSceneViewFamily& InViewFamily, uint64 FrameID)
 {
 	check(IsInRenderingThread());
@@ -418,16 +538,24 @@ void FStreamlineCameraManager::LateUpdate_RenderThread(FSceneInterface* Scene, u
 	// Indices have changed, so we need to scan the entire scene for primitives that might still exist
 	if (bIndicesHaveChanged)
 	{
+		// Stop scanning once every primitive that wasn't processed above has been found
+		int32 NumPrimitivesToFind = 0;
+		for (const auto& PrimitivePair : LateUpdateData.Primitives)
+		{
+			NumPrimitivesToFind += PrimitivePair.Value >= 0 ? 1 : 0;
+		}
+
 		int32 Index = 0;
 		FPrimitiveSceneInfo* RetrievedSceneInfo;
 		RetrievedSceneInfo = Scene->GetPrimitiveSceneInfo(Index++);
-		while (RetrievedSceneInfo)
+		while (RetrievedSceneInfo && NumPrimitivesToFind > 0)
 		{
-			if (RetrievedSceneInfo->Proxy && LateUpdateData.Primitives.Contains(RetrievedSceneInfo) &&
-				LateUpdateData.Primitives[RetrievedSceneInfo] >= 0)
+			const int32* CachedIndex = LateUpdateData.Primitives.Find(RetrievedSceneInfo);
+			if (CachedIndex && *CachedIndex >= 0)
 			{
+				--NumPrimitivesToFind;
 #if WITH_LATE_UPDATE_MATRIX
-				if (CVarStreamlineReflexPredictiveRenderingLateUpdateMode.GetValueOnRenderThread() == 1)
+				if (RetrievedSceneInfo->Proxy && CVarStreamlineReflexPredictiveRenderingLateUpdateMode.GetValueOnRenderThread() == 1)
 				{
 					// TODO: ApplyLateUpdateTransform gets overriden. Needs to be a callback from RendererScene
 					RetrievedSceneInfo->Proxy->SetLateUpdateTransform(LateUpdateTransform);
@@ -618,14 +746,19 @@ void FStreamlineCameraManager::SetCameraData(const FSceneView& InView, uint64 Fr
 			const FVector CameraStart = -CurrentTranslation;
 			const FVector CameraEnd = -LateUpdateData.UpdatedWorldToView.GetOrigin();
 
-			FHitResult Hit;
-			FCollisionShape SphereShape = FCollisionShape::MakeSphere(CVarStreamlineReflexClipRadius.GetValueOnGameThread());
-
-			const bool bHit = LateUpdateData.World->SweepSingleByChannel(Hit, CameraStart, CameraEnd, FQuat::Identity, ECC_Camera, SphereShape, LateUpdateData.CollisionParams);
-			if (bHit)
+			if (!CanSkipClipCorrectionSweep(FrameID, CameraStart, CameraEnd))
 			{
-				LateUpdateData.UpdatedWorldToView.SetOrigin(-Hit.Location);
+				FHitResult Hit;
+				FCollisionShape SphereShape = FCollisionShape::MakeSphere(CVarStreamlineReflexClipRadius.GetValueOnGameThread());
+
+				const bool bHit = LateUpdateData.World->SweepSingleByChannel(Hit, CameraStart, CameraEnd, FQuat::Identity, ECC_Camera, SphereShape, LateUpdateData.CollisionParams);
+				if (bHit)
+				{
+					LateUpdateData.UpdatedWorldToView.SetOrigin(-Hit.Location);
+				}
 			}
+
+			StartAsyncClipCorrectionSweep(FrameID, LateUpdateData.World, CameraStart, CameraEnd, LateUpdateData.CollisionParams);
 		}
 
 		if (InView.IsPerspectiveProjection())
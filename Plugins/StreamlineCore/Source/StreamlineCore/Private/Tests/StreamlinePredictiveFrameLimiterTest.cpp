@@ -0,0 +1,200 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlinePredictiveFrameLimiter.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr double TargetInterval = 1.0 / 60.0;
+	// render thread and GPU after the game thread hands the frame off
+	constexpr double RenderLatency = 0.008;
+
+	// 9 ms game thread with noise, a slow load swing of +-2 ms and 3% spikes of 4-8 ms
+	struct FSimulatedFrameCost
+	{
+		FRandomStream Random{42};
+		int32 Frame = 0;
+
+		double Next()
+		{
+			double Cost = 0.009 + 0.002 * FMath::Sin(Frame++ * 0.01) + Random.FRandRange(-0.001f, 0.001f);
+			if (Random.GetFraction() < 0.03f)
+			{
+				Cost += Random.FRandRange(0.004f, 0.008f);
+			}
+			return FMath::Max(Cost, 0.001);
+		}
+	};
+
+	// sleeping wakes up 0-1 ms late with 2% hiccups of 2-4 ms, the spin after it is only late if the sleep overshot
+	struct FSimulatedWait
+	{
+		FRandomStream Random{7};
+
+		double SleepError()
+		{
+			return Random.FRandRange(0.0f, 0.001f) + (Random.GetFraction() < 0.02f ? Random.FRandRange(0.002f, 0.004f) : 0.0);
+		}
+
+		double Until(double Now, double Target, double SpinSeconds)
+		{
+			if (Target <= Now)
+			{
+				return Now;
+			}
+			const double Wake = Target - SpinSeconds > Now ? Target - SpinSeconds + SleepError() : Now;
+			return FMath::Max(Wake, Target);
+		}
+	};
+
+	struct FSimulatedFrames
+	{
+		TArray<double> Starts;
+		TArray<double> Ends;
+	};
+
+	// 60 Hz display in phase with GridPhase that shows the newest rendered frame at each vblank, returns the mean
+	// latency from a frame's start to its scanout and the share of vblanks that repeat the previous frame
+	void MeasureDisplayedLatency(const FSimulatedFrames& Frames, double GridPhase, double& OutMeanLatency, double& OutRepeatRatio)
+	{
+		const double FirstVblank = GridPhase + FMath::CeilToDouble((Frames.Ends[0] - GridPhase) / TargetInterval) * TargetInterval;
+		double LatencySum = 0.0;
+		int32 NumShown = 0;
+		int32 NumRepeats = 0;
+		int32 LastShown = INDEX_NONE;
+		int32 NextFrame = 0;
+		for (double Vblank = FirstVblank; Vblank < Frames.Ends.Last(); Vblank += TargetInterval)
+		{
+			while (NextFrame < Frames.Ends.Num() && Frames.Ends[NextFrame] + RenderLatency <= Vblank + 1e-9)
+			{
+				++NextFrame;
+			}
+			if (NextFrame == 0 || NextFrame - 1 == LastShown)
+			{
+				NumRepeats += LastShown != INDEX_NONE ? 1 : 0;
+				continue;
+			}
+			LastShown = NextFrame - 1;
+			LatencySum += Vblank - Frames.Starts[LastShown];
+			++NumShown;
+		}
+		OutMeanLatency = NumShown > 0 ? LatencySum / NumShown : 0.0;
+		OutRepeatRatio = NumShown > 0 ? double(NumRepeats) / (NumShown + NumRepeats) : 1.0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPredictiveFrameLimiterScheduleTest, "Streamline.Reflex.PredictiveFrameLimiter.Schedule", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FPredictiveFrameLimiterScheduleTest::RunTest(const FString& Parameters)
+{
+	FStreamlinePredictiveFrameLimiter::FSettings Settings;
+	Settings.Percentile = 1.0;
+	Settings.MarginSeconds = 0.0;
+
+	FStreamlinePredictiveFrameLimiter Limiter;
+	TestEqual(TEXT("First frame starts right away"), Limiter.ScheduleNextFrame(1.0, TargetInterval, Settings), 1.0);
+
+	// the vendor sleep holds the frame for another 2 ms, that isn't part of the frame's cost
+	Limiter.OnFrameStarted(1.002);
+	Limiter.ScheduleNextFrame(1.006, TargetInterval, Settings);
+	TestEqual(TEXT("Cost is measured from the reported start"), Limiter.PredictFrameCost(Settings), 0.004, 1e-9);
+	TestEqual(TEXT("Deadline follows the first one by one interval"), Limiter.GetLastFrameDeadline(), 1.0 + TargetInterval, 1e-9);
+
+	// no start reported, so nothing gets measured but the cadence carries on
+	Limiter.ScheduleNextFrame(1.020, TargetInterval, Settings);
+	TestEqual(TEXT("Frames without a start aren't measured"), Limiter.PredictFrameCost(Settings), 0.004, 1e-9);
+
+	// a 50 ms frame skips to the first deadline that can still be made instead of catching up
+	Limiter.OnFrameStarted(1.020);
+	const double StartAfterLongFrame = Limiter.ScheduleNextFrame(1.070, TargetInterval, Settings);
+	TestEqual(TEXT("Deadline after a long frame stays on the cadence"), Limiter.GetLastFrameDeadline(), 1.0 + 8 * TargetInterval, 1e-9);
+	TestEqual(TEXT("Frame after a long one is budgeted for another long one"), StartAfterLongFrame, 1.0 + 8 * TargetInterval - 0.05, 1e-9);
+
+	TestEqual(TEXT("Zero interval disables limiting"), Limiter.ScheduleNextFrame(1.2, 0.0, Settings), 1.2);
+	TestEqual(TEXT("Zero interval forgets the history"), Limiter.PredictFrameCost(Settings), 0.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPredictiveFrameLimiterSimulationTest, "Streamline.Reflex.PredictiveFrameLimiter.SimulatedClock", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FPredictiveFrameLimiterSimulationTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFrames = 20000;
+	const FStreamlinePredictiveFrameLimiter::FSettings Settings;
+
+	// baseline: every frame starts one interval after the previous one
+	FSimulatedFrames Cadence;
+	{
+		FSimulatedFrameCost Cost;
+		FSimulatedWait Wait;
+		double Now = 0.0;
+		double NextStart = 0.0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			NextStart = FMath::Max(NextStart + TargetInterval, Now);
+			const double Start = Wait.Until(Now, NextStart, Settings.SpinSeconds);
+			Now = Start + Cost.Next();
+			Cadence.Starts.Add(Start);
+			Cadence.Ends.Add(Now);
+		}
+	}
+
+	FSimulatedFrames Predictive;
+	double FirstDeadline = 0.0;
+	bool bDeadlinesOnGrid = true;
+	{
+		FSimulatedFrameCost Cost;
+		FSimulatedWait Wait;
+		FRandomStream VendorSleep(3);
+		FStreamlinePredictiveFrameLimiter Limiter;
+		double Now = 0.0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const double TargetStart = Limiter.ScheduleNextFrame(Now, TargetInterval, Settings);
+			if (Frame == 0)
+			{
+				FirstDeadline = Limiter.GetLastFrameDeadline();
+			}
+			const double Intervals = (Limiter.GetLastFrameDeadline() - FirstDeadline) / TargetInterval;
+			bDeadlinesOnGrid &= FMath::Abs(Intervals - FMath::RoundToDouble(Intervals)) < 1e-6;
+
+			// the vendor sleep returns shortly after the limiter lets the frame go
+			const double Start = Wait.Until(Now, TargetStart, Settings.SpinSeconds) + VendorSleep.FRandRange(0.0f, 0.0005f);
+			Limiter.OnFrameStarted(Start);
+			Now = Start + Cost.Next();
+			Predictive.Starts.Add(Start);
+			Predictive.Ends.Add(Now);
+		}
+	}
+
+	TestTrue(TEXT("Deadlines stay on the cadence of the first one"), bDeadlinesOnGrid);
+
+	double CadenceLatency, CadenceRepeats;
+	MeasureDisplayedLatency(Cadence, Cadence.Starts[0] + RenderLatency, CadenceLatency, CadenceRepeats);
+	double PredictiveLatency, PredictiveRepeats;
+	MeasureDisplayedLatency(Predictive, FirstDeadline + RenderLatency, PredictiveLatency, PredictiveRepeats);
+
+	AddInfo(FString::Printf(TEXT("Start cadence: latency %.2f ms, repeats %.1f%%"), CadenceLatency * 1000.0, CadenceRepeats * 100.0));
+	AddInfo(FString::Printf(TEXT("Predictive: latency %.2f ms, repeats %.1f%%"), PredictiveLatency * 1000.0, PredictiveRepeats * 100.0));
+
+	// starting late has to buy real latency on a display in phase with the limiter without dropping more frames
+	TestTrue(TEXT("Predictive limiter cuts the displayed latency by at least 3 ms"), PredictiveLatency + 0.003 < CadenceLatency);
+	TestTrue(TEXT("Predictive limiter repeats at most as many frames as the start cadence plus 1%"), PredictiveRepeats <= CadenceRepeats + 0.01);
+
+	return true;
+}
+
+#endif
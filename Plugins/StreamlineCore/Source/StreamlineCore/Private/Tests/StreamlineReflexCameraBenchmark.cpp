@@ -0,0 +1,150 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineReflexCamera.h"
+
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Game thread cost of finding the primitives attached to the view target, with the registration kept across frames and with
+// the ignore list and custom depth setup rebuilt every frame. The view target carries 10k movable primitives in 100 groups,
+// a few of them move every frame and one gets detached and attached again now and then
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineLateUpdatePrimitivesBenchmark, "Streamline.Reflex.LateUpdatePrimitivesBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FStreamlineLateUpdatePrimitivesBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumGroups = 100;
+	static constexpr int32 NumPrimitivesPerGroup = 100;
+	static constexpr int32 NumPrimitives = NumGroups * NumPrimitivesPerGroup;
+	static constexpr int32 NumFrames = 200;
+	static constexpr int32 NumMovesPerFrame = 64;
+	static constexpr int32 FramesPerReattach = 50;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Transient world"), World))
+	{
+		return false;
+	}
+
+	USceneComponent* RootComponent = NewObject<USceneComponent>(World);
+	RootComponent->SetMobility(EComponentMobility::Movable);
+	RootComponent->RegisterComponentWithWorld(World);
+
+	TArray<USceneComponent*> Groups;
+	TArray<UBoxComponent*> Primitives;
+	Primitives.Reserve(NumPrimitives);
+	for (int32 GroupIndex = 0; GroupIndex < NumGroups; ++GroupIndex)
+	{
+		USceneComponent* Group = NewObject<USceneComponent>(World);
+		Group->SetMobility(EComponentMobility::Movable);
+		Group->SetupAttachment(RootComponent);
+		Group->RegisterComponentWithWorld(World);
+		Groups.Add(Group);
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < NumPrimitivesPerGroup; ++PrimitiveIndex)
+		{
+			UBoxComponent* Primitive = NewObject<UBoxComponent>(World);
+			Primitive->SetMobility(EComponentMobility::Movable);
+			// Shapes are hidden in game by default and then don't get a scene proxy
+			Primitive->SetHiddenInGame(false);
+			Primitive->SetRelativeLocation(FVector(PrimitiveIndex, GroupIndex, 0.0));
+			Primitive->SetupAttachment(Group);
+			Primitive->RegisterComponentWithWorld(World);
+			Primitives.Add(Primitive);
+		}
+	}
+
+	int32 NumSceneProxies = 0;
+	for (UBoxComponent* Primitive : Primitives)
+	{
+		NumSceneProxies += Primitive->SceneProxy ? 1 : 0;
+	}
+
+	FStreamlineCameraManager CameraManager;
+	auto RunFrames = [&CameraManager, &Primitives, RootComponent](bool bCached, int32& OutNumIgnoredComponents)
+	{
+		double GatherSeconds = 0.0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 MoveIndex = 0; MoveIndex < NumMovesPerFrame; ++MoveIndex)
+			{
+				UBoxComponent* Primitive = Primitives[(Frame * NumMovesPerFrame + MoveIndex) % NumPrimitives];
+				Primitive->AddRelativeLocation(FVector(0.0, 0.0, (Frame & 1) ? 1.0 : -1.0));
+			}
+			if (Frame % FramesPerReattach == FramesPerReattach - 1)
+			{
+				UBoxComponent* Primitive = Primitives[Frame % NumPrimitives];
+				USceneComponent* Parent = Primitive->GetAttachParent();
+				Primitive->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+				Primitive->AttachToComponent(Parent, FAttachmentTransformRules::KeepRelativeTransform);
+			}
+
+			// what LateUpdate_GameThread does for the view target
+			const double StartTime = FPlatformTime::Seconds();
+			FStreamlineCameraManager::FLateUpdateState& LateUpdateData = CameraManager.UpdateStates[Frame % FStreamlineCameraManager::FramesInFlight];
+			LateUpdateData.FrameID = Frame;
+			LateUpdateData.Primitives.Reset();
+			if (bCached)
+			{
+				CameraManager.GatherRegisteredLateUpdatePrimitives(Frame, RootComponent, nullptr);
+			}
+			else
+			{
+				CameraManager.LateUpdateRegistration.bValid = false;
+				LateUpdateData.CollisionParams = FCollisionQueryParams(SCENE_QUERY_STAT(CameraPen), false, nullptr);
+				CameraManager.GatherLateUpdatePrimitives(Frame, RootComponent, LateUpdateData.CollisionParams);
+			}
+			GatherSeconds += FPlatformTime::Seconds() - StartTime;
+
+			OutNumIgnoredComponents = LateUpdateData.CollisionParams.GetIgnoredComponents().Num();
+		}
+		return GatherSeconds;
+	};
+
+	int32 NumIgnoredUncached = 0;
+	int32 NumIgnoredCached = 0;
+	const double UncachedSeconds = RunFrames(false, NumIgnoredUncached);
+	const double CachedSeconds = RunFrames(true, NumIgnoredCached);
+
+	AddInfo(FString::Printf(TEXT("%d primitives, %d with a scene proxy, %d late update primitives in the scene"),
+		NumPrimitives, NumSceneProxies, CameraManager.UpdateStates[(NumFrames - 1) % FStreamlineCameraManager::FramesInFlight].Primitives.Num()));
+	AddInfo(FString::Printf(TEXT("Game thread per frame: %.3f ms rebuilt every frame, %.3f ms with the registration kept across frames"),
+		UncachedSeconds * 1000.0 / NumFrames, CachedSeconds * 1000.0 / NumFrames));
+
+	TestEqual(TEXT("Every primitive with a scene proxy is ignored by the rebuilt collision query"), NumIgnoredUncached, NumSceneProxies);
+	TestEqual(TEXT("Every primitive with a scene proxy is ignored by the kept collision query"), NumIgnoredCached, NumSceneProxies);
+
+	// a detached primitive leaves the kept registration on the next frame
+	Primitives[0]->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+	CameraManager.UpdateStates[NumFrames % FStreamlineCameraManager::FramesInFlight].Primitives.Reset();
+	CameraManager.GatherRegisteredLateUpdatePrimitives(NumFrames, RootComponent, nullptr);
+	TestEqual(TEXT("Detached primitive is no longer ignored"),
+		CameraManager.UpdateStates[NumFrames % FStreamlineCameraManager::FramesInFlight].CollisionParams.GetIgnoredComponents().Num(), NumSceneProxies - (Primitives[0]->SceneProxy ? 1 : 0));
+
+	// the components have no owning actor, so cleaning up the world wouldn't unregister them
+	for (UBoxComponent* Primitive : Primitives)
+	{
+		Primitive->UnregisterComponent();
+	}
+	for (USceneComponent* Group : Groups)
+	{
+		Group->UnregisterComponent();
+	}
+	RootComponent->UnregisterComponent();
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineReflex.h"
+#include "Misc/AutomationTest.h"
+
+#include "sl_reflex.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// a frame that starts simulating at StartUs and takes 20 ms to get through the GPU, or is still in flight
+	sl::ReflexReport MakeSyntheticReport(uint64 FrameID, uint64 StartUs, bool bComplete)
+	{
+		sl::ReflexReport Report{};
+		Report.frameID = FrameID;
+		Report.simStartTime = StartUs;
+		Report.simEndTime = StartUs + 4000;
+		Report.renderSubmitStartTime = StartUs + 4000;
+		Report.renderSubmitEndTime = StartUs + 7000;
+		Report.presentStartTime = StartUs + 7000;
+		Report.presentEndTime = StartUs + 7500;
+		Report.driverStartTime = StartUs + 7500;
+		Report.driverEndTime = StartUs + 8000;
+		Report.osRenderQueueStartTime = StartUs + 8000;
+		Report.osRenderQueueEndTime = StartUs + 10000;
+		Report.gpuRenderStartTime = bComplete ? StartUs + 10000 : 0;
+		Report.gpuRenderEndTime = bComplete ? StartUs + 20000 : 0;
+		return Report;
+	}
+
+	void FillSyntheticReports(TArray<sl::ReflexReport>& Reports, uint64 LastFrameID, uint64 FirstIncompleteFrameID)
+	{
+		// 64 reports like slReflexGetState, oldest first, slots before the first frame stay empty
+		Reports.SetNumZeroed(64);
+		for (int32 Index = 0; Index < Reports.Num(); ++Index)
+		{
+			const int64 FrameID = int64(LastFrameID) - (Reports.Num() - 1 - Index);
+			if (FrameID > 0)
+			{
+				Reports[Index] = MakeSyntheticReport(FrameID, FrameID * 16667, uint64(FrameID) < FirstIncompleteFrameID);
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineReflexLatencyReportTest, "Streamline.Reflex.LatencyReports", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineReflexLatencyReportTest::RunTest(const FString& Parameters)
+{
+	FStreamlineLatencyMarkers LatencyMarkers;
+	TArray<sl::ReflexReport> Reports;
+
+	// frames 6 and later are still on the GPU, a finished frame 7 must not get frame 6 skipped
+	FillSyntheticReports(Reports, 10, 6);
+	Reports.Last() = MakeSyntheticReport(10, 10 * 16667, true);
+	TestEqual(TEXT("Frames consumed up to the first incomplete one"), LatencyMarkers.ConsumeFrameReports(Reports), 5);
+	TestEqual(TEXT("Samples after the first tick"), LatencyMarkers.GetNumLatencySamples(), uint64(5));
+
+	// the same reports again add nothing
+	TestEqual(TEXT("Frames consumed from an unchanged report"), LatencyMarkers.ConsumeFrameReports(Reports), 0);
+
+	// once they complete the frames held back are picked up along with the new ones
+	FillSyntheticReports(Reports, 12, 13);
+	TestEqual(TEXT("Frames consumed once the GPU caught up"), LatencyMarkers.ConsumeFrameReports(Reports), 7);
+	TestEqual(TEXT("Samples after the second tick"), LatencyMarkers.GetNumLatencySamples(), uint64(12));
+
+	TestEqual(TEXT("Total latency p50"), LatencyMarkers.GetLatencyPercentileInMs(EStreamlineLatencyStage::Total, 0.5f), 20.0f, FStreamlineLatencyHistogram::BucketWidthMs);
+	TestEqual(TEXT("GPU render latency p99"), LatencyMarkers.GetLatencyPercentileInMs(EStreamlineLatencyStage::GPURender, 0.99f), 10.0f, FStreamlineLatencyHistogram::BucketWidthMs);
+
+	// frame IDs going backwards means SL restarted counting, those frames are new
+	FillSyntheticReports(Reports, 3, 4);
+	TestEqual(TEXT("Frames consumed after the frame IDs restarted"), LatencyMarkers.ConsumeFrameReports(Reports), 3);
+	TestEqual(TEXT("Samples after the restart"), LatencyMarkers.GetNumLatencySamples(), uint64(15));
+
+	return true;
+}
+
+#endif
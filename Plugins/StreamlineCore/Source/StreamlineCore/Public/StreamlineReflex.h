@@ -21,6 +21,7 @@
 #include "Performance/LatencyMarkerModule.h"
 
 class FStreamlineRHI;
+class FStreamlinePredictiveFrameLimiter;
 
 class FStreamlineLatencyBase
 {
@@ -56,7 +57,8 @@ public:
 		
 	};
 
-	virtual ~FStreamlineMaxTickRateHandler() {}
+	FStreamlineMaxTickRateHandler();
+	virtual ~FStreamlineMaxTickRateHandler();
 
 	virtual void Initialize() override;
 	virtual void SetEnabled(bool bInEnabled) override;
@@ -77,6 +79,50 @@ public:
 private:
 
 	static TUniquePtr<FStreamlineMaxTickRateHandler> StreamlineMaxTickRateHandler;
+
+	TUniquePtr<FStreamlinePredictiveFrameLimiter> FrameLimiter;
+	double LastRealTimeAfterSleep = 0.0;
+};
+
+namespace sl
+{
+	struct ReflexReport;
+}
+
+// Stages of the Reflex frame reports that FStreamlineLatencyMarkers keeps latency histograms for
+enum class EStreamlineLatencyStage : uint8
+{
+	Total,
+	Simulation,
+	RenderSubmit,
+	Present,
+	Driver,
+	OSRenderQueue,
+	GPURender,
+	Num
+};
+
+STREAMLINECORE_API const TCHAR* LexToString(EStreamlineLatencyStage Stage);
+
+// Fixed resolution latency histogram. Latencies past the last bucket are counted in the last bucket
+class STREAMLINECORE_API FStreamlineLatencyHistogram
+{
+public:
+	static constexpr int32 NumBuckets = 2000;
+	static constexpr float BucketWidthMs = 0.1f;
+
+	void AddSample(float LatencyMs);
+	void Reset();
+
+	// Percentile in [0, 1], returns the center of the bucket the percentile falls into or 0 without samples
+	float GetPercentileMs(float Percentile) const;
+	uint64 GetNumSamples() const { return NumSamples; }
+	uint32 GetBucketCount(int32 Bucket) const { return Buckets.IsValidIndex(Bucket) ? Buckets[Bucket] : 0; }
+
+private:
+	// allocated on the first sample so unused histograms stay small
+	TArray<uint32> Buckets;
+	uint64 NumSamples = 0;
 };
 
 class FStreamlineLatencyMarkers : public ILatencyMarkerModule, public IWindowsMessageHandler, public FStreamlineLatencyBase, public FTickableGameObject
@@ -100,6 +146,13 @@ class FStreamlineLatencyMarkers : public ILatencyMarkerModule, public IWindowsMe
 
 
 	bool bFlashIndicatorDriverControlled = false;
+
+	// frameID of the newest frame report that went into the averages and histograms
+	uint64 LastReportedFrameID = 0;
+	FStreamlineLatencyHistogram LatencyHistograms[int32(EStreamlineLatencyStage::Num)];
+
+	void AccumulateFrameReport(const sl::ReflexReport& Report);
+	void ResetLatencyStats();
 public:
 
 	virtual ~FStreamlineLatencyMarkers() {}
@@ -150,6 +203,17 @@ public:
 	virtual float GetOSRenderQueueOffsetFromFrameStartInMs() override { return OSRenderQueueOffsetMs; }
 	virtual float GetGPURenderOffsetFromFrameStartInMs() override { return GPURenderOffsetMs; }
 
+	// Percentiles over all frame reports since the last reset, Percentile in [0, 1]
+	STREAMLINECORE_API float GetLatencyPercentileInMs(EStreamlineLatencyStage Stage, float Percentile) const;
+	STREAMLINECORE_API uint64 GetNumLatencySamples() const;
+	STREAMLINECORE_API void ResetLatencyHistograms();
+
+	// Feeds the frame reports of one slReflexGetState, oldest first, into the averages and histograms. Returns how many were new
+	int32 ConsumeFrameReports(TArrayView<const sl::ReflexReport> FrameReports);
+
+	// Writes one row per histogram bucket with the sample count of each stage
+	STREAMLINECORE_API bool ExportLatencyHistogramsToCSV(const FString& Filename) const;
+
 	// Inherited via IWindowsMessageHandler
 	virtual bool ProcessMessage(HWND hwnd, uint32 msg, WPARAM wParam, LPARAM lParam, int32& OutResult) override;
 
@@ -33,8 +33,13 @@ public:
 	void PreRenderView_RenderThread(FSceneView& InView, uint64 FrameID);
 	void PostRenderView_RenderThread(FSceneView& InView, uint64 FrameID);
 private:
+	friend class FStreamlineLateUpdatePrimitivesBenchmark;
+
 	void CacheSceneInfo(int64 FrameID, USceneComponent* Component, FCollisionQueryParams& CollisionParams);
 	void GatherLateUpdatePrimitives(int64 FrameID, USceneComponent* ParentComponent, FCollisionQueryParams& CollisionParams);
+	void GatherRegisteredLateUpdatePrimitives(int64 FrameID, USceneComponent* RootComponent, const APlayerController* Player);
+	bool CanSkipClipCorrectionSweep(int64 FrameID, const FVector& CameraStart, const FVector& CameraEnd) const;
+	void StartAsyncClipCorrectionSweep(int64 FrameID, UWorld* World, const FVector& CameraStart, const FVector& CameraEnd, const FCollisionQueryParams& CollisionParams);
 	void LateUpdate_RenderThread(FSceneInterface* Scene, uint64 FrameID, const FMatrix& LateUpdateTransform);
 
 	struct FLateUpdateState
@@ -59,8 +64,35 @@ private:
 		float HFov;
 	};
 
+	/** What GatherLateUpdatePrimitives produced for the view target, reused until components get attached, detached or change scene proxy */
+	struct FLateUpdateRegistration
+	{
+		TWeakObjectPtr<USceneComponent> RootComponent;
+		/** Hash of the player and of every component attached below the root */
+		uint32 HierarchyHash = 0;
+		/** Hash of the scene proxies of those components */
+		uint32 SceneProxyHash = 0;
+		bool bValid = false;
+		/** Ignores the player and every attached primitive with a scene proxy, already deduplicated */
+		FCollisionQueryParams CollisionParams;
+	};
+
+	/** Outcome of the last asynchronous clip correction sweep, shared with the trace delegate which can outlive us */
+	struct FClipCorrectionSweepResult
+	{
+		uint32 FrameID = 0;
+		bool bClear = false;
+		/** Swept segment and how far the sphere radius was inflated beyond the clip radius */
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		float Inflation = 0.0f;
+	};
+
 	FMatrix PrevRenderedWorldToView, PrevRenderedViewToClip;
 
+	FLateUpdateRegistration LateUpdateRegistration;
+	TSharedRef<FClipCorrectionSweepResult, ESPMode::ThreadSafe> ClipCorrectionSweepResult = MakeShared<FClipCorrectionSweepResult, ESPMode::ThreadSafe>();
+
 	const static size_t FramesInFlight = 3;
 	FLateUpdateState UpdateStates[FramesInFlight];
 
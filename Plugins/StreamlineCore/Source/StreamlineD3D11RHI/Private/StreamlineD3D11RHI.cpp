@@ -217,7 +217,10 @@ public:
 			// when removing this deprecated path, we only need to keep the else block
 			if (ShouldUseSlSetTag())
 			{
-				SLsetTag(sl::ViewportHandle(InViewID), &Tag, 1, NativeCmdBuffer);
+				if (RemoveRedundantNullTags(InViewID, &Tag, 1) > 0)
+				{
+					SLsetTag(sl::ViewportHandle(InViewID), &Tag, 1, NativeCmdBuffer);
+				}
 			}
 			else
 			{
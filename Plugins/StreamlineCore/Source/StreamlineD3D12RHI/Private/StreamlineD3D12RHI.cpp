@@ -479,7 +479,11 @@ public:
 			// when removing this deprecated path, we only need to keep the else block
 			if (ShouldUseSlSetTag())
 			{
-				SLsetTag(sl::ViewportHandle(InViewID), SLTags.GetData(), SLTags.Num(), GetNativeCommandList(CmdList, InResources));
+				const int32 NumTagsToSet = RemoveRedundantNullTags(InViewID, SLTags.GetData(), SLTags.Num());
+				if (NumTagsToSet > 0)
+				{
+					SLsetTag(sl::ViewportHandle(InViewID), SLTags.GetData(), NumTagsToSet, GetNativeCommandList(CmdList, InResources));
+				}
 			}
 			else
 			{
@@ -46,6 +46,14 @@ static FAutoConsoleVariableRef CVarStreamlieeLogLevel(
 	ECVF_Default);
 
 
+// Calls into SL per frame, e.g. "stat StreamlineAPI" to see how many tags and constants get set each frame
+DECLARE_DWORD_COUNTER_STAT(TEXT("slSetTag calls"), STAT_StreamlineSetTagCalls, STATGROUP_StreamlineAPI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("slSetTagForFrame calls"), STAT_StreamlineSetTagForFrameCalls, STATGROUP_StreamlineAPI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Resource tags set"), STAT_StreamlineResourceTags, STATGROUP_StreamlineAPI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("slSetConstants calls"), STAT_StreamlineSetConstantsCalls, STATGROUP_StreamlineAPI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("slEvaluateFeature calls"), STAT_StreamlineEvaluateFeatureCalls, STATGROUP_StreamlineAPI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("slGetNewFrameToken calls"), STAT_StreamlineGetNewFrameTokenCalls, STATGROUP_StreamlineAPI);
+
 bool LogStreamlineFunctions()
 {
 #if LOG_SL_FUNCTIONS
@@ -158,6 +166,8 @@ namespace
 	PFun_slSetD3DDevice* Ptr_setD3DDevice = nullptr;
 
 	bool bIsStreamlineFunctionPointersLoaded = false;
+	// the function pointers point at StreamlineMockAPI.cpp instead of the interposer
+	bool bIsStreamlineMockLoaded = false;
 }
 
 FString CurrentThreadName()
@@ -217,7 +227,7 @@ sl::Result SLinit(const sl::Preferences& pref, uint64_t sdkVersion)
 {
 	// we cannot call IsStreamlineSupported since that checks whether bIsStreamlineInitialized is set to true, which it will with the result of this call
 	check(AreStreamlineFunctionsLoaded());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_init != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -233,7 +243,7 @@ sl::Result SLinit(const sl::Preferences& pref, uint64_t sdkVersion)
 sl::Result SLshutdown()
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_shutdown != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -249,7 +259,7 @@ sl::Result SLshutdown()
 sl::Result SLisFeatureSupported(sl::Feature feature, const sl::AdapterInfo& adapterInfo)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_isFeatureSupported != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -266,7 +276,7 @@ sl::Result SLisFeatureSupported(sl::Feature feature, const sl::AdapterInfo& adap
 sl::Result SLisFeatureLoaded(sl::Feature feature, bool& loaded)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_isFeatureLoaded != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -283,7 +293,7 @@ sl::Result SLisFeatureLoaded(sl::Feature feature, bool& loaded)
 sl::Result SLsetFeatureLoaded(sl::Feature feature, bool loaded)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_setFeatureLoaded != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -380,7 +390,7 @@ namespace sl
 sl::Result SLevaluateFeature(sl::Feature feature, const sl::FrameToken& frame, const sl::BaseStructure** inputs, uint32_t numInputs, sl::CommandBuffer* cmdBuffer)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_evaluateFeature != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -401,13 +411,14 @@ sl::Result SLevaluateFeature(sl::Feature feature, const sl::FrameToken& frame, c
 	}
 #endif
 
+	INC_DWORD_STAT(STAT_StreamlineEvaluateFeatureCalls);
 	return Ptr_evaluateFeature(feature, frame, inputs, numInputs, cmdBuffer);
 }
 
 sl::Result SLAllocateResources(sl::CommandBuffer* cmdBuffer, sl::Feature feature, const sl::ViewportHandle& viewport)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_allocateResources != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -424,7 +435,7 @@ sl::Result SLAllocateResources(sl::CommandBuffer* cmdBuffer, sl::Feature feature
 sl::Result SLFreeResources(sl::Feature feature, const sl::ViewportHandle& viewport)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_freeResources != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -441,7 +452,7 @@ sl::Result SLFreeResources(sl::Feature feature, const sl::ViewportHandle& viewpo
 sl::Result SLsetTag(const sl::ViewportHandle& viewport, const sl::ResourceTag* tags, uint32_t numTags, sl::CommandBuffer* cmdBuffer)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_setTag != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -467,13 +478,15 @@ sl::Result SLsetTag(const sl::ViewportHandle& viewport, const sl::ResourceTag* t
 	}
 #endif
 
+	INC_DWORD_STAT(STAT_StreamlineSetTagCalls);
+	INC_DWORD_STAT_BY(STAT_StreamlineResourceTags, numTags);
 	return Ptr_setTag(viewport, tags, numTags, cmdBuffer);
 }
 
 sl::Result SLsetTagForFrame(const sl::FrameToken& frame, const sl::ViewportHandle& viewport, const sl::ResourceTag* tags, uint32_t numTags, sl::CommandBuffer* cmdBuffer)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_setTagForFrame != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -499,13 +512,15 @@ sl::Result SLsetTagForFrame(const sl::FrameToken& frame, const sl::ViewportHandl
 	}
 #endif
 
+	INC_DWORD_STAT(STAT_StreamlineSetTagForFrameCalls);
+	INC_DWORD_STAT_BY(STAT_StreamlineResourceTags, numTags);
 	return Ptr_setTagForFrame(frame, viewport, tags, numTags, cmdBuffer);
 }
 
 sl::Result SLgetFeatureRequirements(sl::Feature feature, sl::FeatureRequirements& requirements)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_getFeatureRequirements != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -522,7 +537,7 @@ sl::Result SLgetFeatureRequirements(sl::Feature feature, sl::FeatureRequirements
 sl::Result SLgetFeatureVersion(sl::Feature feature, sl::FeatureVersion& version)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_getFeatureVersion != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -539,7 +554,7 @@ sl::Result SLgetFeatureVersion(sl::Feature feature, sl::FeatureVersion& version)
 sl::Result SLUpgradeInterface(void** baseInterface)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_upgradeInterface != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -555,7 +570,7 @@ sl::Result SLUpgradeInterface(void** baseInterface)
 sl::Result SLsetConstants(const sl::Constants& values, const sl::FrameToken& frame, const sl::ViewportHandle& viewport)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_setConstants != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -567,13 +582,14 @@ sl::Result SLsetConstants(const sl::Constants& values, const sl::FrameToken& fra
 			static_cast<uint32_t>(viewport));
 	}
 #endif
+	INC_DWORD_STAT(STAT_StreamlineSetConstantsCalls);
 	return Ptr_setConstants(values, frame, viewport);
 }
 
 sl::Result SLgetNativeInterface(void* proxyInterface, void** baseInterface)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_getNativeInterface != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -589,7 +605,7 @@ sl::Result SLgetNativeInterface(void* proxyInterface, void** baseInterface)
 sl::Result SLgetFeatureFunction(sl::Feature feature, const char* functionName, void*& function)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_getFeatureFunction != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -606,7 +622,7 @@ sl::Result SLgetFeatureFunction(sl::Feature feature, const char* functionName, v
 sl::Result SLgetNewFrameToken(sl::FrameToken*& token, uint32_t* frameIndex)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_getNewFrameToken != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -626,13 +642,14 @@ sl::Result SLgetNewFrameToken(sl::FrameToken*& token, uint32_t* frameIndex)
 	}
 #endif
 
+	INC_DWORD_STAT(STAT_StreamlineGetNewFrameTokenCalls);
 	return Ptr_getNewFrameToken(token, frameIndex);
 }
 
 sl::Result SLsetD3DDevice(void* d3dDevice)
 {
 	check(IsStreamlineSupported());
-	check(SLInterPoserDLL);
+	check(SLInterPoserDLL || bIsStreamlineMockLoaded);
 	check(Ptr_setD3DDevice != nullptr);
 
 #if LOG_SL_FUNCTIONS
@@ -750,5 +767,74 @@ bool LoadStreamlineFunctionPointers(const FString& InterposerBinaryPath)
 	return bIsStreamlineFunctionPointersLoaded;
 }
 
+#if STREAMLINE_MOCK_API
+bool LoadStreamlineMockFunctionPointers()
+{
+	if (!bIsStreamlineFunctionPointersLoaded)
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("loading core Streamline functions from the CPU mock, nothing is rendered by Streamline features"));
+
+		Ptr_init = &StreamlineMock::Init;
+		Ptr_shutdown = &StreamlineMock::Shutdown;
+		Ptr_isFeatureSupported = &StreamlineMock::IsFeatureSupported;
+		Ptr_isFeatureLoaded = &StreamlineMock::IsFeatureLoaded;
+		Ptr_setFeatureLoaded = &StreamlineMock::SetFeatureLoaded;
+		Ptr_evaluateFeature = &StreamlineMock::EvaluateFeature;
+		Ptr_allocateResources = &StreamlineMock::AllocateResources;
+		Ptr_freeResources = &StreamlineMock::FreeResources;
+		Ptr_setTag = &StreamlineMock::SetTag;
+		Ptr_setTagForFrame = &StreamlineMock::SetTagForFrame;
+		Ptr_getFeatureRequirements = &StreamlineMock::GetFeatureRequirements;
+		Ptr_getFeatureVersion = &StreamlineMock::GetFeatureVersion;
+		Ptr_upgradeInterface = &StreamlineMock::UpgradeInterface;
+		Ptr_setConstants = &StreamlineMock::SetConstants;
+		Ptr_getNativeInterface = &StreamlineMock::GetNativeInterface;
+		Ptr_getFeatureFunction = &StreamlineMock::GetFeatureFunction;
+		Ptr_getNewFrameToken = &StreamlineMock::GetNewFrameToken;
+		Ptr_setD3DDevice = &StreamlineMock::SetD3DDevice;
+
+		bIsStreamlineMockLoaded = true;
+		bIsStreamlineFunctionPointersLoaded = true;
+	}
+
+	return bIsStreamlineMockLoaded;
+}
+
+void UnloadStreamlineMockFunctionPointers()
+{
+	if (!bIsStreamlineMockLoaded)
+	{
+		return;
+	}
+
+	Ptr_init = nullptr;
+	Ptr_shutdown = nullptr;
+	Ptr_isFeatureSupported = nullptr;
+	Ptr_isFeatureLoaded = nullptr;
+	Ptr_setFeatureLoaded = nullptr;
+	Ptr_evaluateFeature = nullptr;
+	Ptr_allocateResources = nullptr;
+	Ptr_freeResources = nullptr;
+	Ptr_setTag = nullptr;
+	Ptr_setTagForFrame = nullptr;
+	Ptr_getFeatureRequirements = nullptr;
+	Ptr_getFeatureVersion = nullptr;
+	Ptr_upgradeInterface = nullptr;
+	Ptr_setConstants = nullptr;
+	Ptr_getNativeInterface = nullptr;
+	Ptr_getFeatureFunction = nullptr;
+	Ptr_getNewFrameToken = nullptr;
+	Ptr_setD3DDevice = nullptr;
+
+	bIsStreamlineMockLoaded = false;
+	bIsStreamlineFunctionPointersLoaded = false;
+}
+
+bool IsStreamlineMockLoaded()
+{
+	return bIsStreamlineMockLoaded;
+}
+#endif
+
 #undef LOCTEXT_NAMESPACE
 
@@ -0,0 +1,520 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineRHIPrivate.h"
+
+#if STREAMLINE_MOCK_API
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+#include "sl_helpers.h"
+#include "sl_dlss_g.h"
+#include "sl_deepdvc.h"
+#include "sl_pcl.h"
+#include "sl_reflex.h"
+#if WITH_LATEWARP
+#include "sl_latewarp.h"
+#endif
+
+// CPU stand-in for the Streamline interposer so the plugin side of resource tagging, constants, frame tokens and the
+// feature functions can be profiled without an NVIDIA GPU or driver. Nothing here touches the GPU, the native
+// resources passed in tags are only used as keys
+
+DECLARE_CYCLE_STAT(TEXT("Mock simulated SDK latency"), STAT_StreamlineMockSimulatedLatency, STATGROUP_StreamlineAPI);
+
+static TAutoConsoleVariable<float> CVarStreamlineMockEvaluateLatencyMs(
+	TEXT("r.Streamline.Mock.EvaluateLatencyMs"), 0.0f,
+	TEXT("Time in ms the mock Streamline backend spends in each slEvaluateFeature call, to emulate the driver side cost (default 0)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamlineMockAllocateLatencyMs(
+	TEXT("r.Streamline.Mock.AllocateLatencyMs"), 0.0f,
+	TEXT("Time in ms the mock Streamline backend spends in each slAllocateResources call (default 0)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStreamlineMockResourceMemoryMB(
+	TEXT("r.Streamline.Mock.ResourceMemoryMB"), 64,
+	TEXT("Video memory in MB the mock Streamline backend reports for each feature and viewport with allocated resources (default 64)\n"),
+	ECVF_Default);
+
+namespace
+{
+	// slGetNewFrameToken hands out pointers the caller keeps for a few frames, so the tokens live in a ring that is never reallocated
+	struct FStreamlineMockFrameToken final : public sl::FrameToken
+	{
+		uint32 Index = 0;
+		virtual operator uint32_t() const override { return Index; }
+	};
+
+	static constexpr uint32 NumMockFrameTokens = 64;
+
+	struct FMockState
+	{
+		FCriticalSection Section;
+		bool bInitialized = false;
+		TSet<sl::Feature> RequestedFeatures;
+		TSet<sl::Feature> LoadedFeatures;
+		// viewport << 32 | buffer type, only non null tags are kept like SL does
+		TMap<uint64, void*> Tags;
+		// feature << 32 | viewport
+		TSet<uint64> AllocatedResources;
+		FStreamlineMockFrameToken FrameTokens[NumMockFrameTokens];
+		uint32 NextFrameIndex = 0;
+		FStreamlineMockCounters Counters;
+	};
+
+	FMockState MockState;
+
+	bool IsMockedFeature(sl::Feature Feature)
+	{
+		return Feature == sl::kFeatureDLSS_G || Feature == sl::kFeatureDeepDVC || Feature == sl::kFeatureLatewarp || Feature == sl::kFeatureReflex || Feature == sl::kFeaturePCL;
+	}
+
+	uint64 GetResourceMemoryBytes()
+	{
+		return uint64(FMath::Max(CVarStreamlineMockResourceMemoryMB.GetValueOnAnyThread(), 0)) << 20;
+	}
+
+	// busy wait instead of sleeping so the simulated SDK cost shows up on the calling thread like a real blocking driver call
+	void SimulateLatency(float InMilliseconds)
+	{
+		if (InMilliseconds <= 0.0f)
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_StreamlineMockSimulatedLatency);
+		const double EndTime = FPlatformTime::Seconds() + InMilliseconds / 1000.0;
+		while (FPlatformTime::Seconds() < EndTime)
+		{
+			FPlatformProcess::Yield();
+		}
+	}
+
+	sl::Result CheckFeatureLoaded(sl::Feature Feature)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+		++MockState.Counters.NumFeatureFunctionCalls;
+		return MockState.LoadedFeatures.Contains(Feature) ? sl::Result::eOk : sl::Result::eErrorFeatureMissing;
+	}
+
+	uint64 GetFeatureMemoryBytes(sl::Feature Feature, uint32 Viewport)
+	{
+		FScopeLock Lock(&MockState.Section);
+		return MockState.AllocatedResources.Contains((uint64(Feature) << 32) | Viewport) ? GetResourceMemoryBytes() : 0;
+	}
+
+	sl::Result SetTags(const sl::ViewportHandle& Viewport, const sl::ResourceTag* Tags, uint32_t NumTags)
+	{
+		if (NumTags > 0 && Tags == nullptr)
+		{
+			return sl::Result::eErrorInvalidParameter;
+		}
+
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+
+		++MockState.Counters.NumSetTagCalls;
+		MockState.Counters.NumTagsSet += NumTags;
+		for (uint32_t TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+		{
+			const uint64 Key = (uint64(uint32(Viewport)) << 32) | uint64(Tags[TagIndex].type);
+			void* Native = Tags[TagIndex].resource ? Tags[TagIndex].resource->native : nullptr;
+			if (Native)
+			{
+				MockState.Tags.Add(Key, Native);
+			}
+			else
+			{
+				MockState.Tags.Remove(Key);
+			}
+		}
+		MockState.Counters.NumTaggedBuffers = MockState.Tags.Num();
+		return sl::Result::eOk;
+	}
+
+	// feature functions handed out by slGetFeatureFunction, the PFun_ casts in MockFeatureFunctions keep their signatures in line with SL
+
+	sl::Result MockDLSSGGetState(const sl::ViewportHandle& Viewport, sl::DLSSGState& State, const sl::DLSSGOptions* Options)
+	{
+		SL_CHECK(CheckFeatureLoaded(sl::kFeatureDLSS_G));
+		State.estimatedVRAMUsageInBytes = GetFeatureMemoryBytes(sl::kFeatureDLSS_G, Viewport);
+		State.status = sl::DLSSGStatus::eOk;
+		State.minWidthOrHeight = 128;
+		State.numFramesActuallyPresented = (Options && Options->mode != sl::DLSSGMode::eOff) ? Options->numFramesToGenerate + 1 : 1;
+		State.numFramesToGenerateMax = 3;
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockDLSSGSetOptions(const sl::ViewportHandle& Viewport, const sl::DLSSGOptions& Options)
+	{
+		return CheckFeatureLoaded(sl::kFeatureDLSS_G);
+	}
+
+	sl::Result MockDeepDVCGetState(const sl::ViewportHandle& Viewport, sl::DeepDVCState& State)
+	{
+		SL_CHECK(CheckFeatureLoaded(sl::kFeatureDeepDVC));
+		State.estimatedVRAMUsageInBytes = GetFeatureMemoryBytes(sl::kFeatureDeepDVC, Viewport);
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockDeepDVCSetOptions(const sl::ViewportHandle& Viewport, const sl::DeepDVCOptions& Options)
+	{
+		return CheckFeatureLoaded(sl::kFeatureDeepDVC);
+	}
+
+#if WITH_LATEWARP
+	sl::Result MockLatewarpSetOptions(const sl::ViewportHandle& Viewport, const sl::LatewarpOptions& Options)
+	{
+		return CheckFeatureLoaded(sl::kFeatureLatewarp);
+	}
+#endif
+
+	sl::Result MockPCLGetState(sl::PCLState& State)
+	{
+		SL_CHECK(CheckFeatureLoaded(sl::kFeaturePCL));
+		State.statsWindowMessage = 0;
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockPCLSetMarker(sl::PCLMarker Marker, const sl::FrameToken& Frame)
+	{
+		return CheckFeatureLoaded(sl::kFeaturePCL);
+	}
+
+	sl::Result MockReflexGetState(sl::ReflexState& State)
+	{
+		SL_CHECK(CheckFeatureLoaded(sl::kFeatureReflex));
+		State.lowLatencyAvailable = true;
+		State.latencyReportAvailable = false;
+		State.statsWindowMessage = 0;
+		State.flashIndicatorDriverControlled = false;
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockReflexSetCameraData(const sl::ViewportHandle& Viewport, const sl::FrameToken& Frame, const sl::ReflexCameraData& CameraData)
+	{
+		return CheckFeatureLoaded(sl::kFeatureReflex);
+	}
+
+	sl::Result MockReflexSetOptions(const sl::ReflexOptions& Options)
+	{
+		return CheckFeatureLoaded(sl::kFeatureReflex);
+	}
+
+	// the real sleep is the frame limiter, the mock returns right away so the benchmarks measure the plugin and not the wait
+	sl::Result MockReflexSleep(const sl::FrameToken& Frame)
+	{
+		return CheckFeatureLoaded(sl::kFeatureReflex);
+	}
+
+	struct FMockFeatureFunction
+	{
+		sl::Feature Feature;
+		const char* Name;
+		void* Function;
+	};
+
+	const FMockFeatureFunction MockFeatureFunctions[] =
+	{
+		{ sl::kFeatureDLSS_G, "slDLSSGGetState", reinterpret_cast<void*>(static_cast<PFun_slDLSSGGetState*>(&MockDLSSGGetState)) },
+		{ sl::kFeatureDLSS_G, "slDLSSGSetOptions", reinterpret_cast<void*>(static_cast<PFun_slDLSSGSetOptions*>(&MockDLSSGSetOptions)) },
+		{ sl::kFeatureDeepDVC, "slDeepDVCGetState", reinterpret_cast<void*>(static_cast<PFun_slDeepDVCGetState*>(&MockDeepDVCGetState)) },
+		{ sl::kFeatureDeepDVC, "slDeepDVCSetOptions", reinterpret_cast<void*>(static_cast<PFun_slDeepDVCSetOptions*>(&MockDeepDVCSetOptions)) },
+#if WITH_LATEWARP
+		{ sl::kFeatureLatewarp, "slLatewarpSetOptions", reinterpret_cast<void*>(static_cast<PFun_slLatewarpSetOptions*>(&MockLatewarpSetOptions)) },
+#endif
+		{ sl::kFeaturePCL, "slPCLGetState", reinterpret_cast<void*>(static_cast<PFun_slPCLGetState*>(&MockPCLGetState)) },
+		{ sl::kFeaturePCL, "slPCLSetMarker", reinterpret_cast<void*>(static_cast<PFun_slPCLSetMarker*>(&MockPCLSetMarker)) },
+		{ sl::kFeatureReflex, "slReflexGetState", reinterpret_cast<void*>(static_cast<PFun_slReflexGetState*>(&MockReflexGetState)) },
+		{ sl::kFeatureReflex, "slReflexSetCameraData", reinterpret_cast<void*>(static_cast<PFun_slReflexSetCameraData*>(&MockReflexSetCameraData)) },
+		{ sl::kFeatureReflex, "slReflexSetOptions", reinterpret_cast<void*>(static_cast<PFun_slReflexSetOptions*>(&MockReflexSetOptions)) },
+		{ sl::kFeatureReflex, "slReflexSleep", reinterpret_cast<void*>(static_cast<PFun_slReflexSleep*>(&MockReflexSleep)) },
+	};
+}
+
+FStreamlineMockCounters GetStreamlineMockCounters()
+{
+	FScopeLock Lock(&MockState.Section);
+	FStreamlineMockCounters Counters = MockState.Counters;
+	Counters.AllocatedBytes = MockState.AllocatedResources.Num() * GetResourceMemoryBytes();
+	return Counters;
+}
+
+namespace StreamlineMock
+{
+	sl::Result Init(const sl::Preferences& Preferences, uint64_t SDKVersion)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (MockState.bInitialized)
+		{
+			return sl::Result::eErrorInvalidState;
+		}
+
+		MockState.RequestedFeatures.Reset();
+		MockState.LoadedFeatures.Reset();
+		for (uint32_t FeatureIndex = 0; FeatureIndex < Preferences.numFeaturesToLoad; ++FeatureIndex)
+		{
+			const sl::Feature Feature = Preferences.featuresToLoad[FeatureIndex];
+			MockState.RequestedFeatures.Add(Feature);
+			if (IsMockedFeature(Feature))
+			{
+				MockState.LoadedFeatures.Add(Feature);
+			}
+		}
+		MockState.Tags.Reset();
+		MockState.AllocatedResources.Reset();
+		MockState.NextFrameIndex = 0;
+		MockState.Counters = FStreamlineMockCounters();
+		MockState.bInitialized = true;
+		return sl::Result::eOk;
+	}
+
+	sl::Result Shutdown()
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+		MockState.bInitialized = false;
+		MockState.LoadedFeatures.Reset();
+		MockState.Tags.Reset();
+		MockState.AllocatedResources.Reset();
+		return sl::Result::eOk;
+	}
+
+	sl::Result IsFeatureSupported(sl::Feature Feature, const sl::AdapterInfo& AdapterInfo)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+		if (!IsMockedFeature(Feature))
+		{
+			return sl::Result::eErrorFeatureNotSupported;
+		}
+		return MockState.RequestedFeatures.Contains(Feature) ? sl::Result::eOk : sl::Result::eErrorFeatureMissing;
+	}
+
+	sl::Result IsFeatureLoaded(sl::Feature Feature, bool& bOutLoaded)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+		if (!MockState.RequestedFeatures.Contains(Feature))
+		{
+			return sl::Result::eErrorFeatureMissing;
+		}
+		bOutLoaded = MockState.LoadedFeatures.Contains(Feature);
+		return sl::Result::eOk;
+	}
+
+	sl::Result SetFeatureLoaded(sl::Feature Feature, bool bLoaded)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+		if (!MockState.RequestedFeatures.Contains(Feature) || !IsMockedFeature(Feature))
+		{
+			return sl::Result::eErrorFeatureMissing;
+		}
+		if (bLoaded)
+		{
+			MockState.LoadedFeatures.Add(Feature);
+		}
+		else
+		{
+			MockState.LoadedFeatures.Remove(Feature);
+		}
+		return sl::Result::eOk;
+	}
+
+	sl::Result EvaluateFeature(sl::Feature Feature, const sl::FrameToken& Frame, const sl::BaseStructure** Inputs, uint32_t NumInputs, sl::CommandBuffer* CmdBuffer)
+	{
+		if (sl::findStruct<sl::ViewportHandle>(reinterpret_cast<const void**>(Inputs), NumInputs) == nullptr)
+		{
+			return sl::Result::eErrorMissingInputParameter;
+		}
+
+		{
+			FScopeLock Lock(&MockState.Section);
+			if (!MockState.bInitialized)
+			{
+				return sl::Result::eErrorNotInitialized;
+			}
+			if (!MockState.LoadedFeatures.Contains(Feature))
+			{
+				return sl::Result::eErrorFeatureMissing;
+			}
+			++MockState.Counters.NumEvaluateCalls;
+		}
+
+		SimulateLatency(CVarStreamlineMockEvaluateLatencyMs.GetValueOnAnyThread());
+		return sl::Result::eOk;
+	}
+
+	sl::Result AllocateResources(sl::CommandBuffer* CmdBuffer, sl::Feature Feature, const sl::ViewportHandle& Viewport)
+	{
+		{
+			FScopeLock Lock(&MockState.Section);
+			if (!MockState.bInitialized)
+			{
+				return sl::Result::eErrorNotInitialized;
+			}
+			if (!MockState.LoadedFeatures.Contains(Feature))
+			{
+				return sl::Result::eErrorFeatureMissing;
+			}
+			bool bAlreadyAllocated = false;
+			MockState.AllocatedResources.Add((uint64(Feature) << 32) | uint32(Viewport), &bAlreadyAllocated);
+			if (bAlreadyAllocated)
+			{
+				return sl::Result::eOk;
+			}
+			++MockState.Counters.NumAllocations;
+		}
+
+		SimulateLatency(CVarStreamlineMockAllocateLatencyMs.GetValueOnAnyThread());
+		return sl::Result::eOk;
+	}
+
+	sl::Result FreeResources(sl::Feature Feature, const sl::ViewportHandle& Viewport)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+		MockState.AllocatedResources.Remove((uint64(Feature) << 32) | uint32(Viewport));
+
+		// freeing a viewport also drops the tags SL kept for it
+		for (TMap<uint64, void*>::TIterator It = MockState.Tags.CreateIterator(); It; ++It)
+		{
+			if (uint32(It.Key() >> 32) == uint32(Viewport))
+			{
+				It.RemoveCurrent();
+			}
+		}
+		MockState.Counters.NumTaggedBuffers = MockState.Tags.Num();
+		return sl::Result::eOk;
+	}
+
+	sl::Result SetTag(const sl::ViewportHandle& Viewport, const sl::ResourceTag* Tags, uint32_t NumTags, sl::CommandBuffer* CmdBuffer)
+	{
+		return SetTags(Viewport, Tags, NumTags);
+	}
+
+	sl::Result SetTagForFrame(const sl::FrameToken& Frame, const sl::ViewportHandle& Viewport, const sl::ResourceTag* Tags, uint32_t NumTags, sl::CommandBuffer* CmdBuffer)
+	{
+		return SetTags(Viewport, Tags, NumTags);
+	}
+
+	sl::Result GetFeatureRequirements(sl::Feature Feature, sl::FeatureRequirements& OutRequirements)
+	{
+		if (!IsMockedFeature(Feature))
+		{
+			return sl::Result::eErrorFeatureNotSupported;
+		}
+		OutRequirements.flags = sl::FeatureRequirementFlags::eD3D11Supported | sl::FeatureRequirementFlags::eD3D12Supported | sl::FeatureRequirementFlags::eVulkanSupported;
+		OutRequirements.maxNumCPUThreads = 0;
+		OutRequirements.maxNumViewports = 0;
+		OutRequirements.numRequiredTags = 0;
+		OutRequirements.requiredTags = nullptr;
+		return sl::Result::eOk;
+	}
+
+	sl::Result GetFeatureVersion(sl::Feature Feature, sl::FeatureVersion& OutVersion)
+	{
+		if (!IsMockedFeature(Feature))
+		{
+			return sl::Result::eErrorFeatureNotSupported;
+		}
+		OutVersion.versionSL = sl::Version(SL_VERSION_MAJOR, SL_VERSION_MINOR, SL_VERSION_PATCH);
+		OutVersion.versionNGX = sl::Version();
+		return sl::Result::eOk;
+	}
+
+	// there is no proxy to hand out, so the caller keeps using its own DXGI factory
+	sl::Result UpgradeInterface(void** BaseInterface)
+	{
+		return BaseInterface && *BaseInterface ? sl::Result::eOk : sl::Result::eErrorInvalidParameter;
+	}
+
+	sl::Result SetConstants(const sl::Constants& Values, const sl::FrameToken& Frame, const sl::ViewportHandle& Viewport)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+		++MockState.Counters.NumSetConstantsCalls;
+		return sl::Result::eOk;
+	}
+
+	// no swapchain is ever a proxy, returning the interface would need a COM AddRef the mock can't do portably
+	sl::Result GetNativeInterface(void* ProxyInterface, void** BaseInterface)
+	{
+		return sl::Result::eErrorMissingOrInvalidAPI;
+	}
+
+	sl::Result GetFeatureFunction(sl::Feature Feature, const char* FunctionName, void*& OutFunction)
+	{
+		for (const FMockFeatureFunction& Function : MockFeatureFunctions)
+		{
+			if (Function.Feature == Feature && FCStringAnsi::Strcmp(Function.Name, FunctionName) == 0)
+			{
+				OutFunction = Function.Function;
+				return sl::Result::eOk;
+			}
+		}
+		return sl::Result::eErrorMissingOrInvalidAPI;
+	}
+
+	sl::Result GetNewFrameToken(sl::FrameToken*& OutToken, const uint32_t* FrameIndex)
+	{
+		FScopeLock Lock(&MockState.Section);
+		if (!MockState.bInitialized)
+		{
+			return sl::Result::eErrorNotInitialized;
+		}
+
+		const uint32 Index = FrameIndex ? *FrameIndex : MockState.NextFrameIndex;
+		MockState.NextFrameIndex = Index + 1;
+		FStreamlineMockFrameToken& Token = MockState.FrameTokens[Index % NumMockFrameTokens];
+		Token.Index = Index;
+		OutToken = &Token;
+		++MockState.Counters.NumFrameTokens;
+		return sl::Result::eOk;
+	}
+
+	sl::Result SetD3DDevice(void* D3DDevice)
+	{
+		return D3DDevice ? sl::Result::eOk : sl::Result::eErrorInvalidParameter;
+	}
+}
+
+#endif
@@ -51,6 +51,16 @@ static TAutoConsoleVariable<bool> CVarStreamlineFilterRedundantSetOptionsCalls(
 	TEXT(" 1: only call sl{Feature}SetOptions when the UE plugin side changed(default)"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<bool> CVarStreamlineFilterRedundantNullTags(
+	TEXT("r.Streamline.FilterRedundantNullTags"),
+	true,
+	TEXT("Determines whether the UE plugin filters null tags that are already in effect when using the deprecated slSetTag. slSetTagForFrame tags are per frame and never filtered\n")
+	TEXT(" 0: pass every null tag to slSetTag. Helpful for debugging\n")
+	TEXT(" 1: only pass a null tag when the buffer was tagged with a resource since its last null tag (default)"),
+	ECVF_RenderThreadSafe);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Redundant null tags filtered"), STAT_StreamlineRedundantNullTags, STATGROUP_StreamlineAPI);
+
 DEFINE_LOG_CATEGORY(LogStreamlineRHI);
 DEFINE_LOG_CATEGORY_STATIC(LogStreamlineAPI, Log, All);
 
@@ -142,27 +152,72 @@ static int32 GetNGXAppID(bool bIsDLSSPluginEnabled)
 // TODO: the derived RHIs will set this to true during their initialization
 bool FStreamlineRHI::bIsIncompatibleAPICaptureToolActive = false;
 TArray<sl::Feature> FStreamlineRHI::FeaturesRequestedAtSLInitTime;
-FSLFrameTokenProvider::FSLFrameTokenProvider() : Section()
+FSLFrameTokenProvider::FSLFrameTokenProvider(FNewFrameTokenFunction InNewFrameToken, uint64 InitialFrameCounter)
+	: NewFrameToken(InNewFrameToken ? InNewFrameToken : &GetNewFrameTokenFromSL)
+{
+	GetTokenForFrame(InitialFrameCounter);
+}
+
+sl::FrameToken* FSLFrameTokenProvider::GetNewFrameTokenFromSL(uint32_t FrameIndex)
 {
-	// truncated to 32 bits because that's all SL stores
-	LastFrameCounter = static_cast<uint32_t>(GFrameCounter);
-	SLgetNewFrameToken(FrameToken, &LastFrameCounter);
+	sl::FrameToken* Token = nullptr;
+	SLgetNewFrameToken(Token, &FrameIndex);
+	return Token;
+}
+
+sl::FrameToken* FSLFrameTokenProvider::FindCachedToken(uint64 FrameCounter) const
+{
+	const FTokenSlot& Slot = TokenSlots[FrameCounter % NumTokenSlots];
+
+	// slots are invalidated before their token gets replaced, so reading the same frame before and after the token means the token is for that frame
+	if (Slot.Frame.load(std::memory_order_acquire) != FrameCounter)
+	{
+		return nullptr;
+	}
+	sl::FrameToken* Token = Slot.Token.load(std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (Slot.Frame.load(std::memory_order_relaxed) != FrameCounter)
+	{
+		return nullptr;
+	}
+
+	// SL recycles its token objects, make sure it hasn't handed this one out again for a later frame
+	if (static_cast<uint32_t>(*Token) != static_cast<uint32_t>(FrameCounter))
+	{
+		return nullptr;
+	}
+	return Token;
 }
 
 sl::FrameToken* FSLFrameTokenProvider::GetTokenForFrame(uint64 FrameCounter)
 {
-	uint32_t FrameCounter32 = static_cast<uint32_t>(FrameCounter);
+	if (sl::FrameToken* CachedToken = FindCachedToken(FrameCounter))
+	{
+		return CachedToken;
+	}
+
 	FScopeLock Lock(&Section);
-	if (FrameCounter32 == LastFrameCounter)
+	if (sl::FrameToken* CachedToken = FindCachedToken(FrameCounter))
 	{
-		return FrameToken;
+		return CachedToken;
 	}
 
+	// truncated to 32 bits because that's all SL stores, it wraps around the same way the lower bits of the engine frame counter do
+	sl::FrameToken* Token = NewFrameToken(static_cast<uint32_t>(FrameCounter));
+
+	// don't let a thread that is lagging far behind evict the token a newer frame is using.
 	// this should be safe, we can create multiple tokens to track the same frame
-	LastFrameCounter = FrameCounter32;
-	SLgetNewFrameToken(FrameToken, &LastFrameCounter);
+	FTokenSlot& Slot = TokenSlots[FrameCounter % NumTokenSlots];
+	const uint64 SlotFrame = Slot.Frame.load(std::memory_order_relaxed);
+	if (Token && (SlotFrame == InvalidFrame || SlotFrame <= FrameCounter))
+	{
+		Slot.Frame.store(InvalidFrame, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Slot.Token.store(Token, std::memory_order_relaxed);
+		Slot.Frame.store(FrameCounter, std::memory_order_release);
+	}
 
-	return FrameToken;
+	return Token;
 }
 
 
@@ -280,6 +335,62 @@ void FStreamlineRHI::ReleaseStreamlineResourcesForAllFeatures(uint32 ViewID)
 		//UE_LOG(LogStreamlineRHI, Log, TEXT("%s %u (skipped)"), ANSI_TO_TCHAR(__FUNCTION__), ViewID);
 		SLFreeResources(Feature, ViewID);
 	}
+
+	// don't assume anything about the tags of a viewport SL might have forgotten about, the next null tag goes through again
+	NullTagFilter.ForgetViewport(ViewID);
+}
+
+int32 FStreamlineRHI::RemoveRedundantNullTags(uint32 InViewID, sl::ResourceTag* Tags, int32 NumTags)
+{
+	if (!CVarStreamlineFilterRedundantNullTags.GetValueOnAnyThread())
+	{
+		NullTagFilter.Reset();
+		return NumTags;
+	}
+
+	return NullTagFilter.RemoveRedundantNullTags(InViewID, Tags, NumTags);
+}
+
+int32 FStreamlineNullTagFilter::RemoveRedundantNullTags(uint32 InViewID, sl::ResourceTag* Tags, int32 NumTags)
+{
+	int32 NumTagsToSet = 0;
+	for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+	{
+		const uint64 Key = (uint64(InViewID) << 32) | uint64(Tags[TagIndex].type);
+		if (Tags[TagIndex].resource == nullptr || Tags[TagIndex].resource->native == nullptr)
+		{
+			bool bAlreadyNullTagged = false;
+			NullTaggedBuffers.Add(Key, &bAlreadyNullTagged);
+			if (bAlreadyNullTagged)
+			{
+				INC_DWORD_STAT(STAT_StreamlineRedundantNullTags);
+				continue;
+			}
+		}
+		else
+		{
+			NullTaggedBuffers.Remove(Key);
+		}
+
+		if (NumTagsToSet != TagIndex)
+		{
+			Tags[NumTagsToSet] = Tags[TagIndex];
+		}
+		++NumTagsToSet;
+	}
+
+	return NumTagsToSet;
+}
+
+void FStreamlineNullTagFilter::ForgetViewport(uint32 InViewID)
+{
+	for (TSet<uint64>::TIterator It = NullTaggedBuffers.CreateIterator(); It; ++It)
+	{
+		if (uint32(*It >> 32) == InViewID)
+		{
+			It.RemoveCurrent();
+		}
+	}
 }
 
 void FStreamlineRHI::PostPlatformRHICreateInit()
@@ -1093,6 +1204,47 @@ STREAMLINERHI_API void FStreamlineRHIModule::ShutdownStreamline()
 }
 
 
+#if STREAMLINE_MOCK_API
+bool InitializeStreamlineMock(TArrayView<const sl::Feature> InFeatures)
+{
+	if (AreStreamlineFunctionsLoaded() && !IsStreamlineMockLoaded())
+	{
+		// the interposer is loaded, leave it alone
+		return false;
+	}
+
+	if (IsStreamlineSupported())
+	{
+		return true;
+	}
+
+	LoadStreamlineMockFunctionPointers();
+
+	sl::Preferences Preferences;
+	Preferences.featuresToLoad = InFeatures.GetData();
+	Preferences.numFeaturesToLoad = InFeatures.Num();
+	Preferences.engine = sl::EngineType::eUnreal;
+	bIsStreamlineInitialized = SLinit(Preferences) == sl::Result::eOk;
+	return bIsStreamlineInitialized;
+}
+
+void ShutdownStreamlineMock()
+{
+	if (!IsStreamlineMockLoaded())
+	{
+		return;
+	}
+
+	if (bIsStreamlineInitialized)
+	{
+		SLshutdown();
+		bIsStreamlineInitialized = false;
+	}
+	UnloadStreamlineMockFunctionPointers();
+}
+#endif
+
+
 /** IModuleInterface implementation */
 
 void FStreamlineRHIModule::StartupModule()
@@ -1143,7 +1295,17 @@ void FStreamlineRHIModule::StartupModule()
 		);
 
 		const FString StreamlineInterposerBinaryPath = FPaths::Combine(*StreamlineBinaryDirectory, STREAMLINE_INTERPOSER_BINARY_NAME);
-		LoadStreamlineFunctionPointers(StreamlineInterposerBinaryPath);
+#if STREAMLINE_MOCK_API
+		if (FParse::Param(FCommandLine::Get(), TEXT("slmock")))
+		{
+			UE_LOG(LogStreamlineRHI, Log, TEXT("Using the Streamline CPU mock instead of the interposer (-slmock), see r.Streamline.Mock.*"));
+			LoadStreamlineMockFunctionPointers();
+		}
+		else
+#endif
+		{
+			LoadStreamlineFunctionPointers(StreamlineInterposerBinaryPath);
+		}
 	}
 	else
 	{
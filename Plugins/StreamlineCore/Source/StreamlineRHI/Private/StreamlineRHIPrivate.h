@@ -13,12 +13,81 @@
 #include "CoreMinimal.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogStreamlineRHI, Log, All);
+DECLARE_STATS_GROUP(TEXT("Streamline API"), STATGROUP_StreamlineAPI, STATCAT_Advanced);
 
 bool slVerifyEmbeddedSignature(const FString& PathToBinary);
 
+// WinVerifyTrust and the certificate checks are a noticeable part of editor and game startup, so non-shipping builds remember the binaries that verified before.
+// Shipping builds only load the interposer when it is signed and always verify it
+#define STREAMLINE_CACHE_SIGNATURE_VERIFICATION (!UE_BUILD_SHIPPING)
+
+#if STREAMLINE_CACHE_SIGNATURE_VERIFICATION
+namespace StreamlineSignatureCache
+{
+	// path, size, modification time and content hash, tab separated
+	bool DescribeBinary(const FString& PathToBinary, FString& OutDescription);
+	bool Contains(const FString& CacheFilename, const FString& Description);
+	// one entry per binary, so an updated binary replaces the entry of its previous version
+	void Add(const FString& CacheFilename, const FString& PathToBinary, const FString& Description);
+}
+#endif
+
 bool LoadStreamlineFunctionPointers(const FString& InterposerBinaryPath);
 void SetStreamlineAPILoggingEnabled(bool bEnabled);
 
+// -slmock swaps the interposer for a CPU stand-in of the SL entry points the plugins call, see StreamlineMockAPI.cpp
+#define STREAMLINE_MOCK_API (!UE_BUILD_SHIPPING)
+
+#if STREAMLINE_MOCK_API
+#include "sl.h"
+
+bool LoadStreamlineMockFunctionPointers();
+void UnloadStreamlineMockFunctionPointers();
+bool IsStreamlineMockLoaded();
+
+// loads the mock and calls slInit on it, for tests in a process that didn't load the interposer
+bool InitializeStreamlineMock(TArrayView<const sl::Feature> InFeatures);
+void ShutdownStreamlineMock();
+
+// what the plugin passed to the mock since slInit
+struct FStreamlineMockCounters
+{
+	uint32 NumSetTagCalls = 0;
+	uint32 NumTagsSet = 0;
+	uint32 NumSetConstantsCalls = 0;
+	uint32 NumEvaluateCalls = 0;
+	uint32 NumFeatureFunctionCalls = 0;
+	uint32 NumFrameTokens = 0;
+	uint32 NumAllocations = 0;
+	// buffers of all viewports that currently hold a non null tag
+	int32 NumTaggedBuffers = 0;
+	uint64 AllocatedBytes = 0;
+};
+FStreamlineMockCounters GetStreamlineMockCounters();
+
+namespace StreamlineMock
+{
+	sl::Result Init(const sl::Preferences& Preferences, uint64_t SDKVersion);
+	sl::Result Shutdown();
+	sl::Result IsFeatureSupported(sl::Feature Feature, const sl::AdapterInfo& AdapterInfo);
+	sl::Result IsFeatureLoaded(sl::Feature Feature, bool& bOutLoaded);
+	sl::Result SetFeatureLoaded(sl::Feature Feature, bool bLoaded);
+	sl::Result EvaluateFeature(sl::Feature Feature, const sl::FrameToken& Frame, const sl::BaseStructure** Inputs, uint32_t NumInputs, sl::CommandBuffer* CmdBuffer);
+	sl::Result AllocateResources(sl::CommandBuffer* CmdBuffer, sl::Feature Feature, const sl::ViewportHandle& Viewport);
+	sl::Result FreeResources(sl::Feature Feature, const sl::ViewportHandle& Viewport);
+	sl::Result SetTag(const sl::ViewportHandle& Viewport, const sl::ResourceTag* Tags, uint32_t NumTags, sl::CommandBuffer* CmdBuffer);
+	sl::Result SetTagForFrame(const sl::FrameToken& Frame, const sl::ViewportHandle& Viewport, const sl::ResourceTag* Tags, uint32_t NumTags, sl::CommandBuffer* CmdBuffer);
+	sl::Result GetFeatureRequirements(sl::Feature Feature, sl::FeatureRequirements& OutRequirements);
+	sl::Result GetFeatureVersion(sl::Feature Feature, sl::FeatureVersion& OutVersion);
+	sl::Result UpgradeInterface(void** BaseInterface);
+	sl::Result SetConstants(const sl::Constants& Values, const sl::FrameToken& Frame, const sl::ViewportHandle& Viewport);
+	sl::Result GetNativeInterface(void* ProxyInterface, void** BaseInterface);
+	sl::Result GetFeatureFunction(sl::Feature Feature, const char* FunctionName, void*& OutFunction);
+	sl::Result GetNewFrameToken(sl::FrameToken*& OutToken, const uint32_t* FrameIndex);
+	sl::Result SetD3DDevice(void* D3DDevice);
+}
+#endif
+
 
 #if defined(__clang__)
 #define SL_DISABLE_DEPRECATED_WARNINGS \
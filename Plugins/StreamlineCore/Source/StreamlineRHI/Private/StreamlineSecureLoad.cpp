@@ -10,7 +10,14 @@
 */
 
 #include "StreamlineRHIPrivate.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
 #include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define _UNICODE 1
 #define UNICODE 1
@@ -328,8 +335,80 @@ bool isSignedByNVIDIA(const wchar_t* pathToFile)
 	return valid;
 }
 
+#if STREAMLINE_CACHE_SIGNATURE_VERIFICATION
+namespace StreamlineSignatureCache
+{
+	static FString GetCacheFilename()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Streamline"), TEXT("SignatureCache.txt"));
+	}
+
+	// keyed to the machine so cache files that were copied around or edited by hand don't count. This is not a secret, which is why shipping builds don't use the cache
+	static FString ComputeEntryHMAC(const FString& Entry)
+	{
+		const FTCHARToUTF8 Key(*(FString(TEXT("StreamlineSignatureCache|")) + FPlatformMisc::GetLoginId()));
+		const FTCHARToUTF8 Data(*Entry);
+
+		uint8 HMAC[FSHA1::DigestSize];
+		FSHA1::HMACBuffer(Key.Get(), Key.Length(), Data.Get(), Data.Length(), HMAC);
+		return BytesToHex(HMAC, FSHA1::DigestSize);
+	}
+
+	bool DescribeBinary(const FString& PathToBinary, FString& OutDescription)
+	{
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*PathToBinary);
+		TArray<uint8> Contents;
+		if (!StatData.bIsValid || !FFileHelper::LoadFileToArray(Contents, *PathToBinary, FILEREAD_Silent))
+		{
+			return false;
+		}
+
+		FSHAHash ContentHash;
+		FSHA1::HashBuffer(Contents.GetData(), Contents.Num(), ContentHash.Hash);
+		OutDescription = FString::Printf(TEXT("%s\t%lld\t%lld\t%s"), *PathToBinary, StatData.FileSize, StatData.ModificationTime.GetTicks(), *ContentHash.ToString());
+		return true;
+	}
+
+	bool Contains(const FString& CacheFilename, const FString& Description)
+	{
+		TArray<FString> Lines;
+		FFileHelper::LoadFileToStringArray(Lines, *CacheFilename);
+
+		for (const FString& Line : Lines)
+		{
+			FString Entry;
+			FString HMAC;
+			if (Line.Split(TEXT("\t"), &Entry, &HMAC, ESearchCase::CaseSensitive, ESearchDir::FromEnd) && Entry == Description)
+			{
+				if (HMAC == ComputeEntryHMAC(Entry))
+				{
+					return true;
+				}
+
+				UE_LOG(LogStreamlineRHI, Warning, TEXT("Ignoring modified entry in %s"), *CacheFilename);
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+	void Add(const FString& CacheFilename, const FString& PathToBinary, const FString& Description)
+	{
+		TArray<FString> Lines;
+		FFileHelper::LoadFileToStringArray(Lines, *CacheFilename);
+
+		const FString PathPrefix = PathToBinary + TEXT("\t");
+		Lines.RemoveAll([&PathPrefix](const FString& Line) { return Line.StartsWith(PathPrefix); });
+		Lines.Add(Description + TEXT("\t") + ComputeEntryHMAC(Description));
+
+		FFileHelper::SaveStringArrayToFile(Lines, *CacheFilename);
+	}
+}
+#endif
+
 //! See https://docs.microsoft.com/en-us/windows/win32/seccrypto/example-c-program--verifying-the-signature-of-a-pe-file
-bool slVerifyEmbeddedSignature(const FString& InPathToBinary)
+static bool VerifyEmbeddedSignatureUncached(const FString& InPathToBinary)
 {
 	FString PathToBinary = InPathToBinary;
 
@@ -472,7 +551,41 @@ bool slVerifyEmbeddedSignature(const FString& InPathToBinary)
 	return valid;
 }
 
+bool slVerifyEmbeddedSignature(const FString& InPathToBinary)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(slVerifyEmbeddedSignature);
+	const double StartTime = FPlatformTime::Seconds();
+
+	FString PathToBinary = InPathToBinary;
+	FPaths::ConvertRelativePathToFull(PathToBinary);
+	FPaths::MakePlatformFilename(PathToBinary);
+
+#if STREAMLINE_CACHE_SIGNATURE_VERIFICATION
+	const bool bUseCache = !FParse::Param(FCommandLine::Get(), TEXT("slnosignaturecache"));
+	FString Description;
+	const bool bIsDescribed = bUseCache && StreamlineSignatureCache::DescribeBinary(PathToBinary, Description);
+
+	if (bIsDescribed && StreamlineSignatureCache::Contains(StreamlineSignatureCache::GetCacheFilename(), Description))
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("File '%s' is signed by NVIDIA, reusing the signature verification of a previous run (%.2f ms). Use -slnosignaturecache to always verify"),
+			*PathToBinary, 1000.0 * (FPlatformTime::Seconds() - StartTime));
+		return true;
+	}
+#endif
 
+	const bool bIsValid = VerifyEmbeddedSignatureUncached(PathToBinary);
+
+#if STREAMLINE_CACHE_SIGNATURE_VERIFICATION
+	// failures are not cached so they get verified and logged again every time
+	if (bIsValid && bIsDescribed)
+	{
+		StreamlineSignatureCache::Add(StreamlineSignatureCache::GetCacheFilename(), PathToBinary, Description);
+	}
+#endif
+
+	UE_LOG(LogStreamlineRHI, Log, TEXT("Verifying the signature of '%s' took %.2f ms"), *PathToBinary, 1000.0 * (FPlatformTime::Seconds() - StartTime));
+	return bIsValid;
+}
 
 
 #include "Windows/HideWindowsPlatformTypes.h"
@@ -0,0 +1,160 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineRHI.h"
+
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#include "sl.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// stands in for SL, which recycles a small pool of token objects and only stores the lower 32 bits of the frame
+	struct FMockFrameToken final : public sl::FrameToken
+	{
+		std::atomic<uint32_t> FrameIndex{ 0 };
+
+		virtual operator uint32_t() const override { return FrameIndex.load(std::memory_order_relaxed); }
+	};
+
+	static constexpr int32 NumMockTokens = 8;
+	FMockFrameToken MockTokens[NumMockTokens];
+	int32 NextMockToken = 0;
+	std::atomic<int32> MockCallsInFlight{ 0 };
+	std::atomic<int64> MockNumFetches{ 0 };
+	std::atomic<int64> MockNumConcurrentFetches{ 0 };
+
+	sl::FrameToken* GetNewMockFrameToken(uint32_t FrameIndex)
+	{
+		// slGetNewFrameToken isn't thread safe, the provider must never call it from two threads at once
+		if (MockCallsInFlight.fetch_add(1) != 0)
+		{
+			MockNumConcurrentFetches++;
+		}
+		MockNumFetches++;
+
+		FMockFrameToken& Token = MockTokens[NextMockToken];
+		NextMockToken = (NextMockToken + 1) % NumMockTokens;
+		Token.FrameIndex.store(FrameIndex, std::memory_order_relaxed);
+
+		MockCallsInFlight.fetch_sub(1);
+		return &Token;
+	}
+
+	void ResetMockFrameTokens()
+	{
+		NextMockToken = 0;
+		MockNumFetches = 0;
+		MockNumConcurrentFetches = 0;
+	}
+}
+
+// sweeps a simulated frame counter across the 32 bit boundary, frames 2^32 apart share their SL frame index but must not share a token
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineFrameTokenWraparoundTest, "Streamline.FrameTokenProvider.Wraparound", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineFrameTokenWraparoundTest::RunTest(const FString& Parameters)
+{
+	static constexpr uint64 FirstFrame = 0xFFFFFFF0ull;
+	static constexpr uint64 LastFrame = 0x100000010ull;
+
+	ResetMockFrameTokens();
+	FSLFrameTokenProvider Provider(&GetNewMockFrameToken, FirstFrame);
+
+	int32 NumMismatches = 0;
+	int32 NumUnstable = 0;
+	for (uint64 Frame = FirstFrame; Frame < LastFrame; Frame++)
+	{
+		sl::FrameToken* Token = Provider.GetTokenForFrame(Frame);
+		NumMismatches += static_cast<uint32_t>(*Token) != static_cast<uint32_t>(Frame) ? 1 : 0;
+		NumUnstable += Provider.GetTokenForFrame(Frame) != Token ? 1 : 0;
+	}
+	TestEqual(TEXT("Tokens for the wrong frame"), NumMismatches, 0);
+	TestEqual(TEXT("Tokens that changed within a frame"), NumUnstable, 0);
+	TestEqual(TEXT("One SL fetch per frame"), MockNumFetches.load(), int64(LastFrame - FirstFrame));
+
+	// the newest frame is still in the ring, the frame 2^32 before it only shares its SL frame index
+	sl::FrameToken* NewestToken = Provider.GetTokenForFrame(LastFrame - 1);
+	sl::FrameToken* AliasedToken = Provider.GetTokenForFrame(LastFrame - 1 - 0x100000000ull);
+	TestTrue(TEXT("Frames 2^32 apart get distinct tokens"), AliasedToken != NewestToken);
+	TestTrue(TEXT("A lagging frame doesn't evict a newer frame's token"), Provider.GetTokenForFrame(LastFrame - 1) == NewestToken);
+
+	return true;
+}
+
+// game, render and RHI thread asking for frames F, F-1 and F-2 while the frame counter advances, reports the lookup cost
+// and how often SL had to be asked for a new token
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineFrameTokenContentionBenchmark, "Streamline.FrameTokenProvider.ContentionBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FStreamlineFrameTokenContentionBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumThreads = 3;
+	static constexpr int32 NumFrames = 2000;
+	static constexpr int32 LookupsPerFrame = 4;
+
+	for (const uint64 StartFrame : { 1000ull, 0xFFFFFFFFull - 1000ull })
+	{
+		ResetMockFrameTokens();
+		FSLFrameTokenProvider Provider(&GetNewMockFrameToken, StartFrame);
+		MockNumFetches = 0;
+
+		std::atomic<uint64> FrameCounter{ StartFrame };
+		std::atomic<bool> bStop{ false };
+		std::atomic<int64> NumLookups{ 0 };
+		std::atomic<int64> NumWrongTokens{ 0 };
+
+		TArray<TFuture<void>> Threads;
+		for (int32 Lag = 0; Lag < NumThreads; Lag++)
+		{
+			Threads.Add(Async(EAsyncExecution::Thread, [&, Lag]()
+			{
+				while (!bStop.load(std::memory_order_relaxed))
+				{
+					const uint64 Frame = FrameCounter.load(std::memory_order_relaxed) - Lag;
+					for (int32 Lookup = 0; Lookup < LookupsPerFrame; Lookup++)
+					{
+						sl::FrameToken* Token = Provider.GetTokenForFrame(Frame);
+						if (static_cast<uint32_t>(*Token) != static_cast<uint32_t>(Frame))
+						{
+							NumWrongTokens++;
+						}
+					}
+					NumLookups += LookupsPerFrame;
+				}
+			}));
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			FPlatformProcess::Sleep(0.0002f);
+			FrameCounter++;
+		}
+		bStop = true;
+		for (TFuture<void>& Thread : Threads)
+		{
+			Thread.Wait();
+		}
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+		AddInfo(FString::Printf(TEXT("Start frame 0x%llx: %.1f ns per lookup over %lld lookups, %.2f SL fetches per frame"),
+			StartFrame, ElapsedSeconds * NumThreads * 1.0e9 / FMath::Max<int64>(NumLookups.load(), 1), NumLookups.load(), double(MockNumFetches.load()) / NumFrames));
+		TestEqual(TEXT("Tokens for the wrong frame"), NumWrongTokens.load(), int64(0));
+		TestEqual(TEXT("Concurrent SL fetches"), MockNumConcurrentFetches.load(), int64(0));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineAPI.h"
+#include "StreamlineRHI.h"
+#include "StreamlineRHIPrivate.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#include "sl_pcl.h"
+#include "sl_reflex.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && STREAMLINE_MOCK_API
+
+// CPU cost per frame of the SL traffic the plugin generates for a few views: frame tokens, PCL markers, constants, resource
+// tags with the null tag filter, the DLSS-G state and options and a DeepDVC evaluation. Runs against the CPU mock so it
+// needs neither an NVIDIA GPU nor the interposer
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineMockFrameCostBenchmark, "Streamline.Mock.FrameCostBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FStreamlineMockFrameCostBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumFrames = 2000;
+	static constexpr uint32 NumViews = 4;
+
+	if (AreStreamlineFunctionsLoaded())
+	{
+		AddInfo(TEXT("Streamline is already loaded in this process, the benchmark needs the mock to itself"));
+		return true;
+	}
+
+	const sl::Feature Features[] = { sl::kFeatureDLSS_G, sl::kFeatureDeepDVC, sl::kFeatureReflex, sl::kFeaturePCL };
+	if (!TestTrue(TEXT("Streamline mock initialized"), InitializeStreamlineMock(Features)))
+	{
+		ShutdownStreamlineMock();
+		return false;
+	}
+
+	for (uint32 ViewID = 0; ViewID < NumViews; ++ViewID)
+	{
+		TestTrue(TEXT("DLSS-G resources allocated"), SLAllocateResources(nullptr, sl::kFeatureDLSS_G, sl::ViewportHandle(ViewID)) == sl::Result::eOk);
+	}
+
+	int32 Textures[3];
+	sl::Resource Color(sl::ResourceType::eTex2d, &Textures[0]);
+	sl::Resource Depth(sl::ResourceType::eTex2d, &Textures[1]);
+	sl::Resource MotionVectors(sl::ResourceType::eTex2d, &Textures[2]);
+	sl::Resource Null(sl::ResourceType::eTex2d, nullptr);
+
+	FSLFrameTokenProvider TokenProvider(nullptr, 0);
+	FStreamlineNullTagFilter NullTagFilter;
+	sl::Constants Constants;
+	sl::DLSSGOptions DLSSGOptions;
+	DLSSGOptions.mode = sl::DLSSGMode::eOn;
+	uint64 EstimatedVRAMUsageInBytes = 0;
+	int32 NumFailedCalls = 0;
+
+	const FStreamlineMockCounters Before = GetStreamlineMockCounters();
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		sl::FrameToken* FrameToken = TokenProvider.GetTokenForFrame(Frame);
+
+		NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeatureReflex, slReflexSleep, *FrameToken) != sl::Result::eOk;
+		NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, sl::PCLMarker::eSimulationStart, *FrameToken) != sl::Result::eOk;
+		NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, sl::PCLMarker::eSimulationEnd, *FrameToken) != sl::Result::eOk;
+		NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, sl::PCLMarker::eRenderSubmitStart, *FrameToken) != sl::Result::eOk;
+
+		for (uint32 ViewID = 0; ViewID < NumViews; ++ViewID)
+		{
+			const sl::ViewportHandle Viewport(ViewID);
+			Constants.jitterOffset = sl::float2(float(Frame & 7) / 8.0f, float(Frame & 3) / 4.0f);
+			NumFailedCalls += SLsetConstants(Constants, *FrameToken, Viewport) != sl::Result::eOk;
+
+			sl::ResourceTag Tags[] =
+			{
+				sl::ResourceTag(&Color, sl::kBufferTypeScalingInputColor, sl::eOnlyValidNow),
+				sl::ResourceTag(&Depth, sl::kBufferTypeDepth, sl::eOnlyValidNow),
+				sl::ResourceTag(&MotionVectors, sl::kBufferTypeMotionVectors, sl::eOnlyValidNow),
+				sl::ResourceTag(&Null, sl::kBufferTypeHUDLessColor, sl::eOnlyValidNow),
+			};
+			const int32 NumTags = NullTagFilter.RemoveRedundantNullTags(ViewID, Tags, UE_ARRAY_COUNT(Tags));
+			NumFailedCalls += SLsetTag(Viewport, Tags, NumTags, nullptr) != sl::Result::eOk;
+
+			sl::DLSSGState DLSSGState;
+			NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeatureDLSS_G, slDLSSGGetState, Viewport, DLSSGState, &DLSSGOptions) != sl::Result::eOk;
+			NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeatureDLSS_G, slDLSSGSetOptions, Viewport, DLSSGOptions) != sl::Result::eOk;
+			EstimatedVRAMUsageInBytes += DLSSGState.estimatedVRAMUsageInBytes;
+
+			const sl::BaseStructure* Inputs[] = { &Viewport };
+			NumFailedCalls += SLevaluateFeature(sl::kFeatureDeepDVC, *FrameToken, Inputs, UE_ARRAY_COUNT(Inputs), nullptr) != sl::Result::eOk;
+		}
+
+		NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, sl::PCLMarker::eRenderSubmitEnd, *FrameToken) != sl::Result::eOk;
+		NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, sl::PCLMarker::ePresentStart, *FrameToken) != sl::Result::eOk;
+		NumFailedCalls += CALL_SL_FEATURE_FN(sl::kFeaturePCL, slPCLSetMarker, sl::PCLMarker::ePresentEnd, *FrameToken) != sl::Result::eOk;
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	const FStreamlineMockCounters After = GetStreamlineMockCounters();
+
+	AddInfo(FString::Printf(TEXT("%d frames with %u views in %.2f ms, %.3f us per frame, %u tags set in %u slSetTag calls"),
+		NumFrames, NumViews, ElapsedSeconds * 1000.0, ElapsedSeconds * 1000000.0 / NumFrames, After.NumTagsSet - Before.NumTagsSet, After.NumSetTagCalls - Before.NumSetTagCalls));
+
+	TestEqual(TEXT("Failed SL calls"), NumFailedCalls, 0);
+	TestEqual(TEXT("One frame token per frame"), int32(After.NumFrameTokens - Before.NumFrameTokens), NumFrames);
+	TestEqual(TEXT("Constants set once per view and frame"), int32(After.NumSetConstantsCalls - Before.NumSetConstantsCalls), int32(NumFrames * NumViews));
+	TestEqual(TEXT("DeepDVC evaluated once per view and frame"), int32(After.NumEvaluateCalls - Before.NumEvaluateCalls), int32(NumFrames * NumViews));
+	TestEqual(TEXT("Null HUD-less tag only went through on the first frame"), int32(After.NumTagsSet - Before.NumTagsSet), int32(NumViews * (3 * NumFrames + 1)));
+	TestEqual(TEXT("Color, depth and motion vectors stay tagged on every view"), After.NumTaggedBuffers, int32(NumViews * 3));
+	TestTrue(TEXT("DLSS-G reports the memory of its allocated resources"), EstimatedVRAMUsageInBytes > 0 || After.AllocatedBytes == 0);
+
+	for (uint32 ViewID = 0; ViewID < NumViews; ++ViewID)
+	{
+		SLFreeResources(sl::kFeatureDLSS_G, sl::ViewportHandle(ViewID));
+	}
+	TestEqual(TEXT("Freeing the viewports drops their tags"), GetStreamlineMockCounters().NumTaggedBuffers, 0);
+
+	ShutdownStreamlineMock();
+	return true;
+}
+
+#endif
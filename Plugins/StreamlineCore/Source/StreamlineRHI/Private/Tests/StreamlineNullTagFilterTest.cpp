@@ -0,0 +1,165 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineRHI.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#include "sl.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	static const sl::BufferType MockBufferTypes[] = { sl::kBufferTypeScalingInputColor, sl::kBufferTypeDepth, sl::kBufferTypeHUDLessColor, sl::kBufferTypeNoWarpMask };
+	static constexpr int32 NumMockBufferTypes = UE_ARRAY_COUNT(MockBufferTypes);
+
+	// stands in for SL behind the deprecated slSetTag, which keeps the last tag of every buffer of a viewport until it gets tagged again
+	struct FMockTagBackend
+	{
+		TMap<uint64, void*> Tags;
+		int64 NumSetTagCalls = 0;
+		int64 NumTagsSet = 0;
+
+		void SetTag(uint32 ViewID, const sl::ResourceTag* InTags, int32 NumTags)
+		{
+			++NumSetTagCalls;
+			NumTagsSet += NumTags;
+			for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+			{
+				Tags.Add((uint64(ViewID) << 32) | uint64(InTags[TagIndex].type), InTags[TagIndex].resource ? InTags[TagIndex].resource->native : nullptr);
+			}
+		}
+
+		// slFreeResources
+		void ReleaseViewport(uint32 ViewID)
+		{
+			for (TMap<uint64, void*>::TIterator It = Tags.CreateIterator(); It; ++It)
+			{
+				if (uint32(It.Key() >> 32) == ViewID)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		bool HasSameTags(const FMockTagBackend& Other) const
+		{
+			return Tags.OrderIndependentCompareEqual(Other.Tags);
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineNullTagFilterTest, "Streamline.NullTagFilter.RedundantNullTags", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineNullTagFilterTest::RunTest(const FString& Parameters)
+{
+	int32 Texture = 0;
+	sl::Resource Color(sl::ResourceType::eTex2d, &Texture);
+	sl::Resource Null(sl::ResourceType::eTex2d, nullptr);
+
+	auto MakeTags = [&Color, &Null](bool bMaskValid)
+	{
+		return TArray<sl::ResourceTag>
+		{
+			sl::ResourceTag(&Color, sl::kBufferTypeScalingInputColor, sl::eOnlyValidNow),
+			sl::ResourceTag(bMaskValid ? &Color : &Null, sl::kBufferTypeNoWarpMask, sl::eOnlyValidNow),
+			sl::ResourceTag(nullptr, sl::kBufferTypeHUDLessColor, sl::eOnlyValidNow),
+		};
+	};
+
+	FStreamlineNullTagFilter Filter;
+
+	TArray<sl::ResourceTag> Tags = MakeTags(false);
+	TestEqual(TEXT("First null tags go through"), Filter.RemoveRedundantNullTags(0, Tags.GetData(), Tags.Num()), 3);
+
+	Tags = MakeTags(false);
+	TestEqual(TEXT("Repeated null tags are dropped"), Filter.RemoveRedundantNullTags(0, Tags.GetData(), Tags.Num()), 1);
+	TestEqual(TEXT("Valid tag is compacted to the front"), int32(Tags[0].type), int32(sl::kBufferTypeScalingInputColor));
+
+	Tags = MakeTags(false);
+	TestEqual(TEXT("Other viewports are tracked separately"), Filter.RemoveRedundantNullTags(1, Tags.GetData(), Tags.Num()), 3);
+
+	Tags = MakeTags(true);
+	TestEqual(TEXT("Valid tag replaces the null tag"), Filter.RemoveRedundantNullTags(0, Tags.GetData(), Tags.Num()), 2);
+
+	Tags = MakeTags(false);
+	TestEqual(TEXT("Null tag after a valid one goes through"), Filter.RemoveRedundantNullTags(0, Tags.GetData(), Tags.Num()), 2);
+	TestEqual(TEXT("Null tag after a valid one is kept in order"), int32(Tags[1].type), int32(sl::kBufferTypeNoWarpMask));
+
+	Filter.ForgetViewport(0);
+	Tags = MakeTags(false);
+	TestEqual(TEXT("Null tags go through again once the viewport is released"), Filter.RemoveRedundantNullTags(0, Tags.GetData(), Tags.Num()), 3);
+	Tags = MakeTags(false);
+	TestEqual(TEXT("Releasing a viewport leaves the others alone"), Filter.RemoveRedundantNullTags(1, Tags.GetData(), Tags.Num()), 1);
+
+	return true;
+}
+
+// replays random tagging against two mock backends, one fed every tag and one fed only what the filter lets through
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineNullTagFilterReplayTest, "Streamline.NullTagFilter.MockBackendReplay", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineNullTagFilterReplayTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumFrames = 100000;
+	static constexpr uint32 NumViewports = 3;
+
+	FRandomStream Random(1);
+	int32 Textures[8];
+	FMockTagBackend Unfiltered;
+	FMockTagBackend Filtered;
+	FStreamlineNullTagFilter Filter;
+	int32 NumMismatchedFrames = 0;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const uint32 ViewID = uint32(Random.RandHelper(NumViewports));
+
+		// color and depth are nearly always there, the optional buffers are nearly always null
+		TArray<sl::Resource, TInlineAllocator<NumMockBufferTypes>> Resources;
+		TArray<sl::ResourceTag, TInlineAllocator<NumMockBufferTypes>> Tags;
+		for (int32 BufferIndex = 0; BufferIndex < NumMockBufferTypes; ++BufferIndex)
+		{
+			const bool bNull = BufferIndex >= 2 ? Random.RandHelper(50) != 0 : Random.RandHelper(200) == 0;
+			Resources.Emplace(sl::ResourceType::eTex2d, bNull ? nullptr : &Textures[Random.RandHelper(UE_ARRAY_COUNT(Textures))]);
+		}
+		for (int32 BufferIndex = 0; BufferIndex < NumMockBufferTypes; ++BufferIndex)
+		{
+			Tags.Emplace(&Resources[BufferIndex], MockBufferTypes[BufferIndex], sl::eOnlyValidNow);
+		}
+
+		Unfiltered.SetTag(ViewID, Tags.GetData(), Tags.Num());
+		const int32 NumTagsToSet = Filter.RemoveRedundantNullTags(ViewID, Tags.GetData(), Tags.Num());
+		if (NumTagsToSet > 0)
+		{
+			Filtered.SetTag(ViewID, Tags.GetData(), NumTagsToSet);
+		}
+
+		if (Random.RandHelper(500) == 0)
+		{
+			Unfiltered.ReleaseViewport(ViewID);
+			Filtered.ReleaseViewport(ViewID);
+			Filter.ForgetViewport(ViewID);
+		}
+
+		NumMismatchedFrames += Unfiltered.HasSameTags(Filtered) ? 0 : 1;
+	}
+
+	AddInfo(FString::Printf(TEXT("slSetTag calls %lld -> %lld, tags %lld -> %lld"), Unfiltered.NumSetTagCalls, Filtered.NumSetTagCalls, Unfiltered.NumTagsSet, Filtered.NumTagsSet));
+
+	TestEqual(TEXT("Frames where SL would see different tags"), NumMismatchedFrames, 0);
+	TestTrue(TEXT("Redundant null tags were filtered"), Filtered.NumTagsSet < Unfiltered.NumTagsSet * 3 / 4);
+
+	return true;
+}
+
+#endif
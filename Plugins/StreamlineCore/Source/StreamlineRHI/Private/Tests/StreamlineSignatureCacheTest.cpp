@@ -0,0 +1,104 @@
+/*
+* Copyright (c) 2022 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineRHIPrivate.h"
+
+#include "HAL/FileManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && STREAMLINE_CACHE_SIGNATURE_VERIFICATION
+
+// runs the signature cache against fake binaries in a scratch directory, WinVerifyTrust itself isn't involved
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamlineSignatureCacheTest, "Streamline.SignatureCache.FakeBinaries", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamlineSignatureCacheTest::RunTest(const FString& Parameters)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	const FString TestDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("StreamlineSignatureCache")));
+	const FString CacheFilename = FPaths::Combine(TestDir, TEXT("SignatureCache.txt"));
+	const FString BinaryPath = FPaths::Combine(TestDir, TEXT("sl.interposer.dll"));
+	const FString OtherBinaryPath = FPaths::Combine(TestDir, TEXT("sl.common.dll"));
+	FileManager.DeleteDirectory(*TestDir, false, true);
+
+	// about the size of the interposer
+	TArray<uint8> Contents;
+	Contents.SetNumUninitialized(4 << 20);
+	FRandomStream Random(49);
+	for (uint8& Byte : Contents)
+	{
+		Byte = uint8(Random.RandHelper(256));
+	}
+
+	auto Describe = [this](const FString& Path)
+	{
+		FString Description;
+		TestTrue(FString::Printf(TEXT("Describing %s"), *Path), StreamlineSignatureCache::DescribeBinary(Path, Description));
+		return Description;
+	};
+
+	TestTrue(TEXT("Writing the fake binary"), FFileHelper::SaveArrayToFile(Contents, *BinaryPath));
+	FString Description = Describe(BinaryPath);
+	TestFalse(TEXT("First run misses"), StreamlineSignatureCache::Contains(CacheFilename, Description));
+	StreamlineSignatureCache::Add(CacheFilename, BinaryPath, Description);
+	TestTrue(TEXT("Second run hits"), StreamlineSignatureCache::Contains(CacheFilename, Describe(BinaryPath)));
+
+	// touching the binary is enough to verify it again
+	const FDateTime OriginalTimeStamp = FileManager.GetTimeStamp(*BinaryPath);
+	FileManager.SetTimeStamp(*BinaryPath, OriginalTimeStamp + FTimespan::FromSeconds(2.0));
+	TestFalse(TEXT("Touched binary misses"), StreamlineSignatureCache::Contains(CacheFilename, Describe(BinaryPath)));
+	FileManager.SetTimeStamp(*BinaryPath, OriginalTimeStamp);
+	TestTrue(TEXT("Binary hits again with its original time stamp"), StreamlineSignatureCache::Contains(CacheFilename, Describe(BinaryPath)));
+
+	// a patched binary with the same size and time stamp fails verification, so it never gets added
+	Contents[100] ^= 1;
+	TestTrue(TEXT("Patching the fake binary"), FFileHelper::SaveArrayToFile(Contents, *BinaryPath));
+	FileManager.SetTimeStamp(*BinaryPath, OriginalTimeStamp);
+	TestFalse(TEXT("Patched binary with the same size and time stamp misses"), StreamlineSignatureCache::Contains(CacheFilename, Describe(BinaryPath)));
+	TestFalse(TEXT("Patched binary keeps missing"), StreamlineSignatureCache::Contains(CacheFilename, Describe(BinaryPath)));
+
+	// an update replaces the entry of the previous version instead of adding another one
+	Contents[100] ^= 1;
+	Contents[200] ^= 1;
+	TestTrue(TEXT("Updating the fake binary"), FFileHelper::SaveArrayToFile(Contents, *BinaryPath));
+	const FString UpdatedDescription = Describe(BinaryPath);
+	StreamlineSignatureCache::Add(CacheFilename, BinaryPath, UpdatedDescription);
+	TestTrue(TEXT("Updated binary hits"), StreamlineSignatureCache::Contains(CacheFilename, UpdatedDescription));
+	TestFalse(TEXT("Previous version no longer hits"), StreamlineSignatureCache::Contains(CacheFilename, Description));
+
+	TestTrue(TEXT("Writing another fake binary"), FFileHelper::SaveArrayToFile(TArrayView<const uint8>(Contents.GetData(), 1024), *OtherBinaryPath));
+	StreamlineSignatureCache::Add(CacheFilename, OtherBinaryPath, Describe(OtherBinaryPath));
+
+	TArray<FString> Lines;
+	FFileHelper::LoadFileToStringArray(Lines, *CacheFilename);
+	TestEqual(TEXT("One entry per binary"), Lines.Num(), 2);
+
+	// entries edited by hand or copied from another machine don't match their HMAC
+	for (FString& Line : Lines)
+	{
+		if (Line.StartsWith(BinaryPath + TEXT("\t")))
+		{
+			TCHAR& LastChar = Line[Line.Len() - 1];
+			LastChar = LastChar == TEXT('0') ? TEXT('1') : TEXT('0');
+		}
+	}
+	FFileHelper::SaveStringArrayToFile(Lines, *CacheFilename);
+	AddExpectedError(TEXT("Ignoring modified entry"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Entry with a modified HMAC misses"), StreamlineSignatureCache::Contains(CacheFilename, UpdatedDescription));
+	TestTrue(TEXT("Untouched entries still hit"), StreamlineSignatureCache::Contains(CacheFilename, Describe(OtherBinaryPath)));
+
+	FileManager.DeleteDirectory(*TestDir, false, true);
+	return true;
+}
+
+#endif
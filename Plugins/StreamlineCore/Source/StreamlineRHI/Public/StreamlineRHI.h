@@ -18,6 +18,9 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "Misc/EngineVersionComparison.h"
 #include "RHIAccess.h"
+
+#include <atomic>
+
 #define UE_VERSION_AT_LEAST(MajorVersion, MinorVersion, PatchVersion) (!UE_VERSION_OLDER_THAN(MajorVersion, MinorVersion, PatchVersion))
 
 
@@ -27,6 +30,7 @@ namespace sl
 	struct FrameToken;
 	struct APIError;
 	struct FeatureRequirements;
+	struct ResourceTag;
 	using Feature = uint32_t;
 	enum class FeatureRequirementFlags : uint32_t;
 }
@@ -199,17 +203,55 @@ struct FStreamlineRHICreateArguments
 	FDynamicRHI* DynamicRHI = nullptr;
 };
 
+// Hands out one SL frame token per engine frame to the game, render and RHI threads.
+// Tokens of the last few frames are cached in a ring indexed by frame number so threads working on different frames
+// don't keep replacing each other's token. Lookups are lock-free, only fetching a new token from SL takes the lock
+// since slGetNewFrameToken isn't thread safe.
 class FSLFrameTokenProvider
 {
 public:
-	FSLFrameTokenProvider();
+	// fetches a new token for the (32 bit) frame index, slGetNewFrameToken unless overridden for testing
+	typedef sl::FrameToken* (*FNewFrameTokenFunction)(uint32_t FrameIndex);
+
+	explicit FSLFrameTokenProvider(FNewFrameTokenFunction InNewFrameToken = nullptr, uint64 InitialFrameCounter = GFrameCounter);
 
 	sl::FrameToken* GetTokenForFrame(uint64 FrameCounter);
 
 private:
+	sl::FrameToken* FindCachedToken(uint64 FrameCounter) const;
+	static sl::FrameToken* GetNewFrameTokenFromSL(uint32_t FrameIndex);
+
+	// game, render and RHI thread are at most a couple of frames apart
+	static constexpr uint32 NumTokenSlots = 4;
+	static constexpr uint64 InvalidFrame = MAX_uint64;
+
+	struct FTokenSlot
+	{
+		// the full 64 bit frame so frames 2^32 apart don't alias even though SL only gets the lower 32 bits
+		std::atomic<uint64> Frame{ InvalidFrame };
+		std::atomic<sl::FrameToken*> Token{ nullptr };
+	};
+
+	FTokenSlot TokenSlots[NumTokenSlots];
 	FCriticalSection Section;
-	sl::FrameToken* FrameToken;
-	uint32_t LastFrameCounter;
+	FNewFrameTokenFunction NewFrameToken;
+};
+
+// With the deprecated slSetTag a null tag stays in effect until the buffer gets tagged again, so repeating it every frame is redundant.
+// Remembers which buffers of which viewport were last null tagged. Not for slSetTagForFrame, those tags are per frame
+class FStreamlineNullTagFilter
+{
+public:
+	// Compacts Tags in place and returns how many still need to be passed to slSetTag
+	int32 RemoveRedundantNullTags(uint32 InViewID, sl::ResourceTag* Tags, int32 NumTags);
+
+	// SL might have forgotten about the tags of the viewport, its next null tags go through again
+	void ForgetViewport(uint32 InViewID);
+	void Reset() { NullTaggedBuffers.Reset(); }
+
+private:
+	// (ViewID << 32) | sl::BufferType of the buffers whose last slSetTag was a null tag
+	TSet<uint64> NullTaggedBuffers;
 };
 
 
@@ -250,6 +292,9 @@ protected:
 
 
 	TTuple<bool, FString> IsSwapChainProviderRequired(const sl::AdapterInfo& AdapterInfo) const;
+
+	// Compacts Tags in place and returns how many still need to be passed to slSetTag, see FStreamlineNullTagFilter
+	int32 RemoveRedundantNullTags(uint32 InViewID, sl::ResourceTag* Tags, int32 NumTags);
 public:
 	virtual bool IsDLSSGSupportedByRHI() const
 	{
@@ -333,6 +378,8 @@ protected:
 	TArray<sl::Feature> LoadedFeatures;
 	TArray<sl::Feature> SupportedFeatures;
 
+	FStreamlineNullTagFilter NullTagFilter;
+
 };
 
 class IStreamlineRHIModule : public IModuleInterface
@@ -42,6 +42,8 @@
 #include "Kismet/GameplayStatics.h"
 #include "XeSSUnrealRHI.h"
 
+#include "XeLLPredictiveFrameLimiter.h"
+
 int32 DisableXeLLTickRateHandler = 0;
 static FAutoConsoleVariableRef CVarDisableXeLLTickRateHandler(
 	TEXT("r.XeLL.DisableTickRateHandler"),
@@ -55,12 +57,39 @@ static TAutoConsoleVariable<int> CVarXeLLMinIntervalUS(
 	TEXT("The XeLL minimum interval time in us. -1: using engine default > 0: override engine settings"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<bool> CVarXeLLPredictiveFrameLimiter(
+	TEXT("r.XeLL.PredictiveFrameLimiter"),
+	false,
+	TEXT("Limit the frame rate with the plugin's predictive frame limiter instead of the XeLL minimum interval, see r.XeLL.PredictiveFrameLimiter.*"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarXeLLFrameLimiterPercentile(
+	TEXT("r.XeLL.PredictiveFrameLimiter.Percentile"),
+	0.95f,
+	TEXT("Percentile of the recent frame costs the predictive frame limiter budgets for the next frame (default = 0.95)\n")
+	TEXT("Higher values miss fewer deadlines, lower values start frames later and reduce latency further"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarXeLLFrameLimiterMarginMs(
+	TEXT("r.XeLL.PredictiveFrameLimiter.MarginMs"),
+	1.0f,
+	TEXT("Safety margin in milliseconds added to the predicted frame cost (default = 1.0)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarXeLLFrameLimiterSpinMs(
+	TEXT("r.XeLL.PredictiveFrameLimiter.SpinMs"),
+	1.0f,
+	TEXT("How long before the wake up time the predictive frame limiter stops sleeping and starts spinning, in milliseconds (default = 1.0)"),
+	ECVF_Default);
+
 DEFINE_LOG_CATEGORY_STATIC(LogMaxTickRateHandler, Log, All);
 
-FXeLLMaxTickRateHandler::FXeLLMaxTickRateHandler(xell_context_handle_t InXeLLContext) : XeLLContext(InXeLLContext)
+FXeLLMaxTickRateHandler::FXeLLMaxTickRateHandler(xell_context_handle_t InXeLLContext) : XeLLContext(InXeLLContext), FrameLimiter(MakeUnique<FXeLLPredictiveFrameLimiter>())
 {
 }
 
+FXeLLMaxTickRateHandler::~FXeLLMaxTickRateHandler() = default;
+
 void FXeLLMaxTickRateHandler::SetEnabled(bool bInEnabled)
 {
 	bEnabled = bInEnabled;
@@ -187,7 +216,10 @@ bool FXeLLMaxTickRateHandler::HandleMaxTickRate(float DesiredMaxTickRate)
 	if (GetAvailable())
 	{
 		int XeLLMinIntervalUS = CVarXeLLMinIntervalUS.GetValueOnAnyThread();
-		const float DesiredMinimumInterval = XeLLMinIntervalUS < 0 ? (DesiredMaxTickRate > 0 ? ((1000.0f / DesiredMaxTickRate) * 1000.0f) : 0.0f) : XeLLMinIntervalUS;
+		const float LimiterMinimumInterval = XeLLMinIntervalUS < 0 ? (DesiredMaxTickRate > 0 ? ((1000.0f / DesiredMaxTickRate) * 1000.0f) : 0.0f) : XeLLMinIntervalUS;
+		// With the predictive limiter XeLL is told not to limit, the limiter waits before xellSleep instead
+		const bool bUsePredictiveFrameLimiter = CVarXeLLPredictiveFrameLimiter.GetValueOnAnyThread();
+		const float DesiredMinimumInterval = bUsePredictiveFrameLimiter ? 0.0f : LimiterMinimumInterval;
 		if (bEnabled)
 		{
 			xell_result_t ret;
@@ -247,12 +279,27 @@ bool FXeLLMaxTickRateHandler::HandleMaxTickRate(float DesiredMaxTickRate)
 				bBoost = false;
 			}
 		}
+		if (bUsePredictiveFrameLimiter && LimiterMinimumInterval > 0.0f)
+		{
+			FXeLLPredictiveFrameLimiter::FSettings Settings;
+			Settings.Percentile = CVarXeLLFrameLimiterPercentile.GetValueOnAnyThread();
+			Settings.MarginSeconds = CVarXeLLFrameLimiterMarginMs.GetValueOnAnyThread() / 1000.0;
+			Settings.SpinSeconds = CVarXeLLFrameLimiterSpinMs.GetValueOnAnyThread() / 1000.0;
+			FrameLimiter->Wait(LimiterMinimumInterval / 1.0E6, Settings);
+		}
+		else
+		{
+			FrameLimiter->Reset();
+		}
+
 		// Always call xellSleep per XeLL developer guide
 		xell_result_t ret = xellSleep(XeLLContext, GFrameCounter);
 		if (ret != XELL_RESULT_SUCCESS)
 		{
 			UE_LOG(LogMaxTickRateHandler, Warning, TEXT("Unable to run XeLL low latency sleep, result: %d"), ret);
 		}
+		// The frame starts once xellSleep lets it go, so that's where its cost is measured from
+		FrameLimiter->OnFrameStarted(FPlatformTime::Seconds());
 		return true;
 	}
 
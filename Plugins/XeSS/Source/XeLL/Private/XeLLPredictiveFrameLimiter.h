@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * Copyright 2024 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+// Frame limiter that aims for each frame to finish on its deadline rather than to start on it.
+// The CPU cost of the next frame is predicted from the recent history, so the frame can start as late as possible
+// and sample input closer to when it gets presented. Waiting sleeps for the bulk of the time and spins for the
+// remainder so the wake up doesn't depend on the granularity of the OS scheduler.
+//
+// Used by the XeLL max tick rate handler in place of the XeLL minimum interval. Tuning comes from the caller, which owns
+// the console variables.
+class FXeLLPredictiveFrameLimiter
+{
+public:
+	struct FSettings
+	{
+		// Percentile of the recent frame costs that is budgeted for the next frame
+		double Percentile = 0.95;
+		// Added to the predicted frame cost
+		double MarginSeconds = 0.001;
+		// How long before the wake up time to stop sleeping and start spinning
+		double SpinSeconds = 0.001;
+	};
+
+	// Blocks until the next frame should start, returns the time spent waiting in seconds.
+	// The caller reports the actual start with OnFrameStarted once anything else that blocks the frame, such as the
+	// vendor SDK sleep, has returned
+	double Wait(double TargetIntervalSeconds, const FSettings& Settings)
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		const double StartTime = ScheduleNextFrame(CurrentTime, TargetIntervalSeconds, Settings);
+
+		if (StartTime > CurrentTime)
+		{
+			WaitUntil(StartTime, Settings.SpinSeconds);
+		}
+
+		return FPlatformTime::Seconds() - CurrentTime;
+	}
+
+	// Records the cost of the frame ending at CurrentTime and returns the time at which the next frame should start.
+	// A target interval of 0 disables limiting and forgets the history
+	double ScheduleNextFrame(double CurrentTime, double TargetIntervalSeconds, const FSettings& Settings)
+	{
+		if (TargetIntervalSeconds <= 0.0)
+		{
+			Reset();
+			return CurrentTime;
+		}
+
+		// without a reported start there is nothing to measure, the frame still counts for the deadline cadence
+		if (bFrameStarted)
+		{
+			FrameCostHistory[NextHistoryIndex] = FMath::Max(CurrentTime - LastFrameStartTime, 0.0);
+			NextHistoryIndex = (NextHistoryIndex + 1) % NumHistoryFrames;
+			NumRecordedFrames = FMath::Min(NumRecordedFrames + 1, NumHistoryFrames);
+		}
+		bFrameStarted = false;
+
+		const double PredictedCost = PredictFrameCost(Settings);
+		double Deadline = LastFrameDeadline + TargetIntervalSeconds;
+
+		if (!bHasDeadline)
+		{
+			Deadline = CurrentTime + PredictedCost;
+		}
+		else if (Deadline - PredictedCost < CurrentTime)
+		{
+			// Too late for this deadline, move on to the first one that can still be made rather than catching up with a burst
+			// of short frames. Staying on the same cadence keeps the deadlines in phase with whatever consumes the frames
+			Deadline += FMath::CeilToDouble((CurrentTime + PredictedCost - Deadline) / TargetIntervalSeconds) * TargetIntervalSeconds;
+		}
+
+		bHasDeadline = true;
+		LastFrameDeadline = Deadline;
+		return FMath::Max(CurrentTime, Deadline - PredictedCost);
+	}
+
+	// The frame cost is measured from here to the next ScheduleNextFrame
+	void OnFrameStarted(double StartTime)
+	{
+		if (bHasDeadline)
+		{
+			bFrameStarted = true;
+			LastFrameStartTime = StartTime;
+		}
+	}
+
+	double PredictFrameCost(const FSettings& Settings) const
+	{
+		if (NumRecordedFrames == 0)
+		{
+			return 0.0;
+		}
+
+		double SortedCosts[NumHistoryFrames];
+		FMemory::Memcpy(SortedCosts, FrameCostHistory, NumRecordedFrames * sizeof(double));
+		Sort(SortedCosts, NumRecordedFrames);
+
+		const double Percentile = FMath::Clamp(Settings.Percentile, 0.0, 1.0);
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(static_cast<float>(Percentile * NumRecordedFrames)) - 1, 0, NumRecordedFrames - 1);
+		return SortedCosts[Index] + FMath::Max(0.0, Settings.MarginSeconds);
+	}
+
+	double GetLastFrameDeadline() const { return LastFrameDeadline; }
+
+	void Reset()
+	{
+		NumRecordedFrames = 0;
+		NextHistoryIndex = 0;
+		bHasDeadline = false;
+		bFrameStarted = false;
+		LastFrameStartTime = 0.0;
+		LastFrameDeadline = 0.0;
+	}
+
+	// Sleeps until SpinThresholdSeconds before TargetTime, then spins until TargetTime
+	static void WaitUntil(double TargetTime, double SpinThresholdSeconds)
+	{
+		SpinThresholdSeconds = FMath::Max(SpinThresholdSeconds, 0.0);
+		for (double Remaining = TargetTime - FPlatformTime::Seconds(); Remaining > 0.0; Remaining = TargetTime - FPlatformTime::Seconds())
+		{
+			if (Remaining > SpinThresholdSeconds)
+			{
+				FPlatformProcess::SleepNoStats(static_cast<float>(Remaining - SpinThresholdSeconds));
+			}
+			else
+			{
+				// Sleep(0) only gives up the rest of the time slice
+				FPlatformProcess::SleepNoStats(0.0f);
+			}
+		}
+	}
+
+private:
+	static constexpr int32 NumHistoryFrames = 32;
+
+	double FrameCostHistory[NumHistoryFrames] = {};
+	int32 NumRecordedFrames = 0;
+	int32 NextHistoryIndex = 0;
+
+	bool bHasDeadline = false;
+	bool bFrameStarted = false;
+	double LastFrameStartTime = 0.0;
+	double LastFrameDeadline = 0.0;
+};
@@ -30,12 +30,13 @@
 #include "Performance/MaxTickRateHandlerModule.h"
 
 typedef struct _xell_context_handle_t* xell_context_handle_t;
+class FXeLLPredictiveFrameLimiter;
 
 class FXeLLMaxTickRateHandler : public IMaxTickRateHandlerModule, public FSelfRegisteringExec
 {
 public:
 	explicit FXeLLMaxTickRateHandler(xell_context_handle_t InXeLLContext);
-	virtual ~FXeLLMaxTickRateHandler() {}
+	virtual ~FXeLLMaxTickRateHandler();
 
 	void Initialize() override {};
 	void SetEnabled(bool bInEnabled) override;
@@ -62,5 +63,6 @@ private:
 	uint32 LastCustomFlags = 0;
 
 	xell_context_handle_t XeLLContext = nullptr;
+	TUniquePtr<FXeLLPredictiveFrameLimiter> FrameLimiter;
 };
 #endif
@@ -35,6 +35,7 @@
 #include "XeSSCommonUtil.h"
 #include "XeSSRHI.h"
 #include "XeSSSDKLoader.h"
+#include "XeSSSDKWrapperMock.h"
 #include "XeSSUpscaler.h"
 #include "XeSSUtil.h"
 
@@ -80,7 +81,22 @@ void FXeSSModule::StartupModule()
 	}
 
 	check(GDynamicRHI);
-	const FString RHIName = FString(GDynamicRHI->GetName());
+	FString RHIName = FString(GDynamicRHI->GetName());
+#if XESS_SDK_MOCK
+	// XeSSMockRHI runs on any RHI, it never touches the native resources
+	if (FParse::Param(FCommandLine::Get(), TEXT("xessmock")))
+	{
+		// Editor targets and shipping builds don't have the module
+		if (!FModuleManager::Get().ModuleExists(TEXT("XeSSMockRHI")))
+		{
+			UE_LOG(LogXeSSModule, Warning, TEXT("Ignoring -xessmock, XeSSMockRHI isn't part of this target"));
+			return;
+		}
+		UE_LOG(LogXeSSModule, Log, TEXT("XeSS SDK mocked by command line option, nothing is upscaled"));
+		RHIName = XESS_SDK_MOCK_NAME;
+	}
+	else
+#endif
 	if (RHIName != TEXT("D3D12") && RHIName != TEXT("D3D11") && RHIName != TEXT("Vulkan"))
 	{
 		const auto CVarXeSSEnabled = IConsoleManager::Get().FindConsoleVariable(TEXT("r.XeSS.Enabled"));
@@ -162,27 +162,40 @@ FXeSSRHI::FXeSSRHI()
 
 FXeSSRHI::~FXeSSRHI()
 {
-	if (!bXeSSInitialized)
+	if (bXeSSInitialized)
 	{
-		return;
-	}
-	xess_result_t Result = XeSSSDKWrapper->xessDestroyContext(XeSSContext);
-	if (Result == XESS_RESULT_SUCCESS)
-	{
-		UE_LOG(LogXeSSRHI, Log, TEXT("Removed Intel XeSS effect"));
+		// The callbacks were bound to this instance
+		IConsoleManager::Get().FindConsoleVariable(TEXT("r.XeSS.Enabled"))->AsVariable()->SetOnChangedCallback(FConsoleVariableDelegate());
+		IConsoleManager::Get().FindConsoleVariable(TEXT("r.XeSS.Quality"))->AsVariable()->SetOnChangedCallback(FConsoleVariableDelegate());
 	}
-	else
+	// A context is also left behind when initialization failed after creating it
+	if (XeSSContext)
 	{
-		UE_LOG(LogXeSSRHI, Warning, TEXT("Failed to remove XeSS effect"));
+		xess_result_t Result = XeSSSDKWrapper->xessDestroyContext(XeSSContext);
+		if (Result == XESS_RESULT_SUCCESS)
+		{
+			UE_LOG(LogXeSSRHI, Log, TEXT("Removed Intel XeSS effect"));
+		}
+		else
+		{
+			UE_LOG(LogXeSSRHI, Warning, TEXT("Failed to remove XeSS effect"));
+		}
+		XeSSContext = nullptr;
 	}
+	// Unload after a failed initialization too, so the next FXeSSRHI can load a different SDK wrapper
 	FXeSSSDKLoader::Unload();
 }
 
+const TCHAR* FXeSSRHI::GetXeSSSDKWrapperName() const
+{
+	return GDynamicRHI->GetName();
+}
+
 bool FXeSSRHI::Initialize()
 {
 	check(GDynamicRHI);
 
-	const TCHAR* RHIName = GDynamicRHI->GetName();
+	const TCHAR* RHIName = GetXeSSSDKWrapperName();
 	XeSSSDKWrapper = FXeSSSDKLoader::Load(RHIName);
 	check(XeSSSDKWrapper);
 
@@ -67,6 +67,8 @@ public:
 	virtual void RHIExecuteXeSS(const FXeSSExecuteArguments& InArguments, FRHICommandListBase& ExecutingCmdList) = 0;
 	virtual xess_result_t CreateXeSSContext(xess_context_handle_t* OutXeSSContext) = 0;
 	virtual xess_result_t BuildXeSSPipelines(xess_context_handle_t InXeSSContext, uint32_t InInitFlags) = 0;
+	// Name FXeSSSDKLoader picks the SDK wrapper by, the RHI name unless the SDK is mocked
+	virtual const TCHAR* GetXeSSSDKWrapperName() const;
 
 	bool EffectRecreationIsRequired(const FXeSSInitArguments& NewArgs) const;
 	float GetMinSupportedResolutionFraction();
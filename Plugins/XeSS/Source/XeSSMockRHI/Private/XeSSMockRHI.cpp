@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * Copyright 2024 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+#include "XeSSMockRHI.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "RenderUtils.h"
+#include "RHICommandList.h"
+#include "XeSSSDKWrapperMock.h"
+#include "XeSSUtil.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogXeSSMockRHI, Log, All);
+
+FXeSSMockRHI::FXeSSMockRHI()
+{
+}
+
+FXeSSMockRHI::~FXeSSMockRHI()
+{
+}
+
+void FXeSSMockRHI::OnXeSSSDKLoaded()
+{
+	check(XeSSSDKWrapper);
+
+	XeSSSDKWrapperMock = static_cast<FXeSSSDKWrapperMock*>(XeSSSDKWrapper);
+}
+
+void FXeSSMockRHI::RHIInitializeXeSS(const FXeSSInitArguments& InArguments)
+{
+	if (!IsXeSSInitialized())
+	{
+		return;
+	}
+	InitArgs = InArguments;
+
+	xess_mock_init_params_t InitParams = {};
+	InitParams.outputResolution.x = InArguments.OutputWidth;
+	InitParams.outputResolution.y = InArguments.OutputHeight;
+	InitParams.initFlags = InArguments.InitFlags;
+	InitParams.qualitySetting = XeSSUtil::ToXeSSQualitySetting(InArguments.QualitySetting);
+
+	xess_result_t Result = XeSSSDKWrapperMock->xessMockInit(XeSSContext, &InitParams);
+	if (XESS_RESULT_SUCCESS != Result)
+	{
+		UE_LOG(LogXeSSMockRHI, Error, TEXT("Failed to initialize mocked Intel XeSS, result: %d"), Result);
+	}
+}
+
+void FXeSSMockRHI::RHIExecuteXeSS(const FXeSSExecuteArguments& InArguments, FRHICommandListBase& ExecutingCmdList)
+{
+	if (!IsXeSSInitialized())
+	{
+		return;
+	}
+	// The mock only checks the textures for null, it doesn't need the native resources
+	xess_mock_execute_params_t ExecuteParams{};
+	ExecuteParams.pColorTexture = InArguments.ColorTexture;
+	ExecuteParams.pVelocityTexture = InArguments.VelocityTexture;
+	ExecuteParams.pOutputTexture = InArguments.OutputTexture;
+	ExecuteParams.jitterOffsetX = InArguments.JitterOffsetX;
+	ExecuteParams.jitterOffsetY = InArguments.JitterOffsetY;
+	ExecuteParams.resetHistory = InArguments.bCameraCut;
+	ExecuteParams.inputWidth = InArguments.SrcViewRect.Width();
+	ExecuteParams.inputHeight = InArguments.SrcViewRect.Height();
+	ExecuteParams.inputColorBase.x = InArguments.SrcViewRect.Min.X;
+	ExecuteParams.inputColorBase.y = InArguments.SrcViewRect.Min.Y;
+	ExecuteParams.outputColorBase.x = InArguments.DstViewRect.Min.X;
+	ExecuteParams.outputColorBase.y = InArguments.DstViewRect.Min.Y;
+	ExecuteParams.exposureScale = 1.0f;
+
+	xess_result_t Result = XeSSSDKWrapperMock->xessMockExecute(XeSSContext, &ExecuteParams);
+	if (XESS_RESULT_SUCCESS != Result)
+	{
+		UE_LOG(LogXeSSMockRHI, Error, TEXT("Failed to execute mocked XeSS, result: %d"), Result);
+	}
+}
+
+xess_result_t FXeSSMockRHI::CreateXeSSContext(xess_context_handle_t* OutXeSSContext)
+{
+	return XeSSSDKWrapperMock->xessMockCreateContext(OutXeSSContext);
+}
+
+xess_result_t FXeSSMockRHI::BuildXeSSPipelines(xess_context_handle_t InXeSSContext, uint32_t InInitFlags)
+{
+	return XeSSSDKWrapperMock->xessMockBuildPipelines(InXeSSContext, InInitFlags);
+}
+
+const TCHAR* FXeSSMockRHI::GetXeSSSDKWrapperName() const
+{
+	return XESS_SDK_MOCK_NAME;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// CPU cost per frame of what the XeSS upscaler asks of its RHI module: the re-initialization check, a re-initialization
+// whenever the quality changes and the execution. Runs against the SDK mock so it needs neither an XeSS capable GPU nor the SDK
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FXeSSMockFrameCostBenchmark, "XeSS.Mock.FrameCostBenchmark", EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FXeSSMockFrameCostBenchmark::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumFrames = 5000;
+	static constexpr int32 FramesPerQualitySetting = 500;
+	static const FIntPoint OutputResolution(2560, 1440);
+
+	static const auto CVarXeSSSupported = IConsoleManager::Get().FindConsoleVariable(TEXT("r.XeSS.Supported"));
+	if (CVarXeSSSupported && CVarXeSSSupported->GetBool())
+	{
+		AddInfo(TEXT("XeSS is already running in this process, the benchmark needs the SDK loader to itself"));
+		return true;
+	}
+	FRHITexture* InputTexture = GBlackTexture ? GBlackTexture->GetTextureRHI() : nullptr;
+	FRHITexture* OutputTexture = GWhiteTexture ? GWhiteTexture->GetTextureRHI() : nullptr;
+	if (!InputTexture || !OutputTexture)
+	{
+		AddInfo(TEXT("No RHI textures to pass to the mock"));
+		return true;
+	}
+
+	FXeSSMockRHI MockRHI;
+	if (!TestTrue(TEXT("XeSS mock initialized"), MockRHI.Initialize()))
+	{
+		return false;
+	}
+	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+
+	FXeSSExecuteArguments ExecuteArgs;
+	ExecuteArgs.ColorTexture = InputTexture;
+	ExecuteArgs.VelocityTexture = InputTexture;
+	ExecuteArgs.OutputTexture = OutputTexture;
+	ExecuteArgs.DstViewRect = FIntRect(FIntPoint::ZeroValue, OutputResolution);
+	int32 NumReinitializations = 0;
+
+	const FXeSSSDKWrapperMock::FCounters Before = FXeSSSDKWrapperMock::GetCounters();
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		FXeSSInitArguments InitArgs;
+		InitArgs.OutputWidth = OutputResolution.X;
+		InitArgs.OutputHeight = OutputResolution.Y;
+		InitArgs.QualitySetting = (Frame / FramesPerQualitySetting) % XeSSUtil::XESS_QUALITY_SETTING_COUNT;
+		InitArgs.InitFlags = MockRHI.GetXeSSInitFlags();
+
+		ExecuteArgs.bCameraCut = 0;
+		if (MockRHI.EffectRecreationIsRequired(InitArgs))
+		{
+			ExecuteArgs.bCameraCut = 1;
+			MockRHI.RHIInitializeXeSS(InitArgs);
+			++NumReinitializations;
+		}
+
+		const float ResolutionFraction = MockRHI.GetOptimalResolutionFraction(XeSSUtil::ToXeSSQualitySetting(InitArgs.QualitySetting));
+		ExecuteArgs.SrcViewRect = FIntRect(FIntPoint::ZeroValue, FIntPoint(FMath::CeilToInt(OutputResolution.X * ResolutionFraction), FMath::CeilToInt(OutputResolution.Y * ResolutionFraction)));
+		ExecuteArgs.JitterOffsetX = float(Frame & 7) / 8.0f - 0.5f;
+		ExecuteArgs.JitterOffsetY = float(Frame & 3) / 4.0f - 0.5f;
+		MockRHI.RHIExecuteXeSS(ExecuteArgs, RHICmdList);
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	const FXeSSSDKWrapperMock::FCounters After = FXeSSSDKWrapperMock::GetCounters();
+
+	AddInfo(FString::Printf(TEXT("%d frames at %dx%d in %.2f ms, %.3f us per frame, %d re-initializations"),
+		NumFrames, OutputResolution.X, OutputResolution.Y, ElapsedSeconds * 1000.0, ElapsedSeconds * 1000000.0 / NumFrames, NumReinitializations));
+
+	TestEqual(TEXT("One re-initialization per quality setting"), NumReinitializations, NumFrames / FramesPerQualitySetting);
+	TestEqual(TEXT("Every re-initialization reached the SDK"), int32(After.NumInits - Before.NumInits), NumReinitializations);
+	TestEqual(TEXT("Every frame executed"), int32(After.NumExecutes - Before.NumExecutes), NumFrames);
+	static const auto CVarXeSSMockMemoryBytesPerPixel = IConsoleManager::Get().FindConsoleVariable(TEXT("r.XeSS.Mock.MemoryBytesPerPixel"));
+	TestTrue(TEXT("The context holds the memory of its output resolution"), After.AllocatedBytes > 0 || CVarXeSSMockMemoryBytesPerPixel->GetInt() <= 0);
+
+	return true;
+}
+
+#endif
@@ -25,6 +25,7 @@
 #include "XeSSCommonUtil.h"
 #include "XeSSSDKWrapperD3D11.h"
 #include "XeSSSDKWrapperD3D12.h"
+#include "XeSSSDKWrapperMock.h"
 #include "XeSSSDKWrapperVulkan.h"
 
 static TUniquePtr<FXeSSSDKWrapperBase> XeSSSDKWrapper;
@@ -51,6 +52,12 @@ FXeSSSDKWrapperBase* FXeSSSDKLoader::Load(const TCHAR* InRHIName)
 	{
 		XeSSSDKWrapper.Reset(new FXeSSSDKWrapperVulkan(InRHIName));
 	}
+#if XESS_SDK_MOCK
+	else if (RHIName == XESS_SDK_MOCK_NAME)
+	{
+		XeSSSDKWrapper.Reset(new FXeSSSDKWrapperMock(InRHIName));
+	}
+#endif
 	if (XeSSSDKWrapper)
 	{
 		XeSSSDKWrapper->Load();
@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * Copyright 2024 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "XeSSSDKWrapperMock.h"
+
+#if XESS_SDK_MOCK
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "XeSSSDKPrivate.h"
+
+DECLARE_STATS_GROUP(TEXT("XeSS Mock"), STATGROUP_XeSSMock, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Simulated SDK latency"), STAT_XeSSMockSimulatedLatency, STATGROUP_XeSSMock);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mock executions"), STAT_XeSSMockExecutions, STATGROUP_XeSSMock);
+
+static TAutoConsoleVariable<float> CVarXeSSMockInitLatencyMs(
+	TEXT("r.XeSS.Mock.InitLatencyMs"), 0.0f,
+	TEXT("Time in ms the mock XeSS SDK spends in each context initialization, to emulate the driver side cost (default 0)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarXeSSMockExecuteLatencyMs(
+	TEXT("r.XeSS.Mock.ExecuteLatencyMs"), 0.0f,
+	TEXT("Time in ms the mock XeSS SDK spends in each execution, to emulate the driver side cost (default 0)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarXeSSMockMemoryBytesPerPixel(
+	TEXT("r.XeSS.Mock.MemoryBytesPerPixel"), 40,
+	TEXT("Video memory the mock XeSS SDK accounts per output pixel of each initialized context (default 40)\n"),
+	ECVF_Default);
+
+namespace
+{
+	struct FXeSSMockContext
+	{
+		xess_mock_init_params_t InitParams = {};
+		bool bPipelinesBuilt = false;
+		bool bInitialized = false;
+		uint64 MemoryBytes = 0;
+	};
+
+	FCriticalSection MockSection;
+	TSet<FXeSSMockContext*> MockContexts;
+	FXeSSSDKWrapperMock::FCounters MockCounters;
+
+	// busy wait instead of sleeping so the simulated SDK cost shows up on the calling thread like a real blocking driver call
+	void SimulateLatency(float InMilliseconds)
+	{
+		if (InMilliseconds <= 0.0f)
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_XeSSMockSimulatedLatency);
+		const double EndTime = FPlatformTime::Seconds() + InMilliseconds / 1000.0;
+		while (FPlatformTime::Seconds() < EndTime)
+		{
+			FPlatformProcess::Yield();
+		}
+	}
+
+	// Caller holds MockSection
+	FXeSSMockContext* FindContext(xess_context_handle_t InContext)
+	{
+		FXeSSMockContext* Context = reinterpret_cast<FXeSSMockContext*>(InContext);
+		return MockContexts.Contains(Context) ? Context : nullptr;
+	}
+
+	// Ratio of output to input resolution of the XeSS presets
+	float GetUpscaleRatio(xess_quality_settings_t InQualitySetting)
+	{
+		switch (InQualitySetting)
+		{
+		case XESS_QUALITY_SETTING_ULTRA_PERFORMANCE: return 3.0f;
+		case XESS_QUALITY_SETTING_PERFORMANCE: return 2.3f;
+		case XESS_QUALITY_SETTING_BALANCED: return 2.0f;
+		case XESS_QUALITY_SETTING_QUALITY: return 1.7f;
+		case XESS_QUALITY_SETTING_ULTRA_QUALITY: return 1.5f;
+		case XESS_QUALITY_SETTING_ULTRA_QUALITY_PLUS: return 1.3f;
+		case XESS_QUALITY_SETTING_AA: return 1.0f;
+		default: return 0.0f;
+		}
+	}
+
+	xess_result_t MockGetVersion(xess_version_t* OutVersion)
+	{
+		if (!OutVersion)
+		{
+			return XESS_RESULT_ERROR_INVALID_ARGUMENT;
+		}
+		*OutVersion = {};
+		return XESS_RESULT_SUCCESS;
+	}
+
+	// The mock isn't XeFX, an all zero version is what the SDK reports on non Intel GPUs
+	xess_result_t MockGetIntelXeFXVersion(xess_context_handle_t InContext, xess_version_t* OutVersion)
+	{
+		return MockGetVersion(OutVersion);
+	}
+
+	xess_result_t MockGetOptimalInputResolution(xess_context_handle_t InContext, const xess_2d_t* InOutputResolution, xess_quality_settings_t InQualitySetting,
+		xess_2d_t* OutOptimalInputResolution, xess_2d_t* OutMinInputResolution, xess_2d_t* OutMaxInputResolution)
+	{
+		const float UpscaleRatio = GetUpscaleRatio(InQualitySetting);
+		if (!InOutputResolution || !OutOptimalInputResolution || !OutMinInputResolution || !OutMaxInputResolution || UpscaleRatio <= 0.0f)
+		{
+			return XESS_RESULT_ERROR_INVALID_ARGUMENT;
+		}
+
+		// Dynamic resolution between half the optimal input and native
+		OutOptimalInputResolution->x = FMath::Max(1u, uint32_t(InOutputResolution->x / UpscaleRatio));
+		OutOptimalInputResolution->y = FMath::Max(1u, uint32_t(InOutputResolution->y / UpscaleRatio));
+		OutMinInputResolution->x = FMath::Max(1u, OutOptimalInputResolution->x / 2);
+		OutMinInputResolution->y = FMath::Max(1u, OutOptimalInputResolution->y / 2);
+		*OutMaxInputResolution = *InOutputResolution;
+		return XESS_RESULT_SUCCESS;
+	}
+
+	xess_result_t MockDestroyContext(xess_context_handle_t InContext)
+	{
+		FScopeLock Lock(&MockSection);
+		FXeSSMockContext* Context = FindContext(InContext);
+		if (!Context)
+		{
+			return XESS_RESULT_ERROR_INVALID_CONTEXT;
+		}
+		MockCounters.AllocatedBytes -= Context->MemoryBytes;
+		MockContexts.Remove(Context);
+		delete Context;
+		return XESS_RESULT_SUCCESS;
+	}
+
+	xess_result_t MockSetLoggingCallback(xess_context_handle_t InContext, xess_logging_level_t InLoggingLevel, xess_app_log_callback_t InCallback)
+	{
+		FScopeLock Lock(&MockSection);
+		return FindContext(InContext) ? XESS_RESULT_SUCCESS : XESS_RESULT_ERROR_INVALID_CONTEXT;
+	}
+
+	xess_result_t MockCreateContext(xess_context_handle_t* OutContext)
+	{
+		if (!OutContext)
+		{
+			return XESS_RESULT_ERROR_INVALID_ARGUMENT;
+		}
+
+		FScopeLock Lock(&MockSection);
+		FXeSSMockContext* Context = new FXeSSMockContext();
+		MockContexts.Add(Context);
+		++MockCounters.NumContexts;
+		*OutContext = reinterpret_cast<xess_context_handle_t>(Context);
+		return XESS_RESULT_SUCCESS;
+	}
+
+	xess_result_t MockBuildPipelines(xess_context_handle_t InContext, uint32_t InInitFlags)
+	{
+		FScopeLock Lock(&MockSection);
+		FXeSSMockContext* Context = FindContext(InContext);
+		if (!Context)
+		{
+			return XESS_RESULT_ERROR_INVALID_CONTEXT;
+		}
+		Context->bPipelinesBuilt = true;
+		return XESS_RESULT_SUCCESS;
+	}
+
+	xess_result_t MockInit(xess_context_handle_t InContext, const xess_mock_init_params_t* InParams)
+	{
+		if (!InParams || GetUpscaleRatio(InParams->qualitySetting) <= 0.0f || InParams->outputResolution.x == 0 || InParams->outputResolution.y == 0)
+		{
+			return XESS_RESULT_ERROR_INVALID_ARGUMENT;
+		}
+
+		{
+			FScopeLock Lock(&MockSection);
+			FXeSSMockContext* Context = FindContext(InContext);
+			if (!Context)
+			{
+				return XESS_RESULT_ERROR_INVALID_CONTEXT;
+			}
+
+			const uint64 MemoryBytes = uint64(InParams->outputResolution.x) * InParams->outputResolution.y * FMath::Max(CVarXeSSMockMemoryBytesPerPixel.GetValueOnAnyThread(), 0);
+			MockCounters.AllocatedBytes += MemoryBytes - Context->MemoryBytes;
+			Context->MemoryBytes = MemoryBytes;
+			Context->InitParams = *InParams;
+			Context->bInitialized = true;
+			++MockCounters.NumInits;
+		}
+
+		SimulateLatency(CVarXeSSMockInitLatencyMs.GetValueOnAnyThread());
+		return XESS_RESULT_SUCCESS;
+	}
+
+	xess_result_t MockExecute(xess_context_handle_t InContext, const xess_mock_execute_params_t* InParams)
+	{
+		if (!InParams || !InParams->pColorTexture || !InParams->pVelocityTexture || !InParams->pOutputTexture)
+		{
+			return XESS_RESULT_ERROR_INVALID_ARGUMENT;
+		}
+
+		{
+			FScopeLock Lock(&MockSection);
+			FXeSSMockContext* Context = FindContext(InContext);
+			if (!Context || !Context->bInitialized)
+			{
+				return XESS_RESULT_ERROR_UNINITIALIZED;
+			}
+			if (InParams->inputWidth > Context->InitParams.outputResolution.x || InParams->inputHeight > Context->InitParams.outputResolution.y)
+			{
+				return XESS_RESULT_ERROR_INVALID_ARGUMENT;
+			}
+			++MockCounters.NumExecutes;
+		}
+
+		INC_DWORD_STAT(STAT_XeSSMockExecutions);
+		SimulateLatency(CVarXeSSMockExecuteLatencyMs.GetValueOnAnyThread());
+		return XESS_RESULT_SUCCESS;
+	}
+}
+
+FXeSSSDKWrapperMock::FCounters FXeSSSDKWrapperMock::GetCounters()
+{
+	FScopeLock Lock(&MockSection);
+	return MockCounters;
+}
+
+bool FXeSSSDKWrapperMock::Load()
+{
+	if (!bIsLoaded)
+	{
+		UE_LOG(LogXeSSSDKModule, Log, TEXT("Using the XeSS SDK CPU mock, nothing is upscaled"));
+		{
+			FScopeLock Lock(&MockSection);
+			MockCounters.NumContexts = 0;
+			MockCounters.NumInits = 0;
+			MockCounters.NumExecutes = 0;
+		}
+
+		xessGetVersion = &MockGetVersion;
+		xessGetIntelXeFXVersion = &MockGetIntelXeFXVersion;
+		xessGetOptimalInputResolution = &MockGetOptimalInputResolution;
+		xessDestroyContext = &MockDestroyContext;
+		xessSetLoggingCallback = &MockSetLoggingCallback;
+		bIsLoaded = LoadRHISpecificAPIs();
+	}
+	return bIsLoaded;
+}
+
+bool FXeSSSDKWrapperMock::IsSupported() const
+{
+	return true;
+}
+
+bool FXeSSSDKWrapperMock::LoadRHISpecificAPIs()
+{
+	xessMockBuildPipelines = &MockBuildPipelines;
+	xessMockCreateContext = &MockCreateContext;
+	xessMockExecute = &MockExecute;
+	xessMockInit = &MockInit;
+	return true;
+}
+
+const TCHAR* FXeSSSDKWrapperMock::GetLibraryFileName() const
+{
+	return TEXT("");
+}
+
+#endif
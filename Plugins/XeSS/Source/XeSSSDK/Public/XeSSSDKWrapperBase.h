@@ -32,7 +32,7 @@ public:
 	virtual ~FXeSSSDKWrapperBase();
 	bool IsLoaded() const { return bIsLoaded; }
 	bool IsRHI(const TCHAR* InRHIName) const { return 0 == FCString::Strcmp(InRHIName, *RHIName); }
-	bool Load();
+	virtual bool Load();
 	const TCHAR* GetRHIName() const { return *RHIName; }
 	virtual bool IsSupported() const = 0;
 	virtual const TCHAR* GetLibraryFileName() const = 0;
@@ -50,8 +50,8 @@ public:
 protected:
 	virtual bool LoadRHISpecificAPIs() = 0;
 	void* ModuleHandle = nullptr;
+	bool bIsLoaded = false;
 private:
 	bool LoadGenericAPIs();
-	bool bIsLoaded = false;
 	FString RHIName;
 };
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright 2024 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "XeSSSDKWrapperBase.h"
+
+// -xessmock swaps the XeSS SDK for a CPU stand-in so the plugin side of XeSS can be profiled without a GPU
+#define XESS_SDK_MOCK (!UE_BUILD_SHIPPING)
+
+#if XESS_SDK_MOCK
+
+// Name FXeSSSDKLoader::Load takes for the mock instead of an RHI name
+#define XESS_SDK_MOCK_NAME TEXT("Mock")
+
+typedef struct _xess_mock_init_params_t
+{
+	xess_2d_t outputResolution;
+	xess_quality_settings_t qualitySetting;
+	uint32_t initFlags;
+} xess_mock_init_params_t;
+
+// The textures are only checked for null, nothing is read or written
+typedef struct _xess_mock_execute_params_t
+{
+	void* pColorTexture;
+	void* pVelocityTexture;
+	void* pOutputTexture;
+	float jitterOffsetX;
+	float jitterOffsetY;
+	float exposureScale;
+	uint32_t resetHistory;
+	uint32_t inputWidth;
+	uint32_t inputHeight;
+	xess_coord_t inputColorBase;
+	xess_coord_t outputColorBase;
+} xess_mock_execute_params_t;
+
+class FXeSSSDKWrapperMock : public FXeSSSDKWrapperBase
+{
+public:
+	// What the plugin passed to the mock since it was loaded
+	struct FCounters
+	{
+		uint32 NumContexts = 0;
+		uint32 NumInits = 0;
+		uint32 NumExecutes = 0;
+		// Summed over all live contexts, output pixels times r.XeSS.Mock.MemoryBytesPerPixel
+		uint64 AllocatedBytes = 0;
+	};
+	static XESSSDK_API FCounters GetCounters();
+
+	FXeSSSDKWrapperMock(const TCHAR* InRHIName) : FXeSSSDKWrapperBase(InRHIName) {}
+	bool Load() override;
+	bool IsSupported() const override;
+public:
+	typedef xess_result_t(*xessMockBuildPipelines_t)(xess_context_handle_t, uint32_t);
+	xessMockBuildPipelines_t xessMockBuildPipelines = nullptr;
+	typedef xess_result_t(*xessMockCreateContext_t)(xess_context_handle_t*);
+	xessMockCreateContext_t xessMockCreateContext = nullptr;
+	typedef xess_result_t(*xessMockExecute_t)(xess_context_handle_t, const xess_mock_execute_params_t*);
+	xessMockExecute_t xessMockExecute = nullptr;
+	typedef xess_result_t(*xessMockInit_t)(xess_context_handle_t, const xess_mock_init_params_t*);
+	xessMockInit_t xessMockInit = nullptr;
+private:
+	bool LoadRHISpecificAPIs() override;
+	const TCHAR* GetLibraryFileName() const override;
+};
+
+#endif